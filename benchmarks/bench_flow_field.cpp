@@ -0,0 +1,102 @@
+/**
+ * @file bench_flow_field.cpp
+ * @brief Chasers steered by one shared FlowField against one A* search each
+ * @author IsoMaker Team
+ * @version 0.1
+ *
+ * Builds the same hilly terrain as bench_pathfinding, scatters chasers over
+ * it and measures one integration of the field towards a goal, one tick of
+ * waypoint lookups for every chaser, and uncached A* searches for a sample
+ * of the chasers, scaled up to all of them.
+ *
+ * Usage: bench_flow_field [mapSize] [chasers] [ticks]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Gameplay/FlowField.hpp"
+
+namespace {
+
+constexpr int ASTAR_SAMPLE = 200;
+
+std::vector<Vector3> makeTerrain(int size) {
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> pillar(0, 19);
+    std::vector<Vector3> blocks;
+
+    for (int x = 0; x < size; x++) {
+        for (int z = 0; z < size; z++) {
+            int height = static_cast<int>(2.0f + 1.5f * std::sin(x * 0.15f) + 1.5f * std::cos(z * 0.11f));
+            for (int y = 0; y <= height; y++)
+                blocks.push_back({static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)});
+            if (pillar(random) == 0) {
+                blocks.push_back({static_cast<float>(x), static_cast<float>(height + 1), static_cast<float>(z)});
+                blocks.push_back({static_cast<float>(x), static_cast<float>(height + 2), static_cast<float>(z)});
+            }
+        }
+    }
+    return blocks;
+}
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+int main(int argc, char** argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 256;
+    int chaserCount = argc > 2 ? std::atoi(argv[2]) : 5000;
+    int ticks = argc > 3 ? std::atoi(argv[3]) : 100;
+    if (size <= 0 || chaserCount <= 0 || ticks <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [mapSize] [chasers] [ticks]" << std::endl;
+        return 1;
+    }
+
+    gameplay::NavGrid grid;
+    grid.build(makeTerrain(size));
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> coord(0.0f, static_cast<float>(size));
+    std::vector<Vector3> chasers;
+    for (int i = 0; i < chaserCount; i++)
+        chasers.push_back({coord(random), 100.0f, coord(random)});
+    Vector3 goal = {size / 2.0f + 0.5f, 100.0f, size / 2.0f + 0.5f};
+
+    // One whole integration, as a single update with no budget
+    gameplay::FlowField field(std::numeric_limits<std::size_t>::max());
+    field.setGoal(grid, goal);
+    auto start = std::chrono::steady_clock::now();
+    field.update(grid);
+    double integrationMs = elapsedMs(start);
+
+    Vector3 waypoint;
+    int steering = 0;
+    start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; tick++) {
+        for (const Vector3& chaser : chasers)
+            steering += field.getNextWaypoint(grid, chaser, waypoint);
+    }
+    double lookupMs = elapsedMs(start) / ticks;
+
+    std::vector<Vector3> path;
+    int sample = std::min(ASTAR_SAMPLE, chaserCount);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < sample; i++)
+        grid.findPath(chasers[i], goal, path, false);
+    double searchMs = elapsedMs(start) / sample * chaserCount;
+
+    std::cout << size << "x" << size << " map, " << grid.getNodeCount() << " nodes, " << chaserCount << " chasers" << std::endl;
+    std::cout << "  Field integration:     " << integrationMs << " ms" << std::endl;
+    std::cout << "  Field lookups:         " << lookupMs << " ms/tick (" << steering / ticks << " chasers steered)" << std::endl;
+    std::cout << "  A* for every chaser:   " << searchMs << " ms (from " << sample << " searches)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file bench_hierarchical_paths.cpp
+ * @brief Long routes on a large map: NavGrid A* against NavHierarchy planning
+ * @author IsoMaker Team
+ * @version 0.1
+ *
+ * Builds a hilly terrain with scattered pillars, then times routes between
+ * far apart cells. A* searches the whole grid; the hierarchy plans over the
+ * chunk portals and refines the first segment only, as a walking character
+ * would. Also times the portal work after a single block edit.
+ *
+ * Usage: bench_hierarchical_paths [mapSize] [routes]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Gameplay/NavHierarchy.hpp"
+
+namespace {
+
+std::vector<Vector3> makeTerrain(int size) {
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> pillar(0, 19);
+    std::vector<Vector3> blocks;
+
+    for (int x = 0; x < size; x++) {
+        for (int z = 0; z < size; z++) {
+            int height = static_cast<int>(2.0f + 1.5f * std::sin(x * 0.15f) + 1.5f * std::cos(z * 0.11f));
+            for (int y = 0; y <= height; y++)
+                blocks.push_back({static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)});
+            if (pillar(random) == 0) {
+                blocks.push_back({static_cast<float>(x), static_cast<float>(height + 1), static_cast<float>(z)});
+                blocks.push_back({static_cast<float>(x), static_cast<float>(height + 2), static_cast<float>(z)});
+            }
+        }
+    }
+    return blocks;
+}
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+int main(int argc, char** argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 512;
+    int routeCount = argc > 2 ? std::atoi(argv[2]) : 100;
+    if (size <= 0 || routeCount <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [mapSize] [routes]" << std::endl;
+        return 1;
+    }
+
+    std::vector<Vector3> blocks = makeTerrain(size);
+    gameplay::NavGrid grid;
+    gameplay::NavHierarchy hierarchy;
+    auto start = std::chrono::steady_clock::now();
+    grid.build(blocks);
+    double gridMs = elapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    hierarchy.update(grid);
+    double hierarchyMs = elapsedMs(start);
+
+    // Routes between opposite quarters of the map
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> quarter(0.0f, size / 4.0f);
+    std::vector<std::pair<Vector3, Vector3>> routes;
+    for (int i = 0; i < routeCount; i++) {
+        routes.push_back({{quarter(random), 100.0f, quarter(random)},
+            {size - quarter(random), 100.0f, size - quarter(random)}});
+    }
+
+    std::vector<Vector3> path;
+    double pathLength = 0.0;
+    int found = 0;
+    start = std::chrono::steady_clock::now();
+    for (const auto& route : routes) {
+        found += grid.findPath(route.first, route.second, path, false);
+        pathLength += path.size();
+    }
+    double searchMs = elapsedMs(start) / routeCount;
+
+    gameplay::NavHierarchy::Route plan;
+    std::vector<Vector3> segment;
+    int planned = 0;
+    start = std::chrono::steady_clock::now();
+    for (const auto& route : routes) {
+        if (hierarchy.planRoute(grid, route.first, route.second, plan))
+            planned += hierarchy.refineNext(grid, plan, segment);
+    }
+    double planMs = elapsedMs(start) / routeCount;
+
+    double walkedLength = 0.0;
+    start = std::chrono::steady_clock::now();
+    for (const auto& route : routes) {
+        if (!hierarchy.planRoute(grid, route.first, route.second, plan))
+            continue;
+        while (hierarchy.refineNext(grid, plan, segment))
+            walkedLength += segment.size();
+    }
+    double fullMs = elapsedMs(start) / routeCount;
+
+    blocks.push_back({size / 2.0f + 3.0f, 20.0f, size / 2.0f + 3.0f});
+    start = std::chrono::steady_clock::now();
+    grid.build(blocks);
+    double editGridMs = elapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    hierarchy.update(grid);
+    double editHierarchyMs = elapsedMs(start);
+
+    std::cout << size << "x" << size << " map, " << grid.getNodeCount() << " nodes, " << grid.getChunkCount()
+        << " chunks, " << hierarchy.getPortalCount() << " portals" << std::endl;
+    std::cout << "  Grid build:              " << gridMs << " ms" << std::endl;
+    std::cout << "  Portals and costs:       " << hierarchyMs << " ms" << std::endl;
+    std::cout << "  A* route:                " << searchMs << " ms (" << found << " / " << routeCount << " found, "
+        << pathLength / found << " steps)" << std::endl;
+    std::cout << "  Plan + first segment:    " << planMs << " ms (" << planned << " / " << routeCount << " planned)" << std::endl;
+    std::cout << "  Plan + every segment:    " << fullMs << " ms (" << walkedLength / planned << " steps)" << std::endl;
+    std::cout << "  Block edit, grid:        " << editGridMs << " ms" << std::endl;
+    std::cout << "  Block edit, portals:     " << editHierarchyMs << " ms ("
+        << hierarchy.getLastRebuiltChunkCount() << " chunk redone)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file bench_npc_update.cpp
+ * @brief Per-frame NPC update: Character objects against the ECS storage
+ * @author IsoMaker Team
+ * @version 0.1
+ *
+ * Moves and animates the same NPCs through both paths and reports the
+ * average cost of one frame. Rendering is left out: it needs a window and
+ * costs the same texture draws either way.
+ *
+ * Usage: bench_npc_update [npcCount] [frames]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "ECS/Systems.hpp"
+#include "Entities/Character.hpp"
+
+namespace {
+
+constexpr float FRAME_TIME = 1.0f / 60.0f;
+constexpr int MIN_FRAMES = 4;
+constexpr int FRAME_COUNTS = 5;
+
+using AnimationSets = std::vector<std::shared_ptr<const AnimationSet>>;
+
+struct NpcSetup {
+    Vector3 position;
+    Vector3 velocity;       ///< World units per second
+    int sheet;              ///< Index of the animation set
+    bool moving;
+};
+
+std::vector<NpcSetup> makeNpcs(int count) {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> coord(0.0f, 64.0f);
+    std::uniform_real_distribution<float> speed(-1.0f, 1.0f);
+    std::vector<NpcSetup> npcs;
+
+    for (int i = 0; i < count; i++) {
+        npcs.push_back({{coord(random), 1.0f, coord(random)}, {speed(random), 0.0f, speed(random)},
+            i % FRAME_COUNTS, i % 4 != 0});
+    }
+    return npcs;
+}
+
+// Characters of a sheet share its clips, in both paths
+AnimationSets makeAnimationSets() {
+    AnimationSets sets;
+
+    for (int i = 0; i < FRAME_COUNTS; i++) {
+        sets.push_back(std::make_shared<const AnimationSet>(Vector2{32, 32}, MIN_FRAMES + i));
+    }
+    return sets;
+}
+
+double runCharacters(const std::vector<NpcSetup>& npcs, const AnimationSets& sets, int frames, float& checksum) {
+    std::vector<std::shared_ptr<objects::Character>> characters;
+    std::vector<Vector3> velocities;
+
+    // Characters have no velocity, Game moves them through setBox3DPosition
+    for (const NpcSetup& npc : npcs) {
+        auto character = std::make_shared<objects::Character>();
+        character->setBox3DPosition(npc.position);
+        character->setBox2DSize({32, 32});
+        character->setAnimations(sets[npc.sheet]);
+        character->setMoving(npc.moving);
+        characters.push_back(character);
+        velocities.push_back(npc.velocity);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        for (size_t i = 0; i < characters.size(); i++) {
+            Vector3D position = characters[i]->getBoxPosition();
+            characters[i]->setBox3DPosition({position.x + velocities[i].x * FRAME_TIME,
+                position.y + velocities[i].y * FRAME_TIME, position.z + velocities[i].z * FRAME_TIME});
+            characters[i]->advanceAnimation(FRAME_TIME);
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    checksum = 0.0f;
+    for (auto& character : characters) {
+        checksum += character->getBoxPosition().x + character->getBox2D().getPosition().x;
+    }
+    return std::chrono::duration<double, std::milli>(elapsed).count() / frames;
+}
+
+double runRegistry(const std::vector<NpcSetup>& npcs, const AnimationSets& sets, int frames, float& checksum) {
+    ecs::Registry registry;
+
+    registry.reserve(npcs.size());
+    for (const NpcSetup& npc : npcs) {
+        ecs::Entity entity = registry.create();
+        registry.getPositions().emplace(entity, {npc.position});
+        registry.getVelocities().emplace(entity, {{npc.velocity.x * FRAME_TIME,
+            npc.velocity.y * FRAME_TIME, npc.velocity.z * FRAME_TIME}});
+        registry.getSprites().emplace(entity, {{}, {0, 0, 32, 32}});
+        ecs::Animation animation;
+        animation.set = sets[npc.sheet].get();
+        animation.moving = npc.moving;
+        registry.getAnimations().emplace(entity, animation);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        ecs::updateMovement(registry);
+        ecs::updateAnimations(registry, FRAME_TIME);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    checksum = 0.0f;
+    for (ecs::Entity entity : registry.getPositions().getEntities()) {
+        checksum += registry.getPositions().get(entity).value.x + registry.getSprites().get(entity).source.x;
+    }
+    return std::chrono::duration<double, std::milli>(elapsed).count() / frames;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int npcCount = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 600;
+    if (npcCount <= 0 || frames <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [npcCount] [frames]" << std::endl;
+        return 1;
+    }
+
+    std::vector<NpcSetup> npcs = makeNpcs(npcCount);
+    AnimationSets sets = makeAnimationSets();
+    float characterChecksum = 0.0f;
+    float registryChecksum = 0.0f;
+    double characterMs = runCharacters(npcs, sets, frames, characterChecksum);
+    double registryMs = runRegistry(npcs, sets, frames, registryChecksum);
+
+    std::cout << npcCount << " animated NPCs, " << frames << " frames" << std::endl;
+    std::cout << "  Character objects: " << characterMs << " ms/frame" << std::endl;
+    std::cout << "  ECS registry:      " << registryMs << " ms/frame" << std::endl;
+    std::cout << "  Speedup:           " << characterMs / registryMs << "x" << std::endl;
+    std::cout << "  Checksums:         " << characterChecksum << " / " << registryChecksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file bench_pathfinding.cpp
+ * @brief NavGrid path queries on a large terrain, with and without the path cache
+ * @author IsoMaker Team
+ * @version 0.1
+ *
+ * Builds a hilly terrain with scattered pillars, then runs frames of random
+ * queries. The uncached run measures the A* search alone; the cached run
+ * replays the same queries, as NPCs chasing one goal from the same cells do.
+ *
+ * Usage: bench_pathfinding [mapSize] [queriesPerFrame] [frames]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Gameplay/NavGrid.hpp"
+
+namespace {
+
+std::vector<Vector3> makeTerrain(int size) {
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> pillar(0, 19);
+    std::vector<Vector3> blocks;
+
+    for (int x = 0; x < size; x++) {
+        for (int z = 0; z < size; z++) {
+            int height = static_cast<int>(2.0f + 1.5f * std::sin(x * 0.15f) + 1.5f * std::cos(z * 0.11f));
+            for (int y = 0; y <= height; y++)
+                blocks.push_back({static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)});
+            // Two-block pillars cannot be climbed, searches have to go around them
+            if (pillar(random) == 0) {
+                blocks.push_back({static_cast<float>(x), static_cast<float>(height + 1), static_cast<float>(z)});
+                blocks.push_back({static_cast<float>(x), static_cast<float>(height + 2), static_cast<float>(z)});
+            }
+        }
+    }
+    return blocks;
+}
+
+double runQueries(gameplay::NavGrid& grid, const std::vector<Vector3>& queries, int perFrame, int frames,
+    bool useCache, int& found, size_t& waypoints) {
+    std::vector<Vector3> path;
+
+    found = 0;
+    waypoints = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        for (int i = 0; i < perFrame; i++) {
+            size_t query = (static_cast<size_t>(frame) * perFrame + i) * 2 % queries.size();
+            if (grid.findPath(queries[query], queries[query + 1], path, useCache)) {
+                found++;
+                waypoints += path.size();
+            }
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count() / frames;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 256;
+    int perFrame = argc > 2 ? std::atoi(argv[2]) : 1000;
+    int frames = argc > 3 ? std::atoi(argv[3]) : 5;
+    if (size <= 0 || perFrame <= 0 || frames <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [mapSize] [queriesPerFrame] [frames]" << std::endl;
+        return 1;
+    }
+
+    std::vector<Vector3> blocks = makeTerrain(size);
+    gameplay::NavGrid grid;
+    auto buildStart = std::chrono::steady_clock::now();
+    grid.build(blocks);
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+
+    // Agents spread over the map, each heading for a goal up to 32 cells away
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> coord(0.0f, static_cast<float>(size));
+    std::uniform_real_distribution<float> offset(-32.0f, 32.0f);
+    std::vector<Vector3> queries;
+    for (int i = 0; i < perFrame; i++) {
+        Vector3 from = {coord(random), 100.0f, coord(random)};
+        Vector3 to = {std::fmin(std::fmax(from.x + offset(random), 0.0f), size - 0.5f), 100.0f,
+            std::fmin(std::fmax(from.z + offset(random), 0.0f), size - 0.5f)};
+        queries.push_back(from);
+        queries.push_back(to);
+    }
+
+    int found = 0;
+    size_t waypoints = 0;
+    double searchMs = runQueries(grid, queries, perFrame, frames, false, found, waypoints);
+    runQueries(grid, queries, perFrame, 1, true, found, waypoints);
+    double cachedMs = runQueries(grid, queries, perFrame, frames, true, found, waypoints);
+
+    std::cout << size << "x" << size << " map, " << blocks.size() << " blocks, " << grid.getNodeCount() << " nodes" << std::endl;
+    std::cout << "  Build:          " << buildMs << " ms" << std::endl;
+    std::cout << "  " << perFrame << " searches:  " << searchMs << " ms/frame" << std::endl;
+    std::cout << "  " << perFrame << " cached:    " << cachedMs << " ms/frame" << std::endl;
+    std::cout << "  Paths found:    " << found / frames << " / " << perFrame << ", "
+        << waypoints / std::max(found, 1) << " waypoints each" << std::endl;
+    return 0;
+}
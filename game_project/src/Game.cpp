@@ -1,12 +1,15 @@
 #include "Game.hpp"
 #include <filesystem>
+#include <map>
+#include <sstream>
 #include "Utilities/PathHelper.hpp"
+#include "Scripting/CompiledScriptIO.hpp"
+#include "Assets/ContentPath.hpp"
 
-Game::Game(std::shared_ptr<Render::Window> window, std::shared_ptr<Render::Camera> camera) : _cubeHeight(1)
+Game::Game(std::shared_ptr<Render::Window> window, std::shared_ptr<Render::Camera> camera, bool profileScripts)
+    : _window(window), _camera(camera), _cubeHeight(1), _simulation(_objects3D, _objects2D, camera)
 {
-    _window = window;
     _window->startWindow(Vector2D(SCREENWIDTH, SCREENHEIGHT));
-    _camera = camera;
 
     std::filesystem::path exePath = Utilities::getExecutablePath();
     std::filesystem::path basePath = exePath.parent_path();
@@ -14,11 +17,18 @@ Game::Game(std::shared_ptr<Render::Window> window, std::shared_ptr<Render::Camer
     std::string modelPath = (basePath / "ressources" / "Block1.obj").string();
     std::string mapPath = (exePath / "assets" / "maps" / "game_map.dat").string();
     std::string playerPath = (exePath / "assets" / "entities" / "shy_guy_red.png").string();
+    std::string scriptsPath = (exePath / "assets" / "scripts").string();
+    _contentPath = exePath / "assets" / "content";
 
     _cubeType = Asset3D(modelPath);
     std::cout << "MODEL PATH " << modelPath << "\n";
 
     loadMap(mapPath);
+    if (profileScripts)
+        _simulation.enableProfiling(scriptsPath + "/profile" + scripting::ScriptProfileIO::FILE_EXTENSION);
+    _simulation.loadScripts(scriptsPath);
+    _simulation.start();
+    _liveLink.listen();
 }
 
 Game::~Game()
@@ -93,7 +103,11 @@ void Game::addPlayer(Vector3D position)
     newCharacter->setBox2DSize({_playerAsset.getWidth(), _playerAsset.getHeight()});
     newCharacter->setBox2DScale(_playerAsset.getScale());
     newCharacter->setTotalFrames(_playerAsset.getFramesCount());
-    _player = newCharacter;
+    // The simulation drives the first sprite as the player
+    if (_objects2D.empty())
+        _objects2D.push_back(newCharacter);
+    else
+        _objects2D.front() = newCharacter;
 }
 
 void Game::loadMap(const std::string& filename)
@@ -119,8 +133,7 @@ void Game::loadMap(const std::string& filename)
             file >> position.x >> position.y >> position.z >> filePath >> scale;
             std::cout << "FILENAME " << filePath << "\n";
             std::cout << "POSITION: " << position << "\n";
-            Asset3D tmpAsset(filePath);
-            tmpAsset.loadFile();
+            Asset3D tmpAsset = loadCubeAsset(filePath);
             tmpAsset.setScale(scale);
             changeCubeType(tmpAsset);
             addCube(position);
@@ -132,26 +145,55 @@ void Game::loadMap(const std::string& filename)
     if (header == "PLAYER") {
         file >> count2;
         _objects2D.clear();
-        Vector3D position = {0, 0, 0};
+        std::vector<Vector3D> positions(count2);
+        std::vector<std::string> keys(count2);
+        std::map<std::string, Asset2D> assets;
         Vector2 size;
         std::string filePath;
         float scale;
         int frames;
         for (int i = 0; i < count2; ++i) {
-            file >> position.x >> position.y >> position.z >> filePath >>
+            file >> positions[i].x >> positions[i].y >> positions[i].z >> filePath >>
                 size.x >> size.y >> scale >> frames;
             std::cout << "FILENAME " << filePath << "\n";
-            std::cout << "POSITION: " << position << "\n";
+            std::cout << "POSITION: " << positions[i] << "\n";
             std::cout << "SIZE: " << size << "\n";
             std::cout << "SCALE: " << scale << "\n";
             std::cout << "Frames: " << frames << "\n";
-            Asset2D tmpAsset(filePath);
-            tmpAsset.loadFile();
+            // Sprites of one sheet share its asset, and so its clips
+            std::ostringstream key;
+            key << filePath << " " << size.x << " " << size.y << " " << scale << " " << frames;
+            keys[i] = key.str();
+            if (assets.count(keys[i]))
+                continue;
+            Asset2D tmpAsset;
+            tmpAsset.setFileName(resolveContentPath(filePath));
             tmpAsset.setScale(scale);
             tmpAsset.setWidth(size.x);
             tmpAsset.setHeight(size.y);
             tmpAsset.setFramesCount(frames);
-            changeSpriteType(tmpAsset);
+            assets[keys[i]] = tmpAsset;
+        }
+
+        // Every sheet of the map goes in the atlas, so the sprite batch rarely switches textures
+        _spriteAtlas.unload();
+        _spriteAssets.clear();
+        for (auto &entry : assets)
+            _spriteAtlas.add(entry.second.getFileName());
+        _spriteAtlas.build();
+        for (auto &entry : assets) {
+            Texture2D page;
+            Vector2 origin;
+            if (_spriteAtlas.find(entry.second.getFileName(), page, origin))
+                entry.second.setAtlas(page, origin);
+            else
+                entry.second.loadFile();
+            entry.second.buildAnimations();
+        }
+
+        for (int i = 0; i < count2; ++i) {
+            Vector3D position = positions[i];
+            changeSpriteType(assets[keys[i]]);
             if (i == 0)
                 addPlayer(position);
             else
@@ -159,85 +201,93 @@ void Game::loadMap(const std::string& filename)
             std::cout << "ADD NEW PLAYER : " << i << "\n";
         }
     }
+    loadClips(file);
     file.close();
     std::cout << "Map loaded.\n";
 }
 
-void Game::draw3DElements()
+Asset3D Game::loadCubeAsset(const std::string& assetPath)
 {
-    for (auto i = _objects3D.begin(); i != _objects3D.end(); i++)
-        i->get()->draw();
+    std::string path = resolveContentPath(assetPath);
+    auto cached = _cubeAssets.find(path);
+    if (cached != _cubeAssets.end())
+        return cached->second;
+
+    Asset3D asset;
+    asset.setFileName(path);
+    asset.loadFile();
+    _cubeAssets[path] = asset;
+    return asset;
 }
 
-void Game::draw2DElements()
+Asset2D Game::loadSpriteAsset(const std::string& assetPath)
 {
-    _player->draw(_player->getBox2D().getRectangle(), _camera);
-    for (auto i = _objects2D.begin(); i != _objects2D.end(); i++) {
-        i->get()->draw(i->get()->getBox2D().getRectangle(), _camera);
-    }
+    std::string path = resolveContentPath(assetPath);
+    auto cached = _spriteAssets.find(path);
+    if (cached != _spriteAssets.end())
+        return cached->second;
+
+    Asset2D asset;
+    Texture2D page;
+    Vector2 origin;
+    asset.setFileName(path);
+    // Sheets of the loaded map are in its atlas already
+    if (_spriteAtlas.find(path, page, origin))
+        asset.setAtlas(page, origin);
+    else
+        asset.loadFile();
+    _spriteAssets[path] = asset;
+    return asset;
 }
 
-void Game::handleInput(input::IHandlerBase &inputHandler)
+void Game::loadClips(std::ifstream& file)
 {
-    const float gridStep = 0.1f;
-    Vector3D playerPos = _player->getBoxPosition();
+    std::string header;
+    std::size_t count = 0;
 
-    if (inputHandler.isReleased(input::Generic::SELECT1)) {
-        _camera->rotateClock();
-        std::cout << "Rotate Camera" << std::endl;
-    }
-    if (inputHandler.isReleased(input::Generic::SELECT2)) {
-        _camera->rotateCounterclock();
-        std::cout << "Other Rotate Camera" << std::endl;
-    }
-    if (!inputHandler.isNotPressed(input::Generic::LEFT) || !inputHandler.isNotPressed(input::Generic::RIGHT) || !inputHandler.isNotPressed(input::Generic::UP) || !inputHandler.isNotPressed(input::Generic::DOWN)) {
-        if (!inputHandler.isNotPressed(input::Generic::LEFT) && handleCollision({playerPos.x - gridStep, playerPos.y, playerPos.z})) {
-            playerPos.x -= gridStep;
-        }
-        if (!inputHandler.isNotPressed(input::Generic::RIGHT) && handleCollision({playerPos.x + gridStep, playerPos.y, playerPos.z})) {
-            playerPos.x += gridStep;
-        }
-        if (!inputHandler.isNotPressed(input::Generic::UP) && handleCollision({playerPos.x, playerPos.y, playerPos.z - gridStep})) {
-            playerPos.z -= gridStep;
-        }
-        if (!inputHandler.isNotPressed(input::Generic::DOWN) && handleCollision({playerPos.x, playerPos.y, playerPos.z + gridStep})) {
-            playerPos.z += gridStep;
-        }
-        _player->setBox3DPosition(playerPos);
-        _player->setMoving(true);
-    } else {
-        _player->setMoving(false);
+    if (!(file >> header) || header != "CLIPS")
+        return;
+    file >> count;
+    std::vector<std::vector<AnimationClip>> clips(_objects2D.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t sprite = 0;
+        std::string line;
+        AnimationClip clip;
+        file >> sprite;
+        std::getline(file, line);
+        if (sprite < clips.size() && AnimationSet::parseClip(line, clip))
+            clips[sprite].push_back(clip);
     }
-    if (!inputHandler.isNotPressed(input::Generic::ATTACK) && !_isJumping) {
-        std::cout << "JUMP !\n";
-        _isJumping = true;
-        _jumpVelocity = 0.15f;
-        oldPosY = playerPos.y;
+    for (std::size_t i = 0; i < clips.size(); ++i) {
+        if (clips[i].empty())
+            continue;
+        Asset2D &asset = _objects2D[i]->getAsset2D();
+        asset.setClips(clips[i]);
+        asset.buildAnimations();
+        _objects2D[i]->setAnimations(asset.getAnimations());
     }
 }
 
-bool Game::handleCollision(Utilities::Vector3D newPos)
+std::string Game::resolveContentPath(const std::string& assetPath) const
 {
-    bool blocBelow = false;
-    int blocWidth = 1;
-    int blocHeight = 1;
+    // Exported assets keep their map path under the content directory (see the editor's GameExporter)
+    std::error_code ec;
+    std::filesystem::path key = assets::contentKey(assetPath);
+    std::filesystem::path exported = _contentPath / key;
+
+    if (!key.empty() && std::filesystem::is_regular_file(exported, ec))
+        return exported.string();
+    return assetPath;
+}
 
-    for (auto i = _objects3D.begin(); i != _objects3D.end(); i++) {
-        Utilities::Vector3D posTmp = i->get()->getBoxPosition();
+void Game::draw3DElements()
+{
+    _simulation.draw3D();
+}
 
-        if (newPos.x >= posTmp.x && newPos.x <= posTmp.x + 1 &&
-            newPos.z >= posTmp.z && newPos.z <= posTmp.z + 1 &&
-            newPos.y >= posTmp.y && newPos.y < posTmp.y + 1) {
-            return false;
-        }
-        if (newPos.x >= posTmp.x && newPos.x <= posTmp.x + 1 &&
-            newPos.z >= posTmp.z && newPos.z <= posTmp.z + 1) {
-                if (std::abs((posTmp.y + 1.0f) - newPos.y) < 0.05f) {
-                    blocBelow = true;
-                }
-        }
-    }
-    return blocBelow;
+void Game::draw2DElements()
+{
+    _simulation.draw2D({0, 0, SCREENWIDTH, SCREENHEIGHT});
 }
 
 Utilities::Vector3D Game::getEntitieBlockPos(Utilities::Vector3D pos)
@@ -247,27 +297,76 @@ Utilities::Vector3D Game::getEntitieBlockPos(Utilities::Vector3D pos)
 
 void Game::update(input::IHandlerBase &inputHandler)
 {
-    handleInput(inputHandler);
-
-    if (_isJumping) {
-        Vector3D playerPos = _player->getBoxPosition();
-        _jumpVelocity += _gravity;
-        playerPos.y += _jumpVelocity;
-
-        if (_jumpVelocity <= 0 && handleCollision({playerPos.x, playerPos.y - 0.01f, playerPos.z})) {
-            _isJumping = false;
-            _jumpVelocity = 0;
-            playerPos.y -= 0.01f;
-        } else if (_jumpVelocity <= 0) {
-            _isJumping = false;
-            _jumpVelocity = 0;
-            playerPos.y = oldPosY;
-        }
+    applyLiveLinkMessages();
+    _simulation.update(inputHandler, GetFrameTime());
+}
 
-        _player->setBox3DPosition(playerPos);
+void Game::applyLiveLinkMessages()
+{
+    _liveLinkMessages.clear();
+    _liveLink.poll(_liveLinkMessages);
+
+    for (const livelink::Message &message : _liveLinkMessages) {
+        switch (message.type) {
+            case livelink::MessageType::MAP_CLEARED:
+                _objects3D.clear();
+                _objects2D.clear();
+                _simulation.resetSceneState();
+                break;
+            case livelink::MessageType::CUBE_ADDED: {
+                Asset3D tmpAsset = loadCubeAsset(message.path);
+                tmpAsset.setScale(message.scale);
+                changeCubeType(tmpAsset);
+                addCube(message.position);
+                _simulation.markWorldDirty();
+                break;
+            }
+            case livelink::MessageType::CUBE_REMOVED:
+                for (auto i = _objects3D.begin(); i != _objects3D.end(); i++) {
+                    if (i->get()->getBoxPosition() == Vector3D(message.position)) {
+                        _objects3D.erase(i);
+                        break;
+                    }
+                }
+                _simulation.markWorldDirty();
+                break;
+            case livelink::MessageType::SPRITE_ADDED: {
+                Asset2D tmpAsset = loadSpriteAsset(message.path);
+                tmpAsset.setScale(message.scale);
+                tmpAsset.setWidth(message.width);
+                tmpAsset.setHeight(message.height);
+                tmpAsset.setFramesCount(message.frames);
+                tmpAsset.buildAnimations();
+                changeSpriteType(tmpAsset);
+                // Sprites arrive in placement order, the first one is the player
+                if (_objects2D.empty())
+                    addPlayer(message.position);
+                else
+                    addCharacter(message.position);
+                break;
+            }
+            case livelink::MessageType::SPRITE_REMOVED:
+                if (message.index >= 0 && message.index < static_cast<int>(_objects2D.size()))
+                    _objects2D.erase(_objects2D.begin() + message.index);
+                break;
+            case livelink::MessageType::SCRIPT_UPDATED: {
+                CompiledScript script(-1);
+                std::string error;
+                if (!scripting::CompiledScriptIO::read(message.payload.data(), message.payload.size(), script, error)) {
+                    std::cerr << "[Game] Ignoring pushed script: " << error << std::endl;
+                    break;
+                }
+                // Replaced scripts restart: their ON_START runs again
+                _simulation.getScripts().removeScripts(script.objectId);
+                _simulation.addScript(script);
+                std::cout << "[Game] Reloaded script for object " << script.objectId << std::endl;
+                break;
+            }
+            case livelink::MessageType::SCRIPT_REMOVED:
+                _simulation.getScripts().removeScripts(message.index);
+                break;
+        }
     }
-
-    _player->updateAnimation();
 }
 
 void drawVerticalGradient(Rectangle rect, Color top, Color bottom) {
@@ -302,5 +401,6 @@ void Game::loop(input::IHandlerBase &inputHandler)
         Render();
         std::this_thread::sleep_for(std::chrono::milliseconds(16));
     }
+    _simulation.saveProfile();
     _window->closeWindow();
 }
@@ -3,9 +3,12 @@
 #include <vector>
 #include <fstream>
 #include <cmath>
+#include <filesystem>
+#include <map>
 
 // Library
 #include "Render/Camera.hpp"
+#include "Render/TextureAtlas.hpp"
 #include "Render/Window.hpp"
 #include "Utilities/Vector.hpp"
 
@@ -15,47 +18,69 @@
 #include "Input/Gamepad.hpp"
 #include "Input/MouseKeyboard.hpp"
 
+#include "Gameplay/GameSimulation.hpp"
+#include "LiveLink/LiveLink.hpp"
+
 #define SCREENHEIGHT 1200
 #define SCREENWIDTH 1600
 
 class Game {
     public:
-        Game(std::shared_ptr<Render::Window> window, std::shared_ptr<Render::Camera> camera);
+        /**
+         * @param profileScripts Record the scripts' costs to assets/scripts/profile.isp, where the editor reads them
+         */
+        Game(std::shared_ptr<Render::Window> window, std::shared_ptr<Render::Camera> camera, bool profileScripts = false);
         ~Game();
 
         void addCube(Vector3D position);
         void addCharacter(Vector3D position);
         void addPlayer(Vector3D position);
         void loadMap(const std::string& filename);
+        std::string resolveContentPath(const std::string& assetPath) const;
         void draw3DElements();
         void draw2DElements();
 
         void update(input::IHandlerBase &mouseHandler);
         void Render();
         void loop(input::IHandlerBase &mouseHandler);
-        void handleInput(input::IHandlerBase &mouseHandler);
-        bool handleCollision(Utilities::Vector3D newPos);
         Utilities::Vector3D getEntitieBlockPos(Utilities::Vector3D pos);
         void changeCubeType(Asset3D asset);
         void changeSpriteType(Asset2D asset);
 
+        void applyLiveLinkMessages();
+
     protected:
 
     private:
+        /**
+         * @brief Give the sprites just loaded the clips listed after them in the map
+         */
+        void loadClips(std::ifstream& file);
+        /**
+         * @brief Load a model once, the cubes using it get copies sharing the mesh
+         */
+        Asset3D loadCubeAsset(const std::string& assetPath);
+        /**
+         * @brief Load a sprite sheet once, from the map's atlas when it is there
+         */
+        Asset2D loadSpriteAsset(const std::string& assetPath);
+
         std::vector<std::shared_ptr<objects::MapElement>> _objects3D;
         std::vector<std::shared_ptr<objects::Character>> _objects2D;
 
         Asset3D _cubeType;
         Asset2D _playerAsset;
+        Render::TextureAtlas _spriteAtlas;                  ///< Sprite sheets of the loaded map
+        std::map<std::string, Asset3D> _cubeAssets;          ///< Loaded models, by resolved path
+        std::map<std::string, Asset2D> _spriteAssets;        ///< Sheets added through the live link, by resolved path
 
         std::shared_ptr<Render::Window> _window;             ///< Reference to the application window
         std::shared_ptr<Render::Camera> _camera;             ///< Reference to the 3D camera
 
-        std::shared_ptr<objects::Character> _player;
-
         float _cubeHeight;
-        bool _isJumping = false;
-        float _jumpVelocity = 0.0f;
-        float _gravity = -0.01f;
-        float oldPosY = 0.0f;
+
+        std::filesystem::path _contentPath;                  ///< Assets copied by the editor's export
+        gameplay::GameSimulation _simulation;                ///< Player, collisions and scripts, shared with the editor's play mode
+        livelink::LiveLinkServer _liveLink;                  ///< Receives edits from a running editor
+        std::vector<livelink::Message> _liveLinkMessages;
 };
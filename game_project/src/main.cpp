@@ -9,12 +9,18 @@ void mouseLoop(input::MouseKeyboardHandler &inputHandler, bool &running)
     }
 }
 
-int main()
+int main(int argc, char **argv)
 {
     input::MouseKeyboardHandler inputHandler;
     std::shared_ptr<Render::Window> window = std::make_shared<Render::Window>();
     std::shared_ptr<Render::Camera> camera = std::make_shared<Render::Camera>();
-    Game game(window, camera);
+    bool profileScripts = false;
+
+    // --profile records the scripts' costs for the editor's heat map
+    for (int i = 1; i < argc; i++)
+        if (std::string(argv[i]) == "--profile")
+            profileScripts = true;
+    Game game(window, camera, profileScripts);
     bool running = true;
 
     std::thread mouseKeyboardThread(mouseLoop, std::ref(inputHandler), std::ref(running));
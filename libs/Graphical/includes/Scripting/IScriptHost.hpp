@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** IScriptHost
+*/
+
+#pragma once
+
+#include <raylib.h>
+#include <cstddef>
+#include <string>
+
+namespace scripting
+{
+    /**
+     * @brief Side effects a running script can apply to the scene
+     *
+     * Object ids follow the scene numbering used by the editor: 3D map
+     * elements first, then 2D sprites.
+     */
+    class IScriptHost
+    {
+        public:
+            virtual ~IScriptHost() = default;
+
+            virtual void moveObject(int objectId, Vector3 offset) = 0;
+            virtual void rotateObject(int objectId, Vector3 axis, float degrees) = 0;
+            virtual void setObjectColor(int objectId, Color color) = 0;
+            virtual void setObjectVisible(int objectId, bool visible) = 0;
+            virtual void logMessage(int objectId, const std::string &message) = 0;
+
+            /**
+             * @brief Apply one offset per object, as produced by batched scripts
+             *
+             * Offsets are stored as separate X/Y/Z arrays. Hosts with SoA
+             * transforms can override this to add them in one pass.
+             */
+            virtual void moveObjects(const int *objectIds, const float *offsetX, const float *offsetY,
+                const float *offsetZ, std::size_t count)
+            {
+                for (std::size_t i = 0; i < count; i++) {
+                    if (offsetX[i] != 0.0f || offsetY[i] != 0.0f || offsetZ[i] != 0.0f)
+                        moveObject(objectIds[i], {offsetX[i], offsetY[i], offsetZ[i]});
+                }
+            }
+
+        protected:
+        private:
+    };
+}
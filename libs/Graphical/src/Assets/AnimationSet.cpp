@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** AnimationSet
+*/
+
+#include "AnimationSet.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+AnimationSet::AnimationSet(Vector2 frameSize, int stripFrames, const std::vector<AnimationClip> &clips,
+    Vector2 origin) : _clips(clips)
+{
+    if (_clips.empty()) {
+        AnimationClip walk;
+        walk.name = "walk";
+        walk.frameCount = std::max(stripFrames, 1);
+        walk.fps = DEFAULT_FPS;
+        _clips.push_back(walk);
+    }
+    _walkClip = findClip("walk");
+    if (_walkClip == -1)
+        _walkClip = 0;
+    _idleClip = findClip("idle");
+    if (_idleClip == -1) {
+        // Standing still shows the first frame of the walk
+        AnimationClip idle = _clips[_walkClip];
+        idle.name = "idle";
+        idle.frameCount = 1;
+        _clips.push_back(idle);
+        _idleClip = static_cast<int>(_clips.size()) - 1;
+    }
+    _jumpClip = findClip("jump");
+
+    for (const AnimationClip &clip : _clips) {
+        _clipStart.push_back(static_cast<int>(_frames.size()));
+        for (int frame = 0; frame < std::max(clip.frameCount, 1); frame++) {
+            _frames.push_back({origin.x + (clip.firstFrame + frame) * frameSize.x, origin.y + clip.row * frameSize.y,
+                frameSize.x, frameSize.y});
+        }
+    }
+}
+
+bool AnimationSet::parseClip(const std::string &text, AnimationClip &clip)
+{
+    std::istringstream stream(text);
+    AnimationClip parsed;
+    std::string mode;
+
+    if (!(stream >> parsed.name >> parsed.row >> parsed.firstFrame >> parsed.frameCount >> parsed.fps))
+        return false;
+    if (parsed.row < 0 || parsed.firstFrame < 0 || parsed.frameCount < 1 || parsed.fps <= 0.0f)
+        return false;
+    if (stream >> mode)
+        parsed.loop = mode != "once";
+    clip = parsed;
+    return true;
+}
+
+std::string AnimationSet::formatClip(const AnimationClip &clip)
+{
+    std::ostringstream stream;
+
+    stream << clip.name << " " << clip.row << " " << clip.firstFrame << " " << clip.frameCount << " "
+        << clip.fps << " " << (clip.loop ? "loop" : "once");
+    return stream.str();
+}
+
+int AnimationSet::findClip(const std::string &name) const
+{
+    for (std::size_t clip = 0; clip < _clips.size(); clip++) {
+        if (_clips[clip].name == name)
+            return static_cast<int>(clip);
+    }
+    return -1;
+}
+
+int AnimationSet::pickClip(bool moving, bool jumping) const
+{
+    if (jumping && _jumpClip != -1)
+        return _jumpClip;
+    return moving ? _walkClip : _idleClip;
+}
+
+const Rectangle &AnimationSet::play(int clip, int &playing, float &time, float deltaTime) const
+{
+    if (clip != playing) {
+        playing = clip;
+        time = 0.0f;
+    } else {
+        time += deltaTime;
+        // Keep looping clips to one lap, the time would lose precision otherwise
+        const AnimationClip &played = _clips[clip];
+        float lap = std::max(played.frameCount, 1) / played.fps;
+        if (played.loop && time >= lap)
+            time = std::fmod(time, lap);
+    }
+    return getFrame(clip, getFrameAt(clip, time));
+}
+
+int AnimationSet::getFrameAt(int clip, float time) const
+{
+    const AnimationClip &played = _clips[clip];
+    int count = std::max(played.frameCount, 1);
+    int frame = static_cast<int>(std::floor(std::max(time, 0.0f) * played.fps));
+
+    if (played.loop)
+        return frame % count;
+    return std::min(frame, count - 1);
+}
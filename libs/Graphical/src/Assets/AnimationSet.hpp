@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** AnimationSet
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <raylib.h>
+
+/**
+ * @brief Named run of frames on a sprite sheet
+ *
+ * Written in asset descriptors as "Clip: <name> <row> <first> <count> <fps> [loop|once]".
+ */
+struct AnimationClip
+{
+    std::string name;
+    int row = 0;
+    int firstFrame = 0;
+    int frameCount = 1;
+    float fps = 7.5f;
+    bool loop = true;
+};
+
+/**
+ * @brief Clips of one sprite sheet with their source rectangles worked out once
+ *
+ * Every character drawn from the sheet shares the set. Playing a clip is a
+ * table lookup from the time spent in it, so the speed no longer depends on
+ * the frame rate.
+ *
+ * A sheet with no clips gets the single strip the editor always used:
+ * "idle" shows the first frame and "walk" loops over all of them.
+ */
+class AnimationSet
+{
+    public:
+        static constexpr float DEFAULT_FPS = 7.5f;      ///< A frame every 8 updates at 60 FPS, as the old counter did
+
+        /**
+         * @param origin Top-left corner of the sheet in its texture, when the texture is an atlas
+         */
+        AnimationSet(Vector2 frameSize, int stripFrames, const std::vector<AnimationClip> &clips = {},
+            Vector2 origin = {0.0f, 0.0f});
+        ~AnimationSet() = default;
+
+        /**
+         * @brief Read a clip written as "<name> <row> <first> <count> <fps> [loop|once]"
+         */
+        static bool parseClip(const std::string &text, AnimationClip &clip);
+        static std::string formatClip(const AnimationClip &clip);
+
+        /**
+         * @return The clip's index, or -1
+         */
+        int findClip(const std::string &name) const;
+        const AnimationClip &getClip(int clip) const { return _clips[clip]; };
+        std::size_t getClipCount() const { return _clips.size(); };
+
+        /**
+         * @brief Frame of a clip showing after time seconds in it
+         */
+        int getFrameAt(int clip, float time) const;
+        const Rectangle &getFrame(int clip, int frame) const { return _frames[_clipStart[clip] + frame]; };
+
+        /**
+         * @brief Clip for a character's state: jump when the sheet has one, walk or idle
+         */
+        int pickClip(bool moving, bool jumping) const;
+        /**
+         * @brief Play clip for deltaTime more seconds
+         *
+         * playing and time hold where the character is. A new clip starts
+         * from its first frame; a looping one keeps time within one lap.
+         * @return The frame to show
+         */
+        const Rectangle &play(int clip, int &playing, float &time, float deltaTime) const;
+
+        int getIdleClip() const { return _idleClip; };
+        int getWalkClip() const { return _walkClip; };
+        int getJumpClip() const { return _jumpClip; };     ///< -1 when the sheet has none
+
+    protected:
+    private:
+        std::vector<AnimationClip> _clips;
+        std::vector<int> _clipStart;        ///< First rectangle of each clip in _frames
+        std::vector<Rectangle> _frames;
+        int _idleClip = 0;
+        int _walkClip = 0;
+        int _jumpClip = -1;
+};
@@ -32,6 +32,12 @@ void Asset2D::setTexture(Texture2D texture)
     }
 }
 
+void Asset2D::setAtlas(Texture2D page, Vector2 origin)
+{
+    setTexture(page);
+    _atlasOrigin = origin;
+}
+
 void Asset2D::loadFile()
 {
     _texture = LoadTexture(_fileName.c_str());
@@ -41,3 +47,9 @@ void Asset2D::loadFile()
         _textureLoaded = false;
     }
 }
+
+void Asset2D::buildAnimations()
+{
+    _animations = std::make_shared<const AnimationSet>(
+        Vector2{static_cast<float>(_width), static_cast<float>(_height)}, _frames, _clips, _atlasOrigin);
+}
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+
 #include "AAsset.hpp"
+#include "AnimationSet.hpp"
 
 class Asset2D : public AAsset
 {
@@ -11,6 +14,11 @@ class Asset2D : public AAsset
         ~Asset2D() = default;
         Texture2D getTexture() const;
         void setTexture(Texture2D texture);
+        /**
+         * @brief Draw from a page of a texture atlas, the sheet's top-left corner at origin
+         */
+        void setAtlas(Texture2D page, Vector2 origin);
+        Vector2 getAtlasOrigin() { return _atlasOrigin; };
         void loadFile();
         bool isLoaded() { return _textureLoaded; };
         int getWidth() { return _width; };
@@ -22,10 +30,23 @@ class Asset2D : public AAsset
         void setHeight(int height) { _height = height; };
         void setFramesCount(int frames) { _frames = frames; };
 
+        std::vector<AnimationClip> getClips() { return _clips; };
+        void setClips(std::vector<AnimationClip> clips) { _clips = clips; };
+        /**
+         * @brief Work out the clip frames from the size, frame count and clips set so far
+         *
+         * Copies of the asset made afterwards share the result.
+         */
+        void buildAnimations();
+        std::shared_ptr<const AnimationSet> getAnimations() const { return _animations; };
+
     protected:
         bool _textureLoaded;
         Texture2D _texture;
-        int _width;
-        int _height;
-        int _frames;
+        int _width = 0;
+        int _height = 0;
+        int _frames = 1;
+        std::vector<AnimationClip> _clips;
+        std::shared_ptr<const AnimationSet> _animations;
+        Vector2 _atlasOrigin = {0.0f, 0.0f};
 };
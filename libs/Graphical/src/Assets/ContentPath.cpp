@@ -0,0 +1,30 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** ContentPath
+*/
+
+#include "ContentPath.hpp"
+
+namespace assets
+{
+    std::filesystem::path contentKey(const std::string &assetPath)
+    {
+        std::filesystem::path key;
+
+        // After normalisation a ".." can only come before every named component
+        for (const std::filesystem::path &part : std::filesystem::path(assetPath).lexically_normal().relative_path()) {
+            if (part == "..")
+                key /= PARENT_DIRECTORY;
+            else if (!part.empty() && part != ".")
+                key /= part;
+        }
+        return key;
+    }
+
+    bool isContentKey(const std::string &key)
+    {
+        return !key.empty() && contentKey(key).generic_string() == key;
+    }
+}
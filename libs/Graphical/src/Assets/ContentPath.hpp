@@ -0,0 +1,32 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** ContentPath
+*/
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+namespace assets
+{
+    constexpr const char *PARENT_DIRECTORY = "_parent";    ///< Stands for a leading ".." in content keys
+
+    /**
+     * @brief Where an exported asset lives, relative to the content directory
+     *
+     * The map path, normalised and made relative. Each ".." left at the
+     * front becomes PARENT_DIRECTORY, so no key leads out of the content
+     * directory. Empty for a path naming nothing, like ".".
+     */
+    std::filesystem::path contentKey(const std::string &assetPath);
+
+    /**
+     * @brief Whether key is what contentKey() returns for it
+     *
+     * Keys read back from disk are only trusted when they are.
+     */
+    bool isContentKey(const std::string &key);
+}
@@ -0,0 +1,53 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** Components
+*/
+
+#pragma once
+
+#include "raylib.h"
+
+#include "../Assets/AnimationSet.hpp"
+
+namespace ecs
+{
+    struct Position {
+        Vector3 value = {0.0f, 0.0f, 0.0f};
+    };
+
+    /**
+     * @brief World units per update
+     */
+    struct Velocity {
+        Vector3 value = {0.0f, 0.0f, 0.0f};
+    };
+
+    /**
+     * @brief Sprite sheet and the frame currently shown
+     */
+    struct Sprite {
+        Texture2D texture = {};
+        Rectangle source = {0.0f, 0.0f, 0.0f, 0.0f};
+    };
+
+    /**
+     * @brief Clip playing on a sprite, stepped like objects::Character::advanceAnimation()
+     */
+    struct Animation {
+        const AnimationSet *set = nullptr;  ///< Shared with the character, which keeps it alive
+        int clip = -1;                      ///< Clip playing, -1 until the first update
+        float time = 0.0f;                  ///< Seconds into the clip
+        bool moving = false;
+        bool jumping = false;
+    };
+
+    /**
+     * @brief Falling and landing state of a character moved through the cubes
+     */
+    struct Body {
+        float verticalVelocity = 0.0f;      ///< World units per update
+        bool grounded = false;
+    };
+}
@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** Registry
+*/
+
+#include "Registry.hpp"
+
+namespace ecs
+{
+    Entity Registry::create()
+    {
+        std::uint32_t index;
+
+        if (!_freeSlots.empty()) {
+            index = _freeSlots.back();
+            _freeSlots.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(_versions.size());
+            _versions.push_back(0);
+        }
+        _aliveCount++;
+        return makeEntity(index, _versions[index]);
+    }
+
+    void Registry::destroy(Entity entity)
+    {
+        if (!isAlive(entity))
+            return;
+
+        _positions.remove(entity);
+        _velocities.remove(entity);
+        _sprites.remove(entity);
+        _animations.remove(entity);
+        _bodies.remove(entity);
+
+        std::uint32_t index = entityIndex(entity);
+        // Versions wrap within the bits left above the index
+        _versions[index] = (_versions[index] + 1) & (NULL_ENTITY >> ENTITY_INDEX_BITS);
+        _freeSlots.push_back(index);
+        _aliveCount--;
+    }
+
+    bool Registry::isAlive(Entity entity) const
+    {
+        std::uint32_t index = entityIndex(entity);
+        return entity != NULL_ENTITY && index < _versions.size() && _versions[index] == entityVersion(entity);
+    }
+
+    void Registry::reserve(std::size_t count)
+    {
+        _versions.reserve(count);
+        _positions.reserve(count);
+        _velocities.reserve(count);
+        _sprites.reserve(count);
+        _animations.reserve(count);
+        _bodies.reserve(count);
+    }
+
+    void Registry::clear()
+    {
+        // Slots are kept and versioned so handles from before the clear stay dead
+        _freeSlots.clear();
+        for (std::size_t index = _versions.size(); index-- > 0;) {
+            _versions[index] = (_versions[index] + 1) & (NULL_ENTITY >> ENTITY_INDEX_BITS);
+            _freeSlots.push_back(static_cast<std::uint32_t>(index));
+        }
+        _aliveCount = 0;
+        _positions.clear();
+        _velocities.clear();
+        _sprites.clear();
+        _animations.clear();
+        _bodies.clear();
+    }
+}
@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** Registry
+*/
+
+#pragma once
+
+#include "Components.hpp"
+#include "SparseSet.hpp"
+
+namespace ecs
+{
+    /**
+     * @brief Owns the runtime entities and one packed pool per component type
+     *
+     * Each component type lives in its own array (structure of arrays), so a
+     * system touching positions and velocities never loads sprite or
+     * animation data. Entities are plain handles; slots are recycled with a new version.
+     */
+    class Registry
+    {
+        public:
+            Registry() = default;
+            ~Registry() = default;
+
+            Entity create();
+            void destroy(Entity entity);
+            bool isAlive(Entity entity) const;
+            std::size_t getAliveCount() const { return _aliveCount; };
+
+            /**
+             * @brief Reserve room for a known number of entities in every pool
+             */
+            void reserve(std::size_t count);
+            void clear();
+
+            SparseSet<Position> &getPositions() { return _positions; };
+            SparseSet<Velocity> &getVelocities() { return _velocities; };
+            SparseSet<Sprite> &getSprites() { return _sprites; };
+            SparseSet<Animation> &getAnimations() { return _animations; };
+            SparseSet<Body> &getBodies() { return _bodies; };
+
+            const SparseSet<Position> &getPositions() const { return _positions; };
+            const SparseSet<Sprite> &getSprites() const { return _sprites; };
+            const SparseSet<Animation> &getAnimations() const { return _animations; };
+
+        protected:
+        private:
+            std::vector<std::uint32_t> _versions;   ///< Current version of each slot
+            std::vector<std::uint32_t> _freeSlots;
+            std::size_t _aliveCount = 0;
+
+            SparseSet<Position> _positions;
+            SparseSet<Velocity> _velocities;
+            SparseSet<Sprite> _sprites;
+            SparseSet<Animation> _animations;
+            SparseSet<Body> _bodies;
+    };
+}
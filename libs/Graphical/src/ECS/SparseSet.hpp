@@ -0,0 +1,124 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** SparseSet
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ecs
+{
+    /**
+     * @brief Entity handle: slot index in the low bits, slot version in the high bits
+     *
+     * The version changes whenever a slot is recycled, so a handle kept after
+     * destroy() no longer matches the entity that reuses its slot.
+     */
+    using Entity = std::uint32_t;
+
+    static constexpr int ENTITY_INDEX_BITS = 20;
+    static constexpr Entity ENTITY_INDEX_MASK = (Entity(1) << ENTITY_INDEX_BITS) - 1;
+    static constexpr Entity NULL_ENTITY = ~Entity(0);
+
+    inline std::uint32_t entityIndex(Entity entity) { return entity & ENTITY_INDEX_MASK; }
+    inline std::uint32_t entityVersion(Entity entity) { return entity >> ENTITY_INDEX_BITS; }
+    inline Entity makeEntity(std::uint32_t index, std::uint32_t version) { return (version << ENTITY_INDEX_BITS) | index; }
+
+    /**
+     * @brief Component storage keeping every component of one type in a packed array
+     *
+     * The sparse array maps an entity slot to a position in the dense arrays;
+     * removal swaps the last component into the hole, so systems always walk
+     * contiguous memory with no gaps to skip.
+     */
+    template <typename T>
+    class SparseSet
+    {
+        public:
+            /**
+             * @brief Add or replace the component of an entity
+             */
+            T &emplace(Entity entity, const T &component)
+            {
+                std::uint32_t index = entityIndex(entity);
+
+                if (index >= _sparse.size())
+                    _sparse.resize(index + 1, NONE);
+                if (_sparse[index] != NONE) {
+                    _dense[_sparse[index]] = entity;
+                    return _data[_sparse[index]] = component;
+                }
+                _sparse[index] = static_cast<std::uint32_t>(_dense.size());
+                _dense.push_back(entity);
+                _data.push_back(component);
+                return _data.back();
+            }
+
+            void remove(Entity entity)
+            {
+                if (!contains(entity))
+                    return;
+
+                std::uint32_t position = _sparse[entityIndex(entity)];
+                std::uint32_t last = static_cast<std::uint32_t>(_dense.size() - 1);
+                if (position != last) {
+                    _dense[position] = _dense[last];
+                    _data[position] = std::move(_data[last]);
+                    _sparse[entityIndex(_dense[position])] = position;
+                }
+                _dense.pop_back();
+                _data.pop_back();
+                _sparse[entityIndex(entity)] = NONE;
+            }
+
+            bool contains(Entity entity) const
+            {
+                std::uint32_t index = entityIndex(entity);
+                return index < _sparse.size() && _sparse[index] != NONE && _dense[_sparse[index]] == entity;
+            }
+
+            T *tryGet(Entity entity) { return contains(entity) ? &_data[_sparse[entityIndex(entity)]] : nullptr; };
+            const T *tryGet(Entity entity) const { return contains(entity) ? &_data[_sparse[entityIndex(entity)]] : nullptr; };
+
+            /**
+             * @brief Component of an entity known to have one
+             */
+            T &get(Entity entity) { return _data[_sparse[entityIndex(entity)]]; };
+            const T &get(Entity entity) const { return _data[_sparse[entityIndex(entity)]]; };
+
+            std::size_t size() const { return _dense.size(); };
+            bool empty() const { return _dense.empty(); };
+
+            /**
+             * @brief Owners of the packed components, in the same order as getData()
+             */
+            const std::vector<Entity> &getEntities() const { return _dense; };
+            std::vector<T> &getData() { return _data; };
+            const std::vector<T> &getData() const { return _data; };
+
+            void reserve(std::size_t count)
+            {
+                _dense.reserve(count);
+                _data.reserve(count);
+            }
+
+            void clear()
+            {
+                _sparse.clear();
+                _dense.clear();
+                _data.clear();
+            }
+
+        protected:
+        private:
+            static constexpr std::uint32_t NONE = ~std::uint32_t(0);
+
+            std::vector<std::uint32_t> _sparse;     ///< Entity slot -> position in the dense arrays
+            std::vector<Entity> _dense;
+            std::vector<T> _data;
+    };
+}
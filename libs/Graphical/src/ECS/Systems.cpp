@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** Systems
+*/
+
+#include "Systems.hpp"
+
+namespace ecs
+{
+    void updateMovement(Registry &registry)
+    {
+        SparseSet<Position> &positions = registry.getPositions();
+        const std::vector<Entity> &movers = registry.getVelocities().getEntities();
+        const std::vector<Velocity> &velocities = registry.getVelocities().getData();
+
+        for (std::size_t i = 0; i < movers.size(); i++) {
+            Position *position = positions.tryGet(movers[i]);
+
+            if (!position)
+                continue;
+            position->value.x += velocities[i].value.x;
+            position->value.y += velocities[i].value.y;
+            position->value.z += velocities[i].value.z;
+        }
+    }
+
+    void updateAnimations(Registry &registry, float deltaTime)
+    {
+        SparseSet<Sprite> &sprites = registry.getSprites();
+        const std::vector<Entity> &animated = registry.getAnimations().getEntities();
+        std::vector<Animation> &animations = registry.getAnimations().getData();
+
+        for (std::size_t i = 0; i < animated.size(); i++) {
+            Animation &animation = animations[i];
+
+            if (!animation.set)
+                continue;
+            int clip = animation.set->pickClip(animation.moving, animation.jumping);
+            const Rectangle &frame = animation.set->play(clip, animation.clip, animation.time, deltaTime);
+            if (Sprite *sprite = sprites.tryGet(animated[i])) {
+                sprite->source.x = frame.x;
+                sprite->source.y = frame.y;
+            }
+        }
+    }
+}
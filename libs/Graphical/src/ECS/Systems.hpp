@@ -0,0 +1,26 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** Systems
+*/
+
+#pragma once
+
+#include "Registry.hpp"
+
+namespace ecs
+{
+    /**
+     * @brief Move every entity with a velocity and a position by one update
+     */
+    void updateMovement(Registry &registry);
+
+    /**
+     * @brief Play every animation for deltaTime more seconds and point its sprite at the frame
+     *
+     * Walks the packed animations in one pass. Each picks its jump, walk or
+     * idle clip from its flags, with the same stepping as objects::Character.
+     */
+    void updateAnimations(Registry &registry, float deltaTime);
+}
@@ -9,18 +9,21 @@
 
 #include <raymath.h>
 #include <algorithm>
+#include <cmath>
 
 using namespace objects;
 
-Character::Character(Asset2D asset) : AEntity(asset)
+Character::Character(Asset2D asset) : AEntity(asset), _animations(asset.getAnimations())
 {
+    showFirstFrame();
 }
 
-Character::Character(Asset2D asset, Vector3D position) : AEntity(asset, position)
+Character::Character(Asset2D asset, Vector3D position) : AEntity(asset, position), _animations(asset.getAnimations())
 {
+    showFirstFrame();
 }
 
-Character::Character(Asset2D asset, Vector3D position, Vector2D framePosition, Vector2D frameSize) : AEntity(asset, position)
+Character::Character(Asset2D asset, Vector3D position, Vector2D framePosition, Vector2D frameSize) : AEntity(asset, position), _animations(asset.getAnimations())
 {
     _box2D.setPosition(framePosition);
     _box2D.setSize(frameSize);
@@ -40,20 +43,36 @@ void Character::setMoving(bool moving)
     _isMoving = moving;
 }
 
-void Character::updateAnimation()
+void Character::setAnimations(std::shared_ptr<const AnimationSet> animations)
 {
-    if (_isMoving) {
-        _frameCounter += 1;
-        if (_frameCounter >= _frameSpeed) {
-            _frameCounter = 0;
-            _currentFrame = (_currentFrame + 1) % _totalFrames;
-        }
-        _box2D.setPosX(_currentFrame * _box2D.getSize().x);
-    } else {
-        _frameCounter = 0;
-        _currentFrame = 1;
-        _box2D.setPosX(0);
-    }
+    _animations = animations;
+    _clip = -1;
+    _clipTime = 0.0f;
+    showFirstFrame();
+}
+
+void Character::showFirstFrame()
+{
+    // The sheet may sit anywhere in an atlas, the frame cannot start at the origin
+    if (!_animations)
+        return;
+    const Rectangle &frame = _animations->getFrame(_animations->getIdleClip(), 0);
+    _box2D.setPosition({frame.x, frame.y});
+}
+
+const AnimationSet &Character::getAnimationSet()
+{
+    if (!_animations)
+        _animations = std::make_shared<const AnimationSet>(_box2D.getSize().convert(), _totalFrames);
+    return *_animations;
+}
+
+void Character::advanceAnimation(float deltaTime)
+{
+    const AnimationSet &animations = getAnimationSet();
+    const Rectangle &frame = animations.play(animations.pickClip(_isMoving, _isJumping), _clip, _clipTime, deltaTime);
+
+    _box2D.setPosition({frame.x, frame.y});
 }
 
 void Character::draw(Rectangle renderArea, std::shared_ptr<Render::Camera> camera)
@@ -87,3 +106,13 @@ void Character::draw(Vector3D tmp)
 
     DrawTextureRec(_asset2D.getTexture(), source, position, WHITE);
 }
+
+void Character::draw(Render::SpriteBatch &batch)
+{
+    batch.add(_asset2D.getTexture(), _box2D.getRectangle(), _box3D.getPosition().convert());
+}
+
+void Character::draw(Render::SpriteBatch &batch, Color tint, float spin)
+{
+    batch.add(_asset2D.getTexture(), _box2D.getRectangle(), _box3D.getPosition().convert(), tint, spin);
+}
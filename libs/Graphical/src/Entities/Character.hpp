@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include <memory>
+
 #include "../../includes/Objects/AEntity.hpp"
 #include "../Render/Camera.hpp"
+#include "../Render/SpriteBatch.hpp"
 
 namespace objects
 {
@@ -27,16 +30,42 @@ namespace objects
             int getTotalFrames() { return _totalFrames; };
             void setTotalFrames(int frames) { _totalFrames = frames; };
 
-            void updateAnimation();
+            /**
+             * @brief Play the jump, walk or idle clip for deltaTime more seconds
+             *
+             * Without a set from the asset, the character makes the default
+             * strip from its frame size and frame count the first time.
+             */
+            void advanceAnimation(float deltaTime);
+            void setAnimations(std::shared_ptr<const AnimationSet> animations);
+            std::shared_ptr<const AnimationSet> getAnimations() const { return _animations; };
+            /**
+             * @brief Clips played by advanceAnimation(), the default strip made on first use
+             */
+            const AnimationSet &getAnimationSet();
+            bool isJumping() const { return _isJumping; };
+            void setJumping(bool jumping) { _isJumping = jumping; };
+            int getClip() const { return _clip; };
 
             void draw() { AEntity::draw(); };
             void draw(Rectangle renderArea, std::shared_ptr<Render::Camera> camera);
             void draw(Vector3D tmp);
+            /**
+             * @brief Queue the current frame, standing on the character's position
+             */
+            void draw(Render::SpriteBatch &batch);
+            /**
+             * @brief Queue the current frame tinted and spun, see SpriteBatch::add
+             */
+            void draw(Render::SpriteBatch &batch, Color tint, float spin);
         protected:
+            void showFirstFrame();
+
             int _totalFrames = 1;
-            int _currentFrame = 0;
-            int _frameCounter = 0;
-            int _frameSpeed = 8;
             bool _isMoving = false;
+            bool _isJumping = false;
+            std::shared_ptr<const AnimationSet> _animations;
+            int _clip = -1;
+            float _clipTime = 0.0f;
     };
 }
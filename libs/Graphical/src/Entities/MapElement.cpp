@@ -7,6 +7,8 @@
 
 #include "MapElement.hpp"
 
+#include <raymath.h>
+
 using namespace objects;
 
 MapElement::MapElement(Asset3D asset3D) : AEntity()
@@ -85,3 +87,17 @@ void MapElement::draw()
 {
     DrawModel(_asset3D.getModel(), _box3D.getPosition().convert(), _asset3D.getScale(), WHITE);
 }
+
+void MapElement::draw(Quaternion rotation, Color tint)
+{
+    float scale = _asset3D.getScale();
+    Vector3 centre = Vector3Scale(_box3D.getSize().convert(), scale * 0.5f);
+    Vector3 axis = {0.0f, 1.0f, 0.0f};
+    float angle = 0.0f;
+
+    // DrawModelEx turns about the model origin, shift it so the centre stays put
+    Vector3 turned = Vector3RotateByQuaternion(centre, rotation);
+    Vector3 position = Vector3Add(_box3D.getPosition().convert(), Vector3Subtract(centre, turned));
+    QuaternionToAxisAngle(rotation, &axis, &angle);
+    DrawModelEx(_asset3D.getModel(), position, axis, angle * RAD2DEG, {scale, scale, scale}, tint);
+}
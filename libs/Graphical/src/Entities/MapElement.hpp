@@ -30,6 +30,12 @@ namespace objects
             void setAsset3D(Asset3D asset3D);
 
             void draw() override;
+            /**
+             * @brief Draw turned about the centre of the collision box, tinted
+             *
+             * The collision box is not turned, scripts rotate the look only.
+             */
+            void draw(Quaternion rotation, Color tint);
 
         protected:
             Asset3D _asset3D;
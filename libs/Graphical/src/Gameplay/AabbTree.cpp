@@ -0,0 +1,393 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** AabbTree
+*/
+
+#include "AabbTree.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    BoundingBox combine(const BoundingBox &a, const BoundingBox &b)
+    {
+        return {
+            {std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z)},
+            {std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z)}
+        };
+    }
+
+    float surfaceArea(const BoundingBox &box)
+    {
+        float x = box.max.x - box.min.x;
+        float y = box.max.y - box.min.y;
+        float z = box.max.z - box.min.z;
+        return 2.0f * (x * y + y * z + z * x);
+    }
+
+    bool contains(const BoundingBox &outer, const BoundingBox &inner)
+    {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+            inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+    }
+
+    bool overlap(const BoundingBox &a, const BoundingBox &b)
+    {
+        return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y &&
+            a.min.z <= b.max.z && b.min.z <= a.max.z;
+    }
+
+    float distanceSquared(Vector3 point, const BoundingBox &box)
+    {
+        float x = std::max({box.min.x - point.x, 0.0f, point.x - box.max.x});
+        float y = std::max({box.min.y - point.y, 0.0f, point.y - box.max.y});
+        float z = std::max({box.min.z - point.z, 0.0f, point.z - box.max.z});
+        return x * x + y * y + z * z;
+    }
+
+    /**
+     * @brief Slab test, entry distance or -1 on a miss
+     */
+    float rayEntry(const Ray &ray, const BoundingBox &box, float maxDistance)
+    {
+        const float origin[3] = {ray.position.x, ray.position.y, ray.position.z};
+        const float direction[3] = {ray.direction.x, ray.direction.y, ray.direction.z};
+        const float boxMin[3] = {box.min.x, box.min.y, box.min.z};
+        const float boxMax[3] = {box.max.x, box.max.y, box.max.z};
+        float entry = 0.0f;
+        float exit = maxDistance;
+
+        for (int axis = 0; axis < 3; axis++) {
+            if (std::fabs(direction[axis]) < 1e-9f) {
+                if (origin[axis] < boxMin[axis] || origin[axis] > boxMax[axis])
+                    return -1.0f;
+                continue;
+            }
+            float near = (boxMin[axis] - origin[axis]) / direction[axis];
+            float far = (boxMax[axis] - origin[axis]) / direction[axis];
+            if (near > far)
+                std::swap(near, far);
+            entry = std::max(entry, near);
+            exit = std::min(exit, far);
+            if (entry > exit)
+                return -1.0f;
+        }
+        return entry;
+    }
+}
+
+namespace gameplay
+{
+    AabbTree::AabbTree(float margin) : _margin(margin)
+    {
+    }
+
+    int AabbTree::insert(BoundingBox box, int userData)
+    {
+        int proxy = allocateNode();
+
+        _nodes[proxy].tight = box;
+        _nodes[proxy].box = fatten(box);
+        _nodes[proxy].userData = userData;
+        _nodes[proxy].height = 0;
+        insertLeaf(proxy);
+        _proxyCount++;
+        return proxy;
+    }
+
+    void AabbTree::remove(int proxy)
+    {
+        removeLeaf(proxy);
+        freeNode(proxy);
+        _proxyCount--;
+    }
+
+    bool AabbTree::update(int proxy, BoundingBox box)
+    {
+        _nodes[proxy].tight = box;
+        if (contains(_nodes[proxy].box, box))
+            return false;
+
+        removeLeaf(proxy);
+        _nodes[proxy].box = fatten(box);
+        insertLeaf(proxy);
+        return true;
+    }
+
+    void AabbTree::clear()
+    {
+        _nodes.clear();
+        _root = NULL_NODE;
+        _freeList = NULL_NODE;
+        _proxyCount = 0;
+    }
+
+    void AabbTree::queryBox(const BoundingBox &box, std::vector<int> &userData) const
+    {
+        if (_root == NULL_NODE)
+            return;
+
+        _stack.clear();
+        _stack.push_back(_root);
+        while (!_stack.empty()) {
+            const Node &node = _nodes[_stack.back()];
+            _stack.pop_back();
+            if (!overlap(node.box, box))
+                continue;
+            if (node.isLeaf()) {
+                if (overlap(node.tight, box))
+                    userData.push_back(node.userData);
+                continue;
+            }
+            _stack.push_back(node.child1);
+            _stack.push_back(node.child2);
+        }
+    }
+
+    void AabbTree::querySphere(Vector3 center, float radius, std::vector<int> &userData) const
+    {
+        if (_root == NULL_NODE)
+            return;
+
+        float radiusSquared = radius * radius;
+        _stack.clear();
+        _stack.push_back(_root);
+        while (!_stack.empty()) {
+            const Node &node = _nodes[_stack.back()];
+            _stack.pop_back();
+            if (distanceSquared(center, node.box) > radiusSquared)
+                continue;
+            if (node.isLeaf()) {
+                if (distanceSquared(center, node.tight) <= radiusSquared)
+                    userData.push_back(node.userData);
+                continue;
+            }
+            _stack.push_back(node.child1);
+            _stack.push_back(node.child2);
+        }
+    }
+
+    int AabbTree::raycast(Ray ray, float maxDistance, float &distance) const
+    {
+        int result = -1;
+        float nearest = maxDistance;
+
+        if (_root == NULL_NODE)
+            return result;
+
+        _stack.clear();
+        _stack.push_back(_root);
+        while (!_stack.empty()) {
+            const Node &node = _nodes[_stack.back()];
+            _stack.pop_back();
+            // Subtrees starting past the nearest hit cannot hold a nearer one
+            if (rayEntry(ray, node.box, nearest) < 0.0f)
+                continue;
+            if (node.isLeaf()) {
+                float entry = rayEntry(ray, node.tight, nearest);
+                if (entry >= 0.0f && (result == -1 || entry < nearest)) {
+                    nearest = entry;
+                    result = node.userData;
+                }
+                continue;
+            }
+            _stack.push_back(node.child1);
+            _stack.push_back(node.child2);
+        }
+        if (result != -1)
+            distance = nearest;
+        return result;
+    }
+
+    void AabbTree::queryPairs(std::vector<std::pair<int, int>> &pairs) const
+    {
+        if (_root == NULL_NODE)
+            return;
+
+        for (int leaf = 0; leaf < static_cast<int>(_nodes.size()); leaf++) {
+            if (_nodes[leaf].height != 0)
+                continue;
+            const BoundingBox &box = _nodes[leaf].tight;
+
+            _stack.clear();
+            _stack.push_back(_root);
+            while (!_stack.empty()) {
+                int index = _stack.back();
+                const Node &node = _nodes[index];
+                _stack.pop_back();
+                if (!overlap(node.box, box))
+                    continue;
+                if (node.isLeaf()) {
+                    // Each pair is found from both leaves, keep it from the lower one
+                    if (index > leaf && overlap(node.tight, box))
+                        pairs.emplace_back(_nodes[leaf].userData, node.userData);
+                    continue;
+                }
+                _stack.push_back(node.child1);
+                _stack.push_back(node.child2);
+            }
+        }
+    }
+
+    int AabbTree::allocateNode()
+    {
+        if (_freeList == NULL_NODE) {
+            _nodes.emplace_back();
+            return static_cast<int>(_nodes.size() - 1);
+        }
+        int node = _freeList;
+        _freeList = _nodes[node].parent;
+        _nodes[node] = Node();
+        return node;
+    }
+
+    void AabbTree::freeNode(int node)
+    {
+        _nodes[node].parent = _freeList;
+        _nodes[node].height = -1;
+        _freeList = node;
+    }
+
+    void AabbTree::insertLeaf(int leaf)
+    {
+        if (_root == NULL_NODE) {
+            _root = leaf;
+            _nodes[leaf].parent = NULL_NODE;
+            return;
+        }
+
+        // Walk down towards the sibling whose enlargement costs the least
+        BoundingBox leafBox = _nodes[leaf].box;
+        int index = _root;
+        while (!_nodes[index].isLeaf()) {
+            const Node &node = _nodes[index];
+            float combinedArea = surfaceArea(combine(node.box, leafBox));
+            float cost = 2.0f * combinedArea;
+            float inheritance = 2.0f * (combinedArea - surfaceArea(node.box));
+
+            float childCosts[2];
+            int children[2] = {node.child1, node.child2};
+            for (int i = 0; i < 2; i++) {
+                const Node &child = _nodes[children[i]];
+                float enlarged = surfaceArea(combine(child.box, leafBox));
+                childCosts[i] = (child.isLeaf() ? enlarged : enlarged - surfaceArea(child.box)) + inheritance;
+            }
+            if (cost < childCosts[0] && cost < childCosts[1])
+                break;
+            index = childCosts[0] < childCosts[1] ? children[0] : children[1];
+        }
+
+        int sibling = index;
+        int oldParent = _nodes[sibling].parent;
+        int newParent = allocateNode();
+        _nodes[newParent].parent = oldParent;
+        _nodes[newParent].box = combine(leafBox, _nodes[sibling].box);
+        _nodes[newParent].height = _nodes[sibling].height + 1;
+        _nodes[newParent].child1 = sibling;
+        _nodes[newParent].child2 = leaf;
+        _nodes[sibling].parent = newParent;
+        _nodes[leaf].parent = newParent;
+        if (oldParent == NULL_NODE) {
+            _root = newParent;
+        } else if (_nodes[oldParent].child1 == sibling) {
+            _nodes[oldParent].child1 = newParent;
+        } else {
+            _nodes[oldParent].child2 = newParent;
+        }
+
+        for (index = _nodes[leaf].parent; index != NULL_NODE; index = _nodes[index].parent) {
+            index = balance(index);
+            refit(index);
+        }
+    }
+
+    void AabbTree::removeLeaf(int leaf)
+    {
+        if (leaf == _root) {
+            _root = NULL_NODE;
+            return;
+        }
+
+        int parent = _nodes[leaf].parent;
+        int grandParent = _nodes[parent].parent;
+        int sibling = _nodes[parent].child1 == leaf ? _nodes[parent].child2 : _nodes[parent].child1;
+
+        freeNode(parent);
+        if (grandParent == NULL_NODE) {
+            _root = sibling;
+            _nodes[sibling].parent = NULL_NODE;
+            return;
+        }
+        if (_nodes[grandParent].child1 == parent)
+            _nodes[grandParent].child1 = sibling;
+        else
+            _nodes[grandParent].child2 = sibling;
+        _nodes[sibling].parent = grandParent;
+
+        for (int index = grandParent; index != NULL_NODE; index = _nodes[index].parent) {
+            index = balance(index);
+            refit(index);
+        }
+    }
+
+    int AabbTree::balance(int nodeA)
+    {
+        Node &a = _nodes[nodeA];
+        if (a.isLeaf() || a.height < 2)
+            return nodeA;
+
+        int nodeB = a.child1;
+        int nodeC = a.child2;
+        Node &b = _nodes[nodeB];
+        Node &c = _nodes[nodeC];
+        int difference = c.height - b.height;
+        if (difference >= -1 && difference <= 1)
+            return nodeA;
+
+        // Rotate the taller child up into A's place, A takes its shorter grandchild
+        int up = difference > 1 ? nodeC : nodeB;
+        int kept = difference > 1 ? nodeB : nodeC;
+        Node &u = _nodes[up];
+        int tallGrandChild = _nodes[u.child1].height > _nodes[u.child2].height ? u.child1 : u.child2;
+        int shortGrandChild = tallGrandChild == u.child1 ? u.child2 : u.child1;
+
+        u.child1 = nodeA;
+        u.child2 = tallGrandChild;
+        u.parent = a.parent;
+        a.parent = up;
+        if (u.parent == NULL_NODE)
+            _root = up;
+        else if (_nodes[u.parent].child1 == nodeA)
+            _nodes[u.parent].child1 = up;
+        else
+            _nodes[u.parent].child2 = up;
+
+        a.child1 = kept;
+        a.child2 = shortGrandChild;
+        _nodes[shortGrandChild].parent = nodeA;
+        refit(nodeA);
+        refit(up);
+        return up;
+    }
+
+    void AabbTree::refit(int node)
+    {
+        Node &n = _nodes[node];
+        const Node &child1 = _nodes[n.child1];
+        const Node &child2 = _nodes[n.child2];
+
+        n.box = combine(child1.box, child2.box);
+        n.height = 1 + std::max(child1.height, child2.height);
+    }
+
+    BoundingBox AabbTree::fatten(const BoundingBox &box) const
+    {
+        return {
+            {box.min.x - _margin, box.min.y - _margin, box.min.z - _margin},
+            {box.max.x + _margin, box.max.y + _margin, box.max.z + _margin}
+        };
+    }
+}
@@ -0,0 +1,109 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** AabbTree
+*/
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "raylib.h"
+
+namespace gameplay
+{
+    /**
+     * @brief Dynamic bounding volume tree over moving boxes
+     *
+     * Leaves keep a fattened copy of their box, so small moves only update
+     * the tight box and the tree is touched when a box leaves its margin.
+     * Inserts pick the sibling with the lowest surface area cost and rotations
+     * keep the tree balanced, so queries visit O(log n) nodes.
+     *
+     * Queries reuse an internal stack: one tree must not be queried from
+     * several threads at once.
+     */
+    class AabbTree
+    {
+        public:
+            static constexpr int NULL_NODE = -1;
+
+            explicit AabbTree(float margin = 0.1f);
+            ~AabbTree() = default;
+
+            /**
+             * @return Proxy ID used to update or remove the box
+             */
+            int insert(BoundingBox box, int userData);
+            void remove(int proxy);
+
+            /**
+             * @brief Move a proxy's box
+             *
+             * @return true if the box left its fat box and was reinserted
+             */
+            bool update(int proxy, BoundingBox box);
+            void clear();
+
+            int getUserData(int proxy) const { return _nodes[proxy].userData; };
+            const BoundingBox &getBox(int proxy) const { return _nodes[proxy].tight; };
+            const BoundingBox &getFatBox(int proxy) const { return _nodes[proxy].box; };
+            std::size_t getProxyCount() const { return _proxyCount; };
+            int getHeight() const { return _root == NULL_NODE ? 0 : _nodes[_root].height; };
+
+            /**
+             * @brief User data of every box overlapping a box
+             */
+            void queryBox(const BoundingBox &box, std::vector<int> &userData) const;
+
+            /**
+             * @brief User data of every box within radius of a point
+             */
+            void querySphere(Vector3 center, float radius, std::vector<int> &userData) const;
+
+            /**
+             * @brief Nearest box hit by a ray
+             *
+             * @param distance Set to the hit distance along the ray direction
+             * @return The hit box's user data, or -1 if none within maxDistance
+             */
+            int raycast(Ray ray, float maxDistance, float &distance) const;
+
+            /**
+             * @brief User data of every pair of overlapping boxes, each pair once
+             */
+            void queryPairs(std::vector<std::pair<int, int>> &pairs) const;
+
+        protected:
+        private:
+            struct Node {
+                BoundingBox box = {};       ///< Fat box for leaves, union of the children otherwise
+                BoundingBox tight = {};     ///< Box given by the user, leaves only
+                int parent = NULL_NODE;     ///< Next free node while on the free list
+                int child1 = NULL_NODE;
+                int child2 = NULL_NODE;
+                int height = -1;            ///< 0 for leaves, -1 for free nodes
+                int userData = -1;
+
+                bool isLeaf() const { return child1 == NULL_NODE; };
+            };
+
+            int allocateNode();
+            void freeNode(int node);
+            void insertLeaf(int leaf);
+            void removeLeaf(int leaf);
+            int balance(int node);
+            void refit(int node);
+            BoundingBox fatten(const BoundingBox &box) const;
+
+            std::vector<Node> _nodes;
+            int _root = NULL_NODE;
+            int _freeList = NULL_NODE;
+            std::size_t _proxyCount = 0;
+            float _margin;
+
+            mutable std::vector<int> _stack;    ///< Traversal stack shared by the queries
+    };
+}
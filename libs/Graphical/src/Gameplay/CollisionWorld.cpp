@@ -0,0 +1,258 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** CollisionWorld
+*/
+
+#include "CollisionWorld.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr float GROUND_PROBE = 0.01f;    ///< How far below a box the ground may be and still hold it
+
+    float &component(Vector3 &vector, int axis)
+    {
+        return axis == 0 ? vector.x : (axis == 1 ? vector.y : vector.z);
+    }
+
+    float component(const Vector3 &vector, int axis)
+    {
+        return axis == 0 ? vector.x : (axis == 1 ? vector.y : vector.z);
+    }
+
+    void translate(BoundingBox &box, int axis, float distance)
+    {
+        component(box.min, axis) += distance;
+        component(box.max, axis) += distance;
+    }
+
+    /**
+     * @brief Call visit(x, y, z) for every unit cell a solid is hashed in
+     *
+     * Faces on a cell boundary belong to the cell they enclose only.
+     */
+    template <typename Visit>
+    void forEachCell(const BoundingBox &box, float epsilon, Visit visit)
+    {
+        for (int x = static_cast<int>(std::floor(box.min.x)); x <= static_cast<int>(std::floor(box.max.x - epsilon)); x++)
+            for (int y = static_cast<int>(std::floor(box.min.y)); y <= static_cast<int>(std::floor(box.max.y - epsilon)); y++)
+                for (int z = static_cast<int>(std::floor(box.min.z)); z <= static_cast<int>(std::floor(box.max.z - epsilon)); z++)
+                    visit(x, y, z);
+    }
+}
+
+namespace gameplay
+{
+    void CollisionWorld::clear()
+    {
+        _solids.clear();
+        _cells.clear();
+        _candidates.clear();
+        _visitedStamp.clear();
+        _stamp = 0;
+    }
+
+    void CollisionWorld::addSolid(BoundingBox box)
+    {
+        std::uint32_t index = static_cast<std::uint32_t>(_solids.size());
+
+        _solids.push_back(box);
+        _visitedStamp.push_back(0);
+        insertCells(index);
+    }
+
+    void CollisionWorld::moveSolid(std::size_t index, BoundingBox box)
+    {
+        std::uint32_t solid = static_cast<std::uint32_t>(index);
+
+        if (index >= _solids.size())
+            return;
+        eraseCells(solid);
+        _solids[index] = box;
+        insertCells(solid);
+    }
+
+    void CollisionWorld::insertCells(std::uint32_t index)
+    {
+        forEachCell(_solids[index], CONTACT_EPSILON, [this, index](int x, int y, int z) {
+            _cells[cellKey(x, y, z)].push_back(index);
+        });
+    }
+
+    void CollisionWorld::eraseCells(std::uint32_t index)
+    {
+        forEachCell(_solids[index], CONTACT_EPSILON, [this, index](int x, int y, int z) {
+            auto cell = _cells.find(cellKey(x, y, z));
+            if (cell == _cells.end())
+                return;
+            // Order within a cell does not matter, swap the solid out
+            std::vector<std::uint32_t> &solids = cell->second;
+            auto found = std::find(solids.begin(), solids.end(), index);
+            if (found != solids.end()) {
+                *found = solids.back();
+                solids.pop_back();
+            }
+            if (solids.empty())
+                _cells.erase(cell);
+        });
+    }
+
+    MoveResult CollisionWorld::move(BoundingBox &box, Vector3 delta, float stepHeight)
+    {
+        MoveResult result;
+        bool wasGrounded = stepHeight > 0.0f && (delta.x != 0.0f || delta.z != 0.0f) && isGrounded(box);
+
+        // Vertical first, so a landing box slides on the floor it reached this tick
+        float moved = sweepAxis(box, 1, delta.y);
+        translate(box, 1, moved);
+        result.moved.y = moved;
+        if (moved != delta.y) {
+            result.normal.y = delta.y < 0.0f ? 1.0f : -1.0f;
+            result.timeOfImpact = std::min(result.timeOfImpact, moved / delta.y);
+            result.grounded = delta.y < 0.0f;
+        }
+
+        for (int axis : {0, 2}) {
+            float distance = component(delta, axis);
+            if (distance == 0.0f)
+                continue;
+
+            moved = sweepAxis(box, axis, distance);
+            if (moved != distance && (wasGrounded || result.grounded)) {
+                // Retry the move from above the ledge, then settle back down on it
+                BoundingBox raised = box;
+                float up = sweepAxis(raised, 1, stepHeight);
+                translate(raised, 1, up);
+                float raisedMoved = sweepAxis(raised, axis, distance);
+                if (std::fabs(raisedMoved) > std::fabs(moved) + CONTACT_EPSILON) {
+                    translate(raised, axis, raisedMoved);
+                    float down = sweepAxis(raised, 1, -up);
+                    translate(raised, 1, down);
+                    box = raised;
+                    result.moved.y += up + down;
+                    result.steppedUp = true;
+                    moved = raisedMoved;
+                } else {
+                    translate(box, axis, moved);
+                }
+            } else {
+                translate(box, axis, moved);
+            }
+            component(result.moved, axis) = moved;
+            if (moved != distance) {
+                component(result.normal, axis) = distance > 0.0f ? -1.0f : 1.0f;
+                result.timeOfImpact = std::min(result.timeOfImpact, moved / distance);
+            }
+        }
+
+        if (!result.grounded && delta.y <= 0.0f)
+            result.grounded = isGrounded(box);
+        return result;
+    }
+
+    bool CollisionWorld::isGrounded(const BoundingBox &box)
+    {
+        return sweepAxis(box, 1, -GROUND_PROBE) > -GROUND_PROBE;
+    }
+
+    bool CollisionWorld::overlaps(const BoundingBox &box)
+    {
+        gatherCandidates(box);
+        for (std::uint32_t index : _candidates) {
+            const BoundingBox &solid = _solids[index];
+            bool separated = false;
+
+            for (int axis = 0; axis < 3 && !separated; axis++) {
+                separated = component(box.max, axis) <= component(solid.min, axis) + CONTACT_EPSILON ||
+                    component(box.min, axis) >= component(solid.max, axis) - CONTACT_EPSILON;
+            }
+            if (!separated)
+                return true;
+        }
+        return false;
+    }
+
+    float CollisionWorld::sweepAxis(const BoundingBox &box, int axis, float distance)
+    {
+        if (distance == 0.0f)
+            return 0.0f;
+
+        BoundingBox swept = box;
+        if (distance > 0.0f)
+            component(swept.max, axis) += distance;
+        else
+            component(swept.min, axis) += distance;
+        gatherCandidates(swept);
+
+        float allowed = distance;
+        for (std::uint32_t index : _candidates) {
+            const BoundingBox &solid = _solids[index];
+            bool besides = false;
+
+            for (int other = 0; other < 3 && !besides; other++) {
+                if (other == axis)
+                    continue;
+                besides = component(box.max, other) <= component(solid.min, other) + CONTACT_EPSILON ||
+                    component(box.min, other) >= component(solid.max, other) - CONTACT_EPSILON;
+            }
+            if (besides)
+                continue;
+            // Solids the box already overlaps along this axis never block it
+            if (distance > 0.0f && component(solid.min, axis) >= component(box.max, axis) - CONTACT_EPSILON)
+                allowed = std::min(allowed, std::max(0.0f, component(solid.min, axis) - component(box.max, axis)));
+            else if (distance < 0.0f && component(solid.max, axis) <= component(box.min, axis) + CONTACT_EPSILON)
+                allowed = std::max(allowed, std::min(0.0f, component(solid.max, axis) - component(box.min, axis)));
+        }
+        return allowed;
+    }
+
+    void CollisionWorld::gatherCandidates(const BoundingBox &area)
+    {
+        _candidates.clear();
+        if (++_stamp == 0) {
+            std::fill(_visitedStamp.begin(), _visitedStamp.end(), 0);
+            _stamp = 1;
+        }
+
+        int minX = static_cast<int>(std::floor(area.min.x - CONTACT_EPSILON));
+        int minY = static_cast<int>(std::floor(area.min.y - CONTACT_EPSILON));
+        int minZ = static_cast<int>(std::floor(area.min.z - CONTACT_EPSILON));
+        int maxX = static_cast<int>(std::floor(area.max.x + CONTACT_EPSILON));
+        int maxY = static_cast<int>(std::floor(area.max.y + CONTACT_EPSILON));
+        int maxZ = static_cast<int>(std::floor(area.max.z + CONTACT_EPSILON));
+        double cellCount = double(maxX - minX + 1) * double(maxY - minY + 1) * double(maxZ - minZ + 1);
+
+        // A huge query is cheaper as a plain scan than as a walk over empty cells
+        if (cellCount > static_cast<double>(_solids.size())) {
+            for (std::uint32_t index = 0; index < _solids.size(); index++)
+                _candidates.push_back(index);
+            return;
+        }
+        for (int x = minX; x <= maxX; x++) {
+            for (int y = minY; y <= maxY; y++) {
+                for (int z = minZ; z <= maxZ; z++) {
+                    auto cell = _cells.find(cellKey(x, y, z));
+                    if (cell == _cells.end())
+                        continue;
+                    for (std::uint32_t index : cell->second) {
+                        if (_visitedStamp[index] == _stamp)
+                            continue;
+                        _visitedStamp[index] = _stamp;
+                        _candidates.push_back(index);
+                    }
+                }
+            }
+        }
+    }
+
+    std::int64_t CollisionWorld::cellKey(int x, int y, int z)
+    {
+        // 21 bits per axis, enough for maps a million blocks wide
+        const std::int64_t mask = (std::int64_t(1) << 21) - 1;
+        return ((std::int64_t(x) & mask) << 42) | ((std::int64_t(y) & mask) << 21) | (std::int64_t(z) & mask);
+    }
+}
@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** CollisionWorld
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+
+namespace gameplay
+{
+    /**
+     * @brief Outcome of moving a box through the world
+     */
+    struct MoveResult {
+        Vector3 moved = {0.0f, 0.0f, 0.0f};         ///< Displacement actually applied
+        Vector3 normal = {0.0f, 0.0f, 0.0f};        ///< One component per blocked axis, pointing away from the surface hit
+        float timeOfImpact = 1.0f;                  ///< Fraction of the requested move done before the first hit
+        bool grounded = false;                      ///< Resting on a surface after the move
+        bool steppedUp = false;                     ///< A ledge lower than the step height was climbed
+    };
+
+    /**
+     * @brief Static solid boxes, bucketed in a spatial hash of unit cells
+     *
+     * Moving boxes are swept one axis at a time (vertical first) against the
+     * solids found in the cells they cross, so a move never tunnels through a
+     * block and a query only looks at its neighbourhood, whatever the map size.
+     * Boxes already overlapping a solid are free to move out of it.
+     */
+    class CollisionWorld
+    {
+        public:
+            CollisionWorld() = default;
+            ~CollisionWorld() = default;
+
+            void clear();
+            void addSolid(BoundingBox box);
+            /**
+             * @brief Put a solid somewhere else, rehashing only the cells it leaves and enters
+             *
+             * @param index Order in which the solid was added
+             */
+            void moveSolid(std::size_t index, BoundingBox box);
+            std::size_t getSolidCount() const { return _solids.size(); };
+            const BoundingBox &getSolid(std::size_t index) const { return _solids[index]; };
+
+            /**
+             * @brief Move a box as far as the solids allow
+             *
+             * @param box Box to move, updated to its final place
+             * @param delta Requested displacement
+             * @param stepHeight Ledges up to this height are climbed by horizontal moves
+             *                   of a grounded box, 0 to disable
+             */
+            MoveResult move(BoundingBox &box, Vector3 delta, float stepHeight = 0.0f);
+
+            /**
+             * @brief Whether a surface lies right under the box
+             */
+            bool isGrounded(const BoundingBox &box);
+
+            /**
+             * @brief Whether the box overlaps any solid
+             */
+            bool overlaps(const BoundingBox &box);
+
+        protected:
+        private:
+            static constexpr float CONTACT_EPSILON = 0.0001f;
+
+            /**
+             * @brief Distance the box can travel along one axis, at most distance
+             */
+            float sweepAxis(const BoundingBox &box, int axis, float distance);
+            void gatherCandidates(const BoundingBox &area);
+            void insertCells(std::uint32_t index);
+            void eraseCells(std::uint32_t index);
+            static std::int64_t cellKey(int x, int y, int z);
+
+            std::vector<BoundingBox> _solids;
+            std::unordered_map<std::int64_t, std::vector<std::uint32_t>> _cells;   ///< Unit cell -> solids touching it
+
+            std::vector<std::uint32_t> _candidates;             ///< Solids near the current query
+            std::vector<std::uint32_t> _visitedStamp;           ///< Query stamp per solid, dedups solids spanning cells
+            std::uint32_t _stamp = 0;
+    };
+}
@@ -0,0 +1,282 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** FlowField
+*/
+
+#include "FlowField.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace
+{
+    constexpr float UNREACHED = std::numeric_limits<float>::infinity();
+    constexpr float EPSILON = 0.0001f;
+}
+
+namespace gameplay
+{
+    FlowField::FlowField(std::size_t budget) : _budget(budget)
+    {
+    }
+
+    void FlowField::setGoal(const NavGrid &grid, Vector3 goal)
+    {
+        if (grid.getVersion() != _gridVersion)
+            follow(grid);
+
+        int node = grid.findNode(goal);
+        if (node == -1)
+            return;
+        if (_pendingGoal != -1) {
+            _queuedGoal = node == _pendingGoal ? -1 : node;
+            return;
+        }
+        if (node != _goal || !isReady())
+            startIntegration(node);
+    }
+
+    bool FlowField::update(const NavGrid &grid)
+    {
+        if (grid.getVersion() != _gridVersion)
+            follow(grid);
+
+        auto compare = std::greater<std::pair<float, int>>();
+        std::size_t expanded = 0;
+
+        while (_pendingGoal != -1 && expanded < _budget) {
+            if (_open.empty()) {
+                // Integration done, publish it and start on the goal queued meanwhile
+                _cost.swap(_pendingCost);
+                _next.swap(_pendingNext);
+                _goal = _pendingGoal;
+                _version = _gridVersion;
+                _pendingGoal = -1;
+                // The grid changed under the integration, it may have to run again
+                bool exact = repair(grid, _changedChunks);
+                if (_queuedGoal != -1 && _queuedGoal != _goal)
+                    startIntegration(_queuedGoal);
+                else if (!exact)
+                    startIntegration(_goal);
+                _queuedGoal = -1;
+                continue;
+            }
+
+            std::pop_heap(_open.begin(), _open.end(), compare);
+            float cost = _open.back().first;
+            int node = _open.back().second;
+            _open.pop_back();
+            if (cost > _pendingCost[node])
+                continue;
+            expanded++;
+            for (std::uint32_t edge = _reverseStart[node]; edge < _reverseStart[node + 1]; edge++) {
+                int source = _reverseSource[edge];
+                float sourceCost = cost + _reverseCost[edge];
+                if (sourceCost >= _pendingCost[source])
+                    continue;
+                _pendingCost[source] = sourceCost;
+                _pendingNext[source] = node;
+                _open.emplace_back(sourceCost, source);
+                std::push_heap(_open.begin(), _open.end(), compare);
+            }
+        }
+        return _pendingGoal == -1 && isReady();
+    }
+
+    bool FlowField::getNextWaypoint(const NavGrid &grid, Vector3 position, Vector3 &waypoint) const
+    {
+        if (!isReady() || grid.getVersion() != _version)
+            return false;
+
+        int node = grid.findNode(position);
+        if (node == -1 || node == _goal || _next[node] == -1)
+            return false;
+        waypoint = grid.getNodePosition(_next[node]);
+        return true;
+    }
+
+    float FlowField::getCost(int node) const
+    {
+        if (!isReady() || node < 0 || node >= static_cast<int>(_cost.size()))
+            return UNREACHED;
+        return _cost[node];
+    }
+
+    void FlowField::clear()
+    {
+        _gridVersion = 0;
+        _version = 0;
+        _reverseStart.clear();
+        _reverseSource.clear();
+        _reverseCost.clear();
+        _goal = -1;
+        _cost.clear();
+        _next.clear();
+        _pendingGoal = -1;
+        _queuedGoal = -1;
+        _pendingCost.clear();
+        _pendingNext.clear();
+        _open.clear();
+        _changedChunks.clear();
+    }
+
+    void FlowField::reset(const NavGrid &grid)
+    {
+        clear();
+        _gridVersion = grid.getVersion();
+        buildReverseEdges(grid);
+        _open.reserve(grid.getNodeCount());
+    }
+
+    void FlowField::follow(const NavGrid &grid)
+    {
+        const std::vector<int> &renumbering = grid.getRenumbering();
+        std::size_t oldCount = _reverseStart.empty() ? 0 : _reverseStart.size() - 1;
+
+        // The renumbering only describes the last build
+        if (_reverseStart.empty() || grid.getVersion() != _gridVersion + 1 || renumbering.size() != oldCount) {
+            reset(grid);
+            return;
+        }
+        _gridVersion = grid.getVersion();
+        buildReverseEdges(grid);
+        std::size_t nodeCount = grid.getNodeCount();
+        const std::vector<bool> &changed = grid.getChangedChunks();
+        auto renumbered = [&renumbering](int node) { return node == -1 ? -1 : renumbering[node]; };
+
+        // The complete field stays in use, minus the nodes of the changed columns
+        bool exact = true;
+        if (!_cost.empty()) {
+            exact = renumber(renumbering, nodeCount, _cost, _next);
+            _goal = renumbered(_goal);
+            _version = _gridVersion;
+            exact = repair(grid, changed) && exact && _goal != -1;
+        }
+        _queuedGoal = renumbered(_queuedGoal);
+
+        if (_pendingGoal == -1) {
+            if (!exact && _goal != -1)
+                startIntegration(_goal);
+            return;
+        }
+        _pendingGoal = renumbered(_pendingGoal);
+        if (_pendingGoal == -1) {
+            int goal = _queuedGoal != -1 ? _queuedGoal : _goal;
+            _queuedGoal = -1;
+            if (goal != -1)
+                startIntegration(goal);
+            return;
+        }
+
+        // The integration under way goes on: its frontier, and what it reached in the changed chunks, are expanded again
+        renumber(renumbering, nodeCount, _pendingCost, _pendingNext);
+        std::size_t kept = 0;
+        for (const auto &entry : _open) {
+            int node = renumbering[entry.second];
+            if (node != -1)
+                _open[kept++] = {entry.first, node};
+        }
+        _open.resize(kept);
+        if (_changedChunks.size() != changed.size())
+            _changedChunks.assign(changed.size(), false);
+        for (std::size_t node = 0; node < nodeCount; node++) {
+            int chunk = grid.getChunk(static_cast<int>(node));
+            if (!changed[chunk])
+                continue;
+            _changedChunks[chunk] = true;
+            if (_pendingCost[node] != UNREACHED)
+                _open.emplace_back(_pendingCost[node], static_cast<int>(node));
+        }
+        std::make_heap(_open.begin(), _open.end(), std::greater<std::pair<float, int>>());
+    }
+
+    bool FlowField::renumber(const std::vector<int> &renumbering, std::size_t nodeCount, std::vector<float> &cost, std::vector<int> &next)
+    {
+        bool kept = true;
+
+        _renumberedCost.assign(nodeCount, UNREACHED);
+        _renumberedNext.assign(nodeCount, -1);
+        for (std::size_t node = 0; node < renumbering.size(); node++) {
+            int target = renumbering[node];
+            if (target == -1) {
+                kept = kept && cost[node] == UNREACHED;
+                continue;
+            }
+            _renumberedCost[target] = cost[node];
+            _renumberedNext[target] = next[node] == -1 ? -1 : renumbering[next[node]];
+        }
+        cost.swap(_renumberedCost);
+        next.swap(_renumberedNext);
+        return kept;
+    }
+
+    bool FlowField::repair(const NavGrid &grid, const std::vector<bool> &chunks)
+    {
+        bool exact = true;
+
+        if (chunks.empty())
+            return true;
+        for (int node = 0; node < static_cast<int>(_cost.size()); node++) {
+            if (!chunks[grid.getChunk(node)])
+                continue;
+            float cost = _cost[node];
+            bool stepFound = false;
+            for (std::uint32_t edge = grid.getEdgeBegin(node); edge < grid.getEdgeEnd(node); edge++) {
+                int target = grid.getEdgeTarget(edge);
+                float through = grid.getEdgeCost(edge) + _cost[target];
+                // A shorter way, or a way at all from a node the field did not reach
+                if (through < cost - EPSILON)
+                    exact = false;
+                if (target == _next[node] && std::fabs(through - cost) <= EPSILON)
+                    stepFound = true;
+            }
+            if (_next[node] != -1 && !stepFound) {
+                _next[node] = -1;
+                exact = false;
+            } else if (_next[node] == -1 && cost != UNREACHED && node != _goal) {
+                exact = false;
+            }
+        }
+        return exact;
+    }
+
+    void FlowField::buildReverseEdges(const NavGrid &grid)
+    {
+        int nodeCount = static_cast<int>(grid.getNodeCount());
+
+        _reverseStart.assign(nodeCount + 1, 0);
+        for (std::uint32_t edge = 0; edge < grid.getEdgeCount(); edge++)
+            _reverseStart[grid.getEdgeTarget(edge) + 1]++;
+        for (int node = 0; node < nodeCount; node++)
+            _reverseStart[node + 1] += _reverseStart[node];
+
+        std::vector<std::uint32_t> fill(_reverseStart.begin(), _reverseStart.end() - 1);
+        _reverseSource.resize(grid.getEdgeCount());
+        _reverseCost.resize(grid.getEdgeCount());
+        for (int node = 0; node < nodeCount; node++) {
+            for (std::uint32_t edge = grid.getEdgeBegin(node); edge < grid.getEdgeEnd(node); edge++) {
+                std::uint32_t slot = fill[grid.getEdgeTarget(edge)]++;
+                _reverseSource[slot] = node;
+                _reverseCost[slot] = grid.getEdgeCost(edge);
+            }
+        }
+    }
+
+    void FlowField::startIntegration(int goal)
+    {
+        std::size_t nodeCount = _reverseStart.size() - 1;
+
+        // Both buffers keep their capacity once the first fields were made
+        _pendingCost.assign(nodeCount, UNREACHED);
+        _pendingNext.assign(nodeCount, -1);
+        _pendingGoal = goal;
+        _pendingCost[goal] = 0.0f;
+        _changedChunks.clear();
+        _open.clear();
+        _open.emplace_back(0.0f, goal);
+    }
+}
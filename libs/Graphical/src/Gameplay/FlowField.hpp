@@ -0,0 +1,126 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** FlowField
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "NavGrid.hpp"
+
+namespace gameplay
+{
+    /**
+     * @brief Shortest way to one goal from every NavGrid node
+     *
+     * The integration field is the cost of reaching the goal from each node,
+     * found by a Dijkstra search walking the edges backwards from the goal.
+     * The direction field keeps, per node, the neighbour to walk to next.
+     * Any number of characters heading for the goal share the field and
+     * steer with one lookup each.
+     *
+     * A new integration starts when the goal moves to another node. It runs
+     * over several update() calls, at most budget nodes each. Until it ends,
+     * lookups keep using the last complete field. A goal changing again in
+     * the meantime is queued, not restarted, so a moving goal never starves
+     * the field.
+     *
+     * A grid rebuilt in place carries both fields over through its node
+     * renumbering. The complete field is integrated again only when a
+     * changed chunk may change one of its costs, and stays in use until then.
+     * An integration under way goes on over the new grid, and is checked
+     * against the chunks changed meanwhile once it ends. Any other grid
+     * change drops both fields.
+     */
+    class FlowField
+    {
+        public:
+            static constexpr std::size_t DEFAULT_BUDGET = 8192;        ///< Nodes per update, about 2.5 ms on a 256x256 map
+
+            explicit FlowField(std::size_t budget = DEFAULT_BUDGET);
+            ~FlowField() = default;
+
+            /**
+             * @brief Aim the field at the surface under goal
+             */
+            void setGoal(const NavGrid &grid, Vector3 goal);
+
+            /**
+             * @brief Go on with the pending integration
+             *
+             * @return true when the field matches the goal set last
+             */
+            bool update(const NavGrid &grid);
+
+            /**
+             * @brief Centre of the node to walk to from position
+             *
+             * @return false at the goal, off the surfaces or with no way to the goal
+             */
+            bool getNextWaypoint(const NavGrid &grid, Vector3 position, Vector3 &waypoint) const;
+
+            /**
+             * @brief Cost of reaching the goal from a node, infinite when there is no way
+             */
+            float getCost(int node) const;
+
+            bool isReady() const { return _version == _gridVersion && !_cost.empty(); };
+            int getGoal() const { return _goal; };
+            void clear();
+
+        protected:
+        private:
+            void reset(const NavGrid &grid);
+            /**
+             * @brief Carry the fields over to the grid's new build, or reset
+             */
+            void follow(const NavGrid &grid);
+            /**
+             * @brief Move a field's entries to the new node numbers
+             *
+             * @return false when a node leading to the goal was dropped
+             */
+            bool renumber(const std::vector<int> &renumbering, std::size_t nodeCount, std::vector<float> &cost, std::vector<int> &next);
+            /**
+             * @brief Check the complete field over the given chunks
+             *
+             * Steps along edges that no longer exist are dropped.
+             *
+             * @return false when a cost may have changed: the field has to be integrated again
+             */
+            bool repair(const NavGrid &grid, const std::vector<bool> &chunks);
+            void buildReverseEdges(const NavGrid &grid);
+            void startIntegration(int goal);
+
+            std::size_t _budget;
+            std::uint32_t _gridVersion = 0;     ///< Grid the edges and fields were made for
+            std::uint32_t _version = 0;         ///< Grid the complete field was made for
+
+            // Edges reversed, so the search can walk from the goal
+            std::vector<std::uint32_t> _reverseStart;
+            std::vector<int> _reverseSource;
+            std::vector<float> _reverseCost;
+
+            // Complete field, read by the lookups
+            int _goal = -1;
+            std::vector<float> _cost;
+            std::vector<int> _next;
+
+            // Field being integrated
+            int _pendingGoal = -1;
+            int _queuedGoal = -1;
+            std::vector<float> _pendingCost;
+            std::vector<int> _pendingNext;
+            std::vector<std::pair<float, int>> _open;
+            std::vector<bool> _changedChunks;           ///< Chunks rebuilt since the integration started
+
+            // Scratch for renumbering
+            std::vector<float> _renumberedCost;
+            std::vector<int> _renumberedNext;
+    };
+}
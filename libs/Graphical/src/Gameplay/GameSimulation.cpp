@@ -0,0 +1,534 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** GameSimulation
+*/
+
+#include "GameSimulation.hpp"
+#include "../Scripting/CompiledScriptIO.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+
+#include <raymath.h>
+
+namespace
+{
+    BoundingBox getCubeBounds(Vector3D position)
+    {
+        return {{position.x, position.y, position.z}, {position.x + 1.0f, position.y + 1.0f, position.z + 1.0f}};
+    }
+}
+
+namespace gameplay
+{
+    GameSimulation::GameSimulation(Cubes &cubes, Sprites &sprites, std::shared_ptr<Render::Camera> camera)
+        : _cubes(cubes), _sprites(sprites), _camera(camera), _scripts(*this)
+    {
+    }
+
+    objects::Character *GameSimulation::getPlayer() const
+    {
+        return _sprites.empty() ? nullptr : _sprites.front().get();
+    }
+
+    void GameSimulation::update(input::IHandlerBase &inputHandler, float deltaTime)
+    {
+        if (_navCooldown > 0)
+            _navCooldown--;
+        if (getPlayer()) {
+            syncEntities();
+            updatePlayer(inputHandler);
+            updateNpcs();
+            animateSprites(deltaTime);
+        }
+        _spriteTree.sync(_sprites);
+
+        handleScriptEvents();
+        _scripts.update(deltaTime);
+        if (_profiler && _profiler->getFrameCount() % PROFILE_SAVE_FRAMES == 0)
+            saveProfile();
+    }
+
+    void GameSimulation::draw3D()
+    {
+        for (std::size_t i = 0; i < _cubes.size(); i++) {
+            if (isHidden(static_cast<int>(i)))
+                continue;
+            auto look = _looks.find(static_cast<int>(i));
+            if (look == _looks.end())
+                _cubes[i]->draw();
+            else
+                _cubes[i]->draw(look->second.rotation, look->second.tint);
+        }
+        if (!_camera)
+            return;
+
+        int spriteId = static_cast<int>(_cubes.size());
+        _spriteBatch.clear();
+        for (const auto &sprite : _sprites) {
+            auto look = _looks.find(spriteId);
+            if (isHidden(spriteId)) {
+                spriteId++;
+                continue;
+            }
+            if (look == _looks.end())
+                sprite->draw(_spriteBatch);
+            else
+                sprite->draw(_spriteBatch, look->second.tint, look->second.spin);
+            spriteId++;
+        }
+        _spriteBatch.draw(_camera->getRaylibCam());
+    }
+
+    void GameSimulation::draw2D(Rectangle renderArea)
+    {
+        int spriteId = static_cast<int>(_cubes.size());
+
+        // With a camera the sprites were drawn in the 3D pass
+        if (_camera)
+            return;
+        for (const auto &sprite : _sprites) {
+            if (!isHidden(spriteId))
+                sprite->draw(renderArea, _camera);
+            spriteId++;
+        }
+    }
+
+    Vector3 GameSimulation::handleInput(input::IHandlerBase &inputHandler)
+    {
+        const float gridStep = 0.1f;
+        Vector3 delta = {0.0f, 0.0f, 0.0f};
+
+        if (inputHandler.isReleased(input::Generic::SELECT1)) {
+            _camera->rotateClock();
+        }
+        if (inputHandler.isReleased(input::Generic::SELECT2)) {
+            _camera->rotateCounterclock();
+        }
+        if (!inputHandler.isNotPressed(input::Generic::LEFT))
+            delta.x -= gridStep;
+        if (!inputHandler.isNotPressed(input::Generic::RIGHT))
+            delta.x += gridStep;
+        if (!inputHandler.isNotPressed(input::Generic::UP))
+            delta.z -= gridStep;
+        if (!inputHandler.isNotPressed(input::Generic::DOWN))
+            delta.z += gridStep;
+        if (!inputHandler.isNotPressed(input::Generic::ATTACK) && _grounded)
+            _verticalVelocity = JUMP_VELOCITY;
+        return delta;
+    }
+
+    void GameSimulation::updatePlayer(input::IHandlerBase &inputHandler)
+    {
+        objects::Character *player = getPlayer();
+
+        if (!_spawnPosition)
+            _spawnPosition = player->getBoxPosition();
+
+        Vector3 delta = handleInput(inputHandler);
+        player->setMoving(delta.x != 0.0f || delta.z != 0.0f);
+        _verticalVelocity = std::max(_verticalVelocity + _gravity, -MAX_FALL_SPEED);
+        delta.y = _verticalVelocity;
+
+        MoveResult result = moveCharacter(*player, delta);
+        _grounded = result.grounded;
+        player->setJumping(!_grounded);
+        if (result.normal.y != 0.0f)
+            _verticalVelocity = 0.0f;
+        if (player->getBoxPosition().y < FALL_LIMIT) {
+            player->setBox3DPosition(*_spawnPosition);
+            _verticalVelocity = 0.0f;
+        }
+    }
+
+    void GameSimulation::syncEntities()
+    {
+        // Sprites were added, removed or replaced since the last update
+        if (_spriteEntities.size() != _sprites.size()) {
+            _registry.clear();
+            _spriteEntities.clear();
+            _npcRoutes.clear();
+            _registry.reserve(_sprites.size());
+            for (std::size_t i = 0; i < _sprites.size(); i++) {
+                ecs::Entity entity = _registry.create();
+                _registry.getPositions().emplace(entity, {});
+                _registry.getSprites().emplace(entity, {});
+                _registry.getAnimations().emplace(entity, {});
+                // The player moves in updatePlayer, every other character chases it
+                if (i != 0) {
+                    _registry.getVelocities().emplace(entity, {});
+                    _registry.getBodies().emplace(entity, {});
+                }
+                _spriteEntities.push_back(entity);
+            }
+        }
+
+        for (std::size_t i = 0; i < _sprites.size(); i++) {
+            objects::Character &character = *_sprites[i];
+            ecs::Entity entity = _spriteEntities[i];
+            ecs::Sprite &sprite = _registry.getSprites().get(entity);
+            ecs::Animation &animation = _registry.getAnimations().get(entity);
+            const AnimationSet *set = &character.getAnimationSet();
+
+            _registry.getPositions().get(entity).value = character.getBoxPosition().convert();
+            sprite.texture = character.getAsset2D().getTexture();
+            sprite.source = character.getBox2D().getRectangle();
+            if (animation.set != set) {
+                animation = {};
+                animation.set = set;
+            }
+        }
+    }
+
+    void GameSimulation::updateNpcs()
+    {
+        Vector3 goal = getPlayer()->getBoxPosition().convert();
+
+        if (_sprites.size() < 2)
+            return;
+        ensureNavGrid(false);
+        _chaseField.setGoal(_navGrid, goal);
+        _chaseField.update(_navGrid);
+
+        const std::vector<ecs::Entity> &npcs = _registry.getBodies().getEntities();
+        std::vector<ecs::Body> &bodies = _registry.getBodies().getData();
+        for (std::size_t i = 0; i < npcs.size(); i++) {
+            Vector3 position = _registry.getPositions().get(npcs[i]).value;
+            Vector3 &velocity = _registry.getVelocities().get(npcs[i]).value;
+            velocity = steerNpc(npcs[i], position, bodies[i], goal);
+            _registry.getAnimations().get(npcs[i]).moving = velocity.x != 0.0f || velocity.z != 0.0f;
+        }
+        moveBodies();
+    }
+
+    Vector3 GameSimulation::steerNpc(ecs::Entity npc, Vector3 position, ecs::Body &body, Vector3 goal)
+    {
+        Vector3 delta = {0.0f, 0.0f, 0.0f};
+        Vector3 waypoint;
+        float goalDistance = std::hypot(goal.x - position.x, goal.z - position.z);
+        bool stepping = false;
+
+        if (position.y < FALL_LIMIT)
+            return delta;
+        if (goalDistance > NPC_STOP_DISTANCE) {
+            stepping = _chaseField.getNextWaypoint(_navGrid, position, waypoint);
+            if (stepping)
+                _npcRoutes.erase(npc);
+            else if (goalDistance > NPC_ROUTE_DISTANCE)
+                stepping = followRoute(npc, position, goal, waypoint);
+        }
+        if (stepping) {
+            float dx = waypoint.x - position.x;
+            float dz = waypoint.z - position.z;
+            float distance = std::hypot(dx, dz);
+            if (distance > 0.0f) {
+                delta.x = dx / distance * NPC_SPEED;
+                delta.z = dz / distance * NPC_SPEED;
+            }
+            if (waypoint.y > position.y + STEP_HEIGHT && body.grounded)
+                body.verticalVelocity = JUMP_VELOCITY;
+        }
+        body.verticalVelocity = std::max(body.verticalVelocity + _gravity, -MAX_FALL_SPEED);
+        delta.y = body.verticalVelocity;
+        return delta;
+    }
+
+    bool GameSimulation::followRoute(ecs::Entity npc, Vector3 position, Vector3 goal, Vector3 &waypoint)
+    {
+        NpcRoute &npcRoute = _npcRoutes[npc];
+        int goalNode = _navGrid.findNode(goal);
+        int node = _navGrid.findNode(position);
+
+        if (npcRoute.goal != goalNode || npcRoute.gridVersion != _navGrid.getVersion()) {
+            npcRoute.found = _navHierarchy.planRoute(_navGrid, position, goal, npcRoute.route);
+            npcRoute.segment.clear();
+            npcRoute.step = 0;
+            npcRoute.goal = goalNode;
+            npcRoute.gridVersion = _navGrid.getVersion();
+        }
+        if (!npcRoute.found || node == -1)
+            return false;
+
+        // Skip the segment's nodes already reached, refine the next segment past its end
+        while (npcRoute.step < npcRoute.segment.size() && _navGrid.findNode(npcRoute.segment[npcRoute.step]) == node)
+            npcRoute.step++;
+        if (npcRoute.step == npcRoute.segment.size()) {
+            npcRoute.step = 0;
+            if (!_navHierarchy.refineNext(_navGrid, npcRoute.route, npcRoute.segment) || npcRoute.segment.empty()) {
+                npcRoute.found = false;
+                return false;
+            }
+        }
+        waypoint = npcRoute.segment[npcRoute.step];
+        return true;
+    }
+
+    void GameSimulation::moveBodies()
+    {
+        const std::vector<ecs::Entity> &movers = _registry.getVelocities().getEntities();
+        const std::vector<ecs::Velocity> &velocities = _registry.getVelocities().getData();
+
+        ensureWorld();
+        for (std::size_t i = 0; i < movers.size(); i++) {
+            Vector3 &position = _registry.getPositions().get(movers[i]).value;
+            ecs::Body &body = _registry.getBodies().get(movers[i]);
+
+            // Characters that fell off the map stay where they are
+            if (position.y < FALL_LIMIT)
+                continue;
+            BoundingBox box = getCharacterBounds(position);
+            MoveResult result = _world.move(box, velocities[i].value, STEP_HEIGHT);
+            position = {box.min.x + CHARACTER_HALF_WIDTH, box.min.y, box.min.z + CHARACTER_HALF_WIDTH};
+            body.grounded = result.grounded;
+            if (result.normal.y != 0.0f)
+                body.verticalVelocity = 0.0f;
+            _registry.getAnimations().get(movers[i]).jumping = !body.grounded;
+        }
+    }
+
+    void GameSimulation::animateSprites(float deltaTime)
+    {
+        objects::Character *player = getPlayer();
+        ecs::Animation &playerAnimation = _registry.getAnimations().get(_spriteEntities[0]);
+
+        playerAnimation.moving = player->isMoving();
+        playerAnimation.jumping = player->isJumping();
+        ecs::updateAnimations(_registry, deltaTime);
+
+        for (std::size_t i = 0; i < _sprites.size(); i++) {
+            objects::Character &character = *_sprites[i];
+            ecs::Entity entity = _spriteEntities[i];
+            const Rectangle &source = _registry.getSprites().get(entity).source;
+
+            character.setBox2DPosition({source.x, source.y});
+            if (i == 0)
+                continue;
+            const ecs::Animation &animation = _registry.getAnimations().get(entity);
+            character.setBox3DPosition(_registry.getPositions().get(entity).value);
+            character.setMoving(animation.moving);
+            character.setJumping(animation.jumping);
+        }
+    }
+
+    MoveResult GameSimulation::moveCharacter(objects::Character &character, Vector3 delta)
+    {
+        ensureWorld();
+
+        BoundingBox box = getCharacterBounds(character.getBoxPosition());
+        MoveResult result = _world.move(box, delta, STEP_HEIGHT);
+        character.setBox3DPosition({box.min.x + CHARACTER_HALF_WIDTH, box.min.y, box.min.z + CHARACTER_HALF_WIDTH});
+        return result;
+    }
+
+    void GameSimulation::ensureWorld()
+    {
+        if (!_worldDirty && _world.getSolidCount() == _cubes.size())
+            return;
+
+        _world.clear();
+        for (const auto &cube : _cubes)
+            _world.addSolid(getCubeBounds(cube->getBoxPosition()));
+        _worldDirty = false;
+        _navDirty = true;
+    }
+
+    void GameSimulation::ensureNavGrid(bool now)
+    {
+        ensureWorld();
+        if (!_navDirty || (!now && _navCooldown > 0))
+            return;
+
+        _navBlocks.clear();
+        for (const auto &cube : _cubes)
+            _navBlocks.push_back(cube->getBoxPosition().convert());
+        _navGrid.build(_navBlocks);
+        // Following every build keeps the portal work down to the changed chunks
+        if (_navHierarchy.isBuilt())
+            _navHierarchy.update(_navGrid);
+        _navDirty = false;
+        _navCooldown = NAV_REBUILD_FRAMES;
+    }
+
+    NavGrid &GameSimulation::getNavGrid()
+    {
+        ensureNavGrid(true);
+        return _navGrid;
+    }
+
+    void GameSimulation::addScript(const CompiledScript &script)
+    {
+        _scripts.addScript(script);
+    }
+
+    void GameSimulation::loadScripts(const std::string &directory)
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(directory, ec))
+            return;
+
+        std::vector<uint8_t> buffer;
+        std::string error;
+        for (const auto &entry : std::filesystem::directory_iterator(directory, ec)) {
+            if (entry.path().extension() != scripting::CompiledScriptIO::FILE_EXTENSION)
+                continue;
+            CompiledScript script(-1);
+            if (!scripting::CompiledScriptIO::readFile(entry.path().string(), buffer) ||
+                !scripting::CompiledScriptIO::read(buffer.data(), buffer.size(), script, error)) {
+                std::cerr << "[GameSimulation] Skipping script " << entry.path().string() << ": " << error << std::endl;
+                continue;
+            }
+            addScript(script);
+        }
+    }
+
+    void GameSimulation::start()
+    {
+        _scripts.start();
+    }
+
+    void GameSimulation::enableProfiling(const std::string &path)
+    {
+        if (!_profiler)
+            _profiler = std::make_unique<scripting::ScriptProfiler>();
+        _profilePath = path;
+        _scripts.setProfiler(_profiler.get());
+    }
+
+    bool GameSimulation::saveProfile() const
+    {
+        if (!_profiler)
+            return false;
+        if (!scripting::ScriptProfileIO::saveToFile(_profiler->snapshot(), _profilePath)) {
+            std::cerr << "[GameSimulation] Could not save the script profile to " << _profilePath << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    void GameSimulation::resetSceneState()
+    {
+        _hiddenObjects.clear();
+        _looks.clear();
+        _worldDirty = true;
+        _navCooldown = 0;
+        _verticalVelocity = 0.0f;
+        _grounded = false;
+        _spawnPosition.reset();
+        _registry.clear();
+        _spriteEntities.clear();
+        _npcRoutes.clear();
+        _chaseField.clear();
+        _spriteTree.clear();
+    }
+
+    void GameSimulation::handleScriptEvents()
+    {
+        static const std::pair<const char *, int> scriptKeys[] = {
+            {"Space", KEY_SPACE}, {"A", KEY_A}, {"W", KEY_W}, {"S", KEY_S}, {"D", KEY_D},
+            {"Up", KEY_UP}, {"Down", KEY_DOWN}, {"Left", KEY_LEFT}, {"Right", KEY_RIGHT}, {"Enter", KEY_ENTER}
+        };
+
+        for (const auto &scriptKey : scriptKeys) {
+            if (IsKeyPressed(scriptKey.second))
+                _scripts.triggerKeyPress(scriptKey.first);
+        }
+
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            Ray ray = GetMouseRay(GetMousePosition(), _camera->getRaylibCam());
+            int hitId = -1;
+            float hitDistance = 0.0f;
+
+            for (std::size_t i = 0; i < _cubes.size(); i++) {
+                RayCollision collision = GetRayCollisionBox(ray, _cubes[i]->getBox3D().convert());
+                if (collision.hit && (hitId == -1 || collision.distance < hitDistance)) {
+                    hitId = static_cast<int>(i);
+                    hitDistance = collision.distance;
+                }
+            }
+            float spriteDistance = 0.0f;
+            int sprite = _spriteTree.raycast(ray, hitId == -1 ? std::numeric_limits<float>::max() : hitDistance, spriteDistance);
+            if (sprite != -1)
+                hitId = static_cast<int>(_cubes.size()) + sprite;
+            if (hitId != -1)
+                _scripts.triggerClick(hitId);
+        }
+    }
+
+    objects::AEntity *GameSimulation::getScriptTarget(int objectId) const
+    {
+        if (objectId < 0)
+            return nullptr;
+        if (objectId < static_cast<int>(_cubes.size()))
+            return _cubes[objectId].get();
+
+        std::size_t spriteIndex = static_cast<std::size_t>(objectId) - _cubes.size();
+        return spriteIndex < _sprites.size() ? _sprites[spriteIndex].get() : nullptr;
+    }
+
+    void GameSimulation::moveObject(int objectId, Vector3 offset)
+    {
+        objects::AEntity *target = getScriptTarget(objectId);
+
+        if (!target)
+            return;
+        Vector3D position = target->getBoxPosition();
+        Vector3D moved = {position.x + offset.x, position.y + offset.y, position.z + offset.z};
+        target->setBox3DPosition(moved);
+        if (objectId >= static_cast<int>(_cubes.size()))
+            return;
+        // A world that is up to date follows the one cube, the NavGrid catches up at its own pace
+        if (!_worldDirty && _world.getSolidCount() == _cubes.size())
+            _world.moveSolid(static_cast<std::size_t>(objectId), getCubeBounds(moved));
+        else
+            _worldDirty = true;
+        _navDirty = true;
+    }
+
+    void GameSimulation::rotateObject(int objectId, Vector3 axis, float degrees)
+    {
+        if (!getScriptTarget(objectId) || Vector3Length(axis) == 0.0f || degrees == 0.0f)
+            return;
+        ObjectLook &look = _looks[objectId];
+        Quaternion turn = QuaternionFromAxisAngle(Vector3Normalize(axis), degrees * DEG2RAD);
+        // Renormalised so thousands of small per-frame turns do not drift
+        look.rotation = QuaternionNormalize(QuaternionMultiply(turn, look.rotation));
+        look.spin = std::fmod(look.spin + degrees, 360.0f);
+    }
+
+    void GameSimulation::setObjectColor(int objectId, Color color)
+    {
+        if (!getScriptTarget(objectId))
+            return;
+        _looks[objectId].tint = color;
+    }
+
+    Quaternion GameSimulation::getRotation(int objectId) const
+    {
+        auto look = _looks.find(objectId);
+        return look == _looks.end() ? ObjectLook().rotation : look->second.rotation;
+    }
+
+    Color GameSimulation::getTint(int objectId) const
+    {
+        auto look = _looks.find(objectId);
+        return look == _looks.end() ? ObjectLook().tint : look->second.tint;
+    }
+
+    void GameSimulation::setObjectVisible(int objectId, bool visible)
+    {
+        if (visible)
+            _hiddenObjects.erase(objectId);
+        else
+            _hiddenObjects.insert(objectId);
+    }
+
+    void GameSimulation::logMessage(int objectId, const std::string &message)
+    {
+        std::cout << "[Script " << objectId << "] " << message << std::endl;
+    }
+}
@@ -0,0 +1,247 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** GameSimulation
+*/
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "../ECS/Systems.hpp"
+#include "../Entities/Character.hpp"
+#include "../Entities/MapElement.hpp"
+#include "../Input/MouseKeyboard.hpp"
+#include "../Render/Camera.hpp"
+#include "../Scripting/ScriptScheduler.hpp"
+#include "CollisionWorld.hpp"
+#include "FlowField.hpp"
+#include "NavGrid.hpp"
+#include "NavHierarchy.hpp"
+#include "SpriteTree.hpp"
+
+namespace gameplay
+{
+    /**
+     * @brief Gameplay rules shared by GenericGame and the editor's play mode
+     *
+     * Runs player movement, collisions, jumping, sprite animation, the
+     * other characters chasing the player through a shared FlowField (far
+     * ones it has not reached yet follow NavHierarchy routes) and the
+     * visual scripts against a scene it does not own: the game passes the
+     * objects it loaded, the editor the ones it is editing, so playing in
+     * the editor reuses the loaded assets as they are.
+     *
+     * Object IDs follow the editor: cubes first, then sprites; sprite 0 is
+     * the player.
+     */
+    class GameSimulation : public scripting::IScriptHost
+    {
+        public:
+            using Cubes = std::vector<std::shared_ptr<objects::MapElement>>;
+            using Sprites = std::vector<std::shared_ptr<objects::Character>>;
+
+            GameSimulation(Cubes &cubes, Sprites &sprites, std::shared_ptr<Render::Camera> camera);
+            ~GameSimulation() = default;
+
+            GameSimulation(const GameSimulation &) = delete;
+            GameSimulation &operator=(const GameSimulation &) = delete;
+
+            void update(input::IHandlerBase &inputHandler, float deltaTime);
+            /**
+             * @brief Draw the cubes, then the sprites sorted among them
+             */
+            void draw3D();
+            /**
+             * @brief Isometric sprite overlay, for a simulation without a camera
+             */
+            void draw2D(Rectangle renderArea);
+
+            /**
+             * @brief Move a character's collision box through the cubes
+             *
+             * The box is getCharacterBounds() at the character's position.
+             * Ledges up to STEP_HEIGHT are climbed.
+             */
+            MoveResult moveCharacter(objects::Character &character, Vector3 delta);
+
+            /**
+             * @brief Rebuild the collision world before the next move
+             *
+             * Needed when cubes are added, removed or replaced behind the
+             * simulation's back; script moves update the world in place.
+             */
+            void markWorldDirty() { _worldDirty = true; };
+
+            bool isPlayerGrounded() const { return _grounded; };
+
+            /**
+             * @brief Sprites indexed for overlap, radius and ray queries, as of the last update
+             */
+            const SpriteTree &getSpriteTree() const { return _spriteTree; };
+
+            /**
+             * @brief Walkable surfaces of the current cubes, brought up to date first
+             *
+             * The characters' own chase reads the grid as it is, rebuilt at
+             * most every NAV_REBUILD_FRAMES updates.
+             */
+            NavGrid &getNavGrid();
+
+            void addScript(const CompiledScript &script);
+            void loadScripts(const std::string &directory);
+            void start();
+
+            /**
+             * @brief Profile the scripts added from now on, saved to path
+             *
+             * Call before addScript or loadScripts: scripts already running
+             * are not attached. The counters are saved every
+             * PROFILE_SAVE_FRAMES updates and by saveProfile().
+             */
+            void enableProfiling(const std::string &path);
+            /**
+             * @return false when profiling is off or the file could not be written
+             */
+            bool saveProfile() const;
+            bool isProfiling() const { return _profiler != nullptr; };
+
+            scripting::ScriptScheduler &getScripts() { return _scripts; };
+            objects::Character *getPlayer() const;
+            bool isHidden(int objectId) const { return _hiddenObjects.count(objectId) != 0; };
+            /**
+             * @brief Turn applied by scripts, identity for objects never rotated
+             */
+            Quaternion getRotation(int objectId) const;
+            /**
+             * @brief Colour set by scripts, WHITE for objects never tinted
+             */
+            Color getTint(int objectId) const;
+
+            /**
+             * @brief Forget script-driven state after the scene was replaced
+             */
+            void resetSceneState();
+
+            // IScriptHost
+            void moveObject(int objectId, Vector3 offset) override;
+            void rotateObject(int objectId, Vector3 axis, float degrees) override;
+            void setObjectColor(int objectId, Color color) override;
+            void setObjectVisible(int objectId, bool visible) override;
+            void logMessage(int objectId, const std::string &message) override;
+
+        protected:
+        private:
+            static constexpr float STEP_HEIGHT = 0.5f;
+            static constexpr float JUMP_VELOCITY = 0.15f;
+            static constexpr float MAX_FALL_SPEED = 0.5f;   ///< Per update, below one cube so landings stay visible
+            static constexpr float FALL_LIMIT = -50.0f;     ///< Players falling past this height respawn
+            static constexpr float NPC_SPEED = 0.05f;
+            static constexpr float NPC_STOP_DISTANCE = 1.0f; ///< Characters stop this close to the player
+            static constexpr float NPC_ROUTE_DISTANCE = NavGrid::CHUNK_SIZE; ///< Farther characters the chase field misses follow a chunk route
+            static constexpr int NAV_REBUILD_FRAMES = 15;   ///< Cube edits closer than this share one NavGrid build
+            static constexpr uint64_t PROFILE_SAVE_FRAMES = 600; ///< About ten seconds, so a killed game still leaves a profile
+
+            /**
+             * @brief How scripts changed an object's look, its collisions stay axis-aligned
+             *
+             * Cubes draw the full rotation. Sprites always face the camera,
+             * so they only spin on screen, by the degrees turned so far.
+             */
+            struct ObjectLook {
+                Quaternion rotation = {0.0f, 0.0f, 0.0f, 1.0f};
+                float spin = 0.0f;
+                Color tint = WHITE;
+            };
+
+            /**
+             * @brief Chunk route of one character, refined a segment at a time
+             */
+            struct NpcRoute {
+                NavHierarchy::Route route;
+                std::vector<Vector3> segment;   ///< Node positions to walk through, up to the route's position
+                std::size_t step = 0;           ///< Segment entry walked to now
+                int goal = -1;                  ///< Grid node the route was planned to
+                std::uint32_t gridVersion = 0;  ///< Grid build the route was planned on
+                bool found = false;             ///< False keeps a failed plan from being retried every update
+            };
+
+            /**
+             * @brief Horizontal move requested by the input, starts jumps
+             */
+            Vector3 handleInput(input::IHandlerBase &inputHandler);
+            void updatePlayer(input::IHandlerBase &inputHandler);
+            /**
+             * @brief Mirror the sprites into the registry, one entity each
+             *
+             * Positions and animation sets are read back every update, as
+             * scripts and the editor move and edit the characters.
+             */
+            void syncEntities();
+            void updateNpcs();
+            /**
+             * @return The move for this update, with the fall speed in y
+             */
+            Vector3 steerNpc(ecs::Entity npc, Vector3 position, ecs::Body &body, Vector3 goal);
+            /**
+             * @brief Next step of the character's chunk route to goal
+             *
+             * Used while the chase field has no step for a far character,
+             * as when its first integration has not reached it yet on a
+             * large map. The route is planned again when the goal moves to
+             * another node or the grid is rebuilt.
+             *
+             * @return false when there is no route
+             */
+            bool followRoute(ecs::Entity npc, Vector3 position, Vector3 goal, Vector3 &waypoint);
+            /**
+             * @brief Move the entities with a velocity through the cubes
+             */
+            void moveBodies();
+            /**
+             * @brief Play every sprite's clip, then copy frames and NPC moves back to the characters
+             */
+            void animateSprites(float deltaTime);
+            void ensureWorld();
+            /**
+             * @param now Build even if the last build was less than NAV_REBUILD_FRAMES updates ago
+             */
+            void ensureNavGrid(bool now);
+            void handleScriptEvents();
+            objects::AEntity *getScriptTarget(int objectId) const;
+
+            Cubes &_cubes;
+            Sprites &_sprites;
+            std::shared_ptr<Render::Camera> _camera;
+
+            CollisionWorld _world;
+            NavGrid _navGrid;
+            NavHierarchy _navHierarchy;                     ///< Built by the first route, then follows every grid build
+            FlowField _chaseField;                          ///< Leads every other character to the player
+            SpriteTree _spriteTree;
+            Render::SpriteBatch _spriteBatch;
+            bool _worldDirty = true;
+            bool _navDirty = true;                          ///< The cubes moved since the last NavGrid build
+            int _navCooldown = 0;                           ///< Updates until the NavGrid may be rebuilt
+            std::vector<Vector3> _navBlocks;
+            float _verticalVelocity = 0.0f;
+            float _gravity = -0.01f;
+            bool _grounded = false;
+            std::optional<Vector3D> _spawnPosition;         ///< Where the player respawns after falling off the map
+            ecs::Registry _registry;                        ///< The sprites as entities, for the per-update passes
+            std::vector<ecs::Entity> _spriteEntities;       ///< Entity of each sprite, in sprite order
+            std::unordered_map<ecs::Entity, NpcRoute> _npcRoutes; ///< Characters walking a chunk route
+
+            std::unique_ptr<scripting::ScriptProfiler> _profiler; ///< Set by enableProfiling, outlives _scripts
+            std::string _profilePath;
+            scripting::ScriptScheduler _scripts;            ///< Runs the compiled visual scripts
+            std::unordered_set<int> _hiddenObjects;         ///< Object IDs hidden by scripts
+            std::unordered_map<int, ObjectLook> _looks;     ///< Object IDs rotated or tinted by scripts
+    };
+}
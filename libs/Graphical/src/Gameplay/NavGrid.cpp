@@ -0,0 +1,540 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** NavGrid
+*/
+
+#include "NavGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace
+{
+    constexpr float EPSILON = 0.01f;
+    constexpr float DIAGONAL_COST = 1.41421356f;
+    constexpr float CLIMB_COST = 0.5f;     ///< Extra cost per block climbed or dropped
+    constexpr float NO_CEILING = std::numeric_limits<float>::infinity();
+    constexpr float UNREACHED = std::numeric_limits<float>::infinity();
+
+    const int NEIGHBOURS[8][2] = {
+        {1, 0}, {-1, 0}, {0, 1}, {0, -1},
+        {1, 1}, {1, -1}, {-1, 1}, {-1, -1}
+    };
+}
+
+namespace gameplay
+{
+    std::size_t NavGrid::PathKeyHash::operator()(const PathKey &key) const
+    {
+        std::size_t hash = 0;
+        const int values[6] = {key.from.x, key.from.z, key.from.level, key.to.x, key.to.z, key.to.level};
+
+        for (int value : values)
+            hash = hash * 1000003u ^ std::hash<int>()(value);
+        return hash;
+    }
+
+    void NavGrid::build(const std::vector<Vector3> &blocks)
+    {
+        if (blocks.empty()) {
+            clear();
+            return;
+        }
+
+        int minX = std::numeric_limits<int>::max();
+        int minZ = std::numeric_limits<int>::max();
+        int maxX = std::numeric_limits<int>::min();
+        int maxZ = std::numeric_limits<int>::min();
+        for (const Vector3 &block : blocks) {
+            int x = static_cast<int>(std::floor(block.x));
+            int z = static_cast<int>(std::floor(block.z));
+            minX = std::min(minX, x);
+            minZ = std::min(minZ, z);
+            maxX = std::max(maxX, x);
+            maxZ = std::max(maxZ, z);
+        }
+
+        std::vector<std::uint32_t> oldColumnBlocks;
+        std::vector<float> oldBlockBottoms;
+        bool sameArea = _originX == minX && _originZ == minZ && _width == maxX - minX + 1 && _depth == maxZ - minZ + 1;
+        oldColumnBlocks.swap(_columnBlocks);
+        oldBlockBottoms.swap(_blockBottoms);
+        _originX = minX;
+        _originZ = minZ;
+        _width = maxX - minX + 1;
+        _depth = maxZ - minZ + 1;
+
+        // Bucket the block bottoms by column, then sort each column upwards
+        std::size_t columnCount = static_cast<std::size_t>(_width) * _depth;
+        _columnBlocks.assign(columnCount + 1, 0);
+        for (const Vector3 &block : blocks)
+            _columnBlocks[getColumn(static_cast<int>(std::floor(block.x)), static_cast<int>(std::floor(block.z))) + 1]++;
+        for (std::size_t column = 0; column < columnCount; column++)
+            _columnBlocks[column + 1] += _columnBlocks[column];
+        _blockBottoms.resize(blocks.size());
+        std::vector<std::uint32_t> fill(_columnBlocks.begin(), _columnBlocks.end() - 1);
+        for (const Vector3 &block : blocks)
+            _blockBottoms[fill[getColumn(static_cast<int>(std::floor(block.x)), static_cast<int>(std::floor(block.z)))]++] = block.y;
+        for (std::size_t column = 0; column < columnCount; column++)
+            std::sort(_blockBottoms.begin() + _columnBlocks[column], _blockBottoms.begin() + _columnBlocks[column + 1]);
+
+        int chunksX = (_width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        int chunksZ = (_depth + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        bool incremental = sameArea && oldColumnBlocks.size() == _columnBlocks.size() && !_nodeColumn.empty();
+        std::vector<bool> changedColumns;
+        if (!incremental) {
+            _changedChunks.assign(static_cast<std::size_t>(chunksX) * chunksZ, true);
+            _cache.clear();
+        } else {
+            // A changed column also changes the edges and corners of its neighbours
+            std::vector<bool> changed(static_cast<std::size_t>(chunksX) * chunksZ, false);
+            bool anyChanged = false;
+            changedColumns.assign(columnCount, false);
+            for (std::size_t column = 0; column < columnCount; column++) {
+                if (std::equal(_blockBottoms.begin() + _columnBlocks[column], _blockBottoms.begin() + _columnBlocks[column + 1],
+                        oldBlockBottoms.begin() + oldColumnBlocks[column], oldBlockBottoms.begin() + oldColumnBlocks[column + 1]))
+                    continue;
+                int x = static_cast<int>(column % _width);
+                int z = static_cast<int>(column / _width);
+                anyChanged = true;
+                changedColumns[column] = true;
+                for (int dz = -1; dz <= 1; dz++) {
+                    for (int dx = -1; dx <= 1; dx++) {
+                        int nx = x + dx;
+                        int nz = z + dz;
+                        if (nx >= 0 && nz >= 0 && nx < _width && nz < _depth)
+                            changed[(nz / CHUNK_SIZE) * chunksX + nx / CHUNK_SIZE] = true;
+                    }
+                }
+            }
+            // Same blocks: the graph, its version and the last changed chunks all stand
+            if (!anyChanged)
+                return;
+            _changedChunks.swap(changed);
+            invalidateChunks(_changedChunks);
+        }
+        // The buffers of the build before are refilled rather than reallocated
+        _previous.columnNodes.swap(_columnNodes);
+        _previous.nodeColumn.swap(_nodeColumn);
+        _previous.edgeStart.swap(_edgeStart);
+        _previous.edgeTarget.swap(_edgeTarget);
+        _previous.edgeCost.swap(_edgeCost);
+
+        buildNodes();
+        buildEdges(incremental);
+        _componentsStale = true;
+        _version++;
+
+        // Same blocks in a column give the same nodes, in the same order
+        _renumbering.clear();
+        if (incremental) {
+            _renumbering.assign(_previous.nodeColumn.size(), -1);
+            for (std::size_t column = 0; column < columnCount; column++) {
+                if (changedColumns[column])
+                    continue;
+                for (std::uint32_t node = _previous.columnNodes[column]; node < _previous.columnNodes[column + 1]; node++)
+                    _renumbering[node] = static_cast<int>(_columnNodes[column] + (node - _previous.columnNodes[column]));
+            }
+        }
+
+        std::size_t nodeCount = _nodeHeight.size();
+        _cost.resize(nodeCount);
+        _parent.resize(nodeCount);
+        _visited.assign(nodeCount, 0);
+        _closed.assign(nodeCount, 0);
+        _stamp = 0;
+        _open.reserve(nodeCount);
+    }
+
+    void NavGrid::clear()
+    {
+        _originX = 0;
+        _originZ = 0;
+        _width = 0;
+        _depth = 0;
+        _version++;
+        _changedChunks.clear();
+        _columnBlocks.clear();
+        _blockBottoms.clear();
+        _columnNodes.clear();
+        _nodeColumn.clear();
+        _nodeHeight.clear();
+        _nodeHeadroom.clear();
+        _edgeStart.clear();
+        _edgeTarget.clear();
+        _edgeCost.clear();
+        _previous = PreviousGraph();
+        _renumbering.clear();
+        _nodeIsland.clear();
+        _nodeComponent.clear();
+        _componentEntered.clear();
+        _componentsStale = false;
+        _cost.clear();
+        _parent.clear();
+        _visited.clear();
+        _closed.clear();
+        _open.clear();
+        _cache.clear();
+    }
+
+    bool NavGrid::findPath(Vector3 from, Vector3 to, std::vector<Vector3> &path, bool useCache)
+    {
+        int start = findNode(from);
+        int goal = findNode(to);
+
+        path.clear();
+        if (start == -1 || goal == -1)
+            return false;
+        if (start == goal)
+            return true;
+
+        PathKey key = {getCellKey(start), getCellKey(goal)};
+        if (useCache) {
+            auto cached = _cache.find(key);
+            if (cached != _cache.end()) {
+                path.assign(cached->second.points.begin(), cached->second.points.end());
+                return true;
+            }
+        }
+
+        if (isUnreachable(start, goal) || !search(start, goal))
+            return false;
+        for (int node = goal; node != start; node = _parent[node])
+            path.push_back(getNodePosition(node));
+        std::reverse(path.begin(), path.end());
+
+        if (useCache) {
+            if (_cache.size() >= MAX_CACHED_PATHS)
+                _cache.clear();
+            CachedPath &entry = _cache[key];
+            entry.points = path;
+            entry.chunks.push_back(getChunk(start));
+            for (int node = goal; node != start; node = _parent[node])
+                entry.chunks.push_back(getChunk(node));
+            std::sort(entry.chunks.begin(), entry.chunks.end());
+            entry.chunks.erase(std::unique(entry.chunks.begin(), entry.chunks.end()), entry.chunks.end());
+        }
+        return true;
+    }
+
+    bool NavGrid::findPathInChunk(int start, int goal, std::vector<Vector3> &path)
+    {
+        path.clear();
+        if (start == goal)
+            return true;
+        if (getChunk(start) != getChunk(goal) || !search(start, goal, getChunk(start)))
+            return false;
+        for (int node = goal; node != start; node = _parent[node])
+            path.push_back(getNodePosition(node));
+        std::reverse(path.begin(), path.end());
+        return true;
+    }
+
+    void NavGrid::getChunkCosts(int start, const std::vector<int> &targets, std::vector<float> &costs)
+    {
+        search(start, -1, getChunk(start));
+        costs.resize(targets.size());
+        for (std::size_t i = 0; i < targets.size(); i++)
+            costs[i] = _closed[targets[i]] == _stamp ? _cost[targets[i]] : UNREACHED;
+    }
+
+    int NavGrid::findNode(Vector3 position) const
+    {
+        int column = getColumn(static_cast<int>(std::floor(position.x)), static_cast<int>(std::floor(position.z)));
+        int result = -1;
+
+        if (column == -1)
+            return -1;
+        for (std::uint32_t node = _columnNodes[column]; node < _columnNodes[column + 1]; node++) {
+            if (_nodeHeight[node] > position.y + MAX_STEP_UP * 0.5f)
+                break;
+            result = static_cast<int>(node);
+        }
+        return result;
+    }
+
+    Vector3 NavGrid::getNodePosition(int node) const
+    {
+        int column = _nodeColumn[node];
+
+        return {
+            static_cast<float>(_originX + column % _width) + 0.5f,
+            _nodeHeight[node],
+            static_cast<float>(_originZ + column / _width) + 0.5f
+        };
+    }
+
+    void NavGrid::buildNodes()
+    {
+        std::size_t columnCount = static_cast<std::size_t>(_width) * _depth;
+
+        _columnNodes.assign(columnCount + 1, 0);
+        _nodeColumn.clear();
+        _nodeHeight.clear();
+        _nodeHeadroom.clear();
+        for (std::size_t column = 0; column < columnCount; column++) {
+            std::uint32_t first = _columnBlocks[column];
+            std::uint32_t last = _columnBlocks[column + 1];
+
+            _columnNodes[column] = static_cast<std::uint32_t>(_nodeHeight.size());
+            for (std::uint32_t block = first; block < last; block++) {
+                float top = _blockBottoms[block] + 1.0f;
+                float ceiling = block + 1 < last ? _blockBottoms[block + 1] : NO_CEILING;
+                if (ceiling - top < CLEARANCE)
+                    continue;
+                _nodeColumn.push_back(static_cast<int>(column));
+                _nodeHeight.push_back(top);
+                _nodeHeadroom.push_back(ceiling - top);
+            }
+        }
+        _columnNodes[columnCount] = static_cast<std::uint32_t>(_nodeHeight.size());
+    }
+
+    void NavGrid::buildEdges(bool reuseUnchanged)
+    {
+        std::size_t nodeCount = _nodeHeight.size();
+        const PreviousGraph &previous = _previous;
+
+        _edgeStart.assign(nodeCount + 1, 0);
+        _edgeTarget.clear();
+        _edgeCost.clear();
+        _edgeTarget.reserve(nodeCount * 8);
+        _edgeCost.reserve(nodeCount * 8);
+        for (std::size_t node = 0; node < nodeCount; node++) {
+            int x = _nodeColumn[node] % _width + _originX;
+            int z = _nodeColumn[node] / _width + _originZ;
+            float height = _nodeHeight[node];
+
+            _edgeStart[node] = static_cast<std::uint32_t>(_edgeTarget.size());
+            // Columns around an unchanged chunk are unchanged: its edges only need renumbering
+            if (reuseUnchanged && !_changedChunks[getChunk(static_cast<int>(node))]) {
+                int column = _nodeColumn[node];
+                std::uint32_t oldNode = previous.columnNodes[column] + (static_cast<std::uint32_t>(node) - _columnNodes[column]);
+                for (std::uint32_t edge = previous.edgeStart[oldNode]; edge < previous.edgeStart[oldNode + 1]; edge++) {
+                    int target = previous.edgeTarget[edge];
+                    int targetColumn = previous.nodeColumn[target];
+                    _edgeTarget.push_back(static_cast<int>(_columnNodes[targetColumn] + (target - previous.columnNodes[targetColumn])));
+                    _edgeCost.push_back(previous.edgeCost[edge]);
+                }
+                continue;
+            }
+            for (const auto &offset : NEIGHBOURS) {
+                int column = getColumn(x + offset[0], z + offset[1]);
+                bool diagonal = offset[0] != 0 && offset[1] != 0;
+                if (column == -1)
+                    continue;
+                for (std::uint32_t target = _columnNodes[column]; target < _columnNodes[column + 1]; target++) {
+                    float rise = _nodeHeight[target] - height;
+                    if (rise > MAX_STEP_UP + EPSILON || rise < -MAX_DROP - EPSILON)
+                        continue;
+                    // Jumping needs room above the start, dropping needs room above the landing
+                    if (rise > EPSILON && _nodeHeadroom[node] < rise + CLEARANCE)
+                        continue;
+                    if (rise < -EPSILON && _nodeHeadroom[target] < -rise + CLEARANCE)
+                        continue;
+                    if (diagonal && (std::fabs(rise) > EPSILON ||
+                            !hasSurfaceAt(getColumn(x + offset[0], z), height) ||
+                            !hasSurfaceAt(getColumn(x, z + offset[1]), height)))
+                        continue;
+                    _edgeTarget.push_back(static_cast<int>(target));
+                    _edgeCost.push_back((diagonal ? DIAGONAL_COST : 1.0f) + std::fabs(rise) * CLIMB_COST);
+                }
+            }
+        }
+        _edgeStart[nodeCount] = static_cast<std::uint32_t>(_edgeTarget.size());
+    }
+
+    void NavGrid::buildComponents()
+    {
+        int nodeCount = static_cast<int>(_nodeHeight.size());
+
+        // Islands: union-find over every edge
+        _nodeIsland.resize(nodeCount);
+        for (int node = 0; node < nodeCount; node++)
+            _nodeIsland[node] = node;
+        auto findIsland = [this](int node) {
+            while (_nodeIsland[node] != node) {
+                _nodeIsland[node] = _nodeIsland[_nodeIsland[node]];
+                node = _nodeIsland[node];
+            }
+            return node;
+        };
+        for (int node = 0; node < nodeCount; node++) {
+            for (std::uint32_t edge = _edgeStart[node]; edge < _edgeStart[node + 1]; edge++)
+                _nodeIsland[findIsland(node)] = findIsland(_edgeTarget[edge]);
+        }
+        for (int node = 0; node < nodeCount; node++)
+            _nodeIsland[node] = findIsland(node);
+
+        // Strongly connected components: Tarjan's algorithm with an explicit call stack
+        std::vector<int> order(nodeCount, -1);
+        std::vector<int> lowLink(nodeCount, 0);
+        std::vector<bool> onStack(nodeCount, false);
+        std::vector<int> stack;
+        std::vector<std::pair<int, std::uint32_t>> calls;
+        int nextOrder = 0;
+        int componentCount = 0;
+
+        _nodeComponent.assign(nodeCount, -1);
+        for (int root = 0; root < nodeCount; root++) {
+            if (order[root] != -1)
+                continue;
+            calls.emplace_back(root, _edgeStart[root]);
+            order[root] = lowLink[root] = nextOrder++;
+            stack.push_back(root);
+            onStack[root] = true;
+            while (!calls.empty()) {
+                int node = calls.back().first;
+                std::uint32_t &edge = calls.back().second;
+                if (edge < _edgeStart[node + 1]) {
+                    int target = _edgeTarget[edge++];
+                    if (order[target] == -1) {
+                        order[target] = lowLink[target] = nextOrder++;
+                        stack.push_back(target);
+                        onStack[target] = true;
+                        calls.emplace_back(target, _edgeStart[target]);
+                    } else if (onStack[target]) {
+                        lowLink[node] = std::min(lowLink[node], order[target]);
+                    }
+                    continue;
+                }
+                calls.pop_back();
+                if (!calls.empty())
+                    lowLink[calls.back().first] = std::min(lowLink[calls.back().first], lowLink[node]);
+                if (lowLink[node] != order[node])
+                    continue;
+                int member = -1;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    onStack[member] = false;
+                    _nodeComponent[member] = componentCount;
+                } while (member != node);
+                componentCount++;
+            }
+        }
+
+        _componentEntered.assign(componentCount, false);
+        for (int node = 0; node < nodeCount; node++) {
+            for (std::uint32_t edge = _edgeStart[node]; edge < _edgeStart[node + 1]; edge++) {
+                int target = _edgeTarget[edge];
+                if (_nodeComponent[target] != _nodeComponent[node])
+                    _componentEntered[_nodeComponent[target]] = true;
+            }
+        }
+    }
+
+    bool NavGrid::isUnreachable(int start, int goal)
+    {
+        if (_componentsStale) {
+            buildComponents();
+            _componentsStale = false;
+        }
+        if (_nodeIsland[start] != _nodeIsland[goal])
+            return true;
+        return _nodeComponent[start] != _nodeComponent[goal] && !_componentEntered[_nodeComponent[goal]];
+    }
+
+    void NavGrid::invalidateChunks(const std::vector<bool> &changed)
+    {
+        for (auto it = _cache.begin(); it != _cache.end();) {
+            bool touched = std::any_of(it->second.chunks.begin(), it->second.chunks.end(),
+                [&changed](int chunk) { return changed[chunk]; });
+            if (touched)
+                it = _cache.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    bool NavGrid::search(int start, int goal, int chunk)
+    {
+        if (++_stamp == 0) {
+            std::fill(_visited.begin(), _visited.end(), 0);
+            std::fill(_closed.begin(), _closed.end(), 0);
+            _stamp = 1;
+        }
+
+        int goalX = goal == -1 ? 0 : _nodeColumn[goal] % _width;
+        int goalZ = goal == -1 ? 0 : _nodeColumn[goal] / _width;
+        auto heuristic = [this, goal, goalX, goalZ](int node) {
+            if (goal == -1)
+                return 0.0f;
+            float dx = static_cast<float>(std::abs(_nodeColumn[node] % _width - goalX));
+            float dz = static_cast<float>(std::abs(_nodeColumn[node] / _width - goalZ));
+            return std::max(dx, dz) + (DIAGONAL_COST - 1.0f) * std::min(dx, dz);
+        };
+        auto compare = std::greater<std::pair<float, int>>();
+
+        _open.clear();
+        _cost[start] = 0.0f;
+        _parent[start] = start;
+        _visited[start] = _stamp;
+        _open.emplace_back(heuristic(start), start);
+        while (!_open.empty()) {
+            std::pop_heap(_open.begin(), _open.end(), compare);
+            int node = _open.back().second;
+            _open.pop_back();
+            // Nodes are pushed again when a cheaper way in is found, skip the stale entries
+            if (_closed[node] == _stamp)
+                continue;
+            _closed[node] = _stamp;
+            if (node == goal)
+                return true;
+
+            for (std::uint32_t edge = _edgeStart[node]; edge < _edgeStart[node + 1]; edge++) {
+                int target = _edgeTarget[edge];
+                float cost = _cost[node] + _edgeCost[edge];
+                if (_closed[target] == _stamp || (_visited[target] == _stamp && cost >= _cost[target]))
+                    continue;
+                if (chunk != -1 && getChunk(target) != chunk)
+                    continue;
+                _visited[target] = _stamp;
+                _cost[target] = cost;
+                _parent[target] = node;
+                _open.emplace_back(cost + heuristic(target), target);
+                std::push_heap(_open.begin(), _open.end(), compare);
+            }
+        }
+        return goal == -1;
+    }
+
+    int NavGrid::getColumn(int x, int z) const
+    {
+        x -= _originX;
+        z -= _originZ;
+        if (x < 0 || z < 0 || x >= _width || z >= _depth)
+            return -1;
+        return z * _width + x;
+    }
+
+    int NavGrid::getChunk(int node) const
+    {
+        int column = _nodeColumn[node];
+        int chunksX = (_width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+        return (column / _width / CHUNK_SIZE) * chunksX + (column % _width) / CHUNK_SIZE;
+    }
+
+    NavGrid::CellKey NavGrid::getCellKey(int node) const
+    {
+        int column = _nodeColumn[node];
+
+        return {_originX + column % _width, _originZ + column / _width, static_cast<int>(std::lround(_nodeHeight[node] * 16.0f))};
+    }
+
+    bool NavGrid::hasSurfaceAt(int column, float height) const
+    {
+        if (column == -1)
+            return false;
+        for (std::uint32_t node = _columnNodes[column]; node < _columnNodes[column + 1]; node++) {
+            if (std::fabs(_nodeHeight[node] - height) <= EPSILON)
+                return true;
+        }
+        return false;
+    }
+}
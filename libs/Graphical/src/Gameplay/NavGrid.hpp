@@ -0,0 +1,220 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** NavGrid
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+
+namespace gameplay
+{
+    /**
+     * @brief Walkable surfaces of the block map and A* paths across them
+     *
+     * Every block top with room for a character above it is a node, placed at
+     * the centre of its cell. Nodes link to the eight neighbouring columns when
+     * the height difference can be climbed with a jump or safely dropped, and
+     * diagonals never cut corners.
+     *
+     * Queries reuse the node arrays and the open list, so they do not allocate
+     * once the grid is built. Goals on another island, or in a part of the
+     * map only left by dropping down (a pillar top), are turned down before
+     * searching, as the search would otherwise visit every node it reaches.
+     *
+     * Found paths are cached and dropped when a chunk they cross changes in
+     * a rebuild; the other chunks keep their paths.
+     */
+    class NavGrid
+    {
+        public:
+            static constexpr int CHUNK_SIZE = 16;                   ///< Columns per chunk side
+            static constexpr float CLEARANCE = 0.8f;                ///< Free height a character needs
+            static constexpr float MAX_STEP_UP = 1.0f;              ///< Highest ledge a jump reaches
+            static constexpr float MAX_DROP = 4.0f;
+            static constexpr std::size_t MAX_CACHED_PATHS = 4096;
+
+            NavGrid() = default;
+            ~NavGrid() = default;
+
+            /**
+             * @brief Rebuild the graph from unit blocks given by their min corner
+             *
+             * Over the same area, only the edges of changed chunks are worked
+             * out again, and a build that changes no block keeps the version.
+             * Cached paths crossing a chunk whose blocks changed are forgotten.
+             */
+            void build(const std::vector<Vector3> &blocks);
+            void clear();
+
+            /**
+             * @brief Waypoints from the surface under from to the surface under to
+             *
+             * @param path Replaced by the node positions after the start, up to the goal
+             * @param useCache Look the path up in, and store it into, the cache
+             * @return false if either end is off the surfaces or no path exists
+             */
+            bool findPath(Vector3 from, Vector3 to, std::vector<Vector3> &path, bool useCache = true);
+
+            /**
+             * @brief Path between two nodes of one chunk, never leaving the chunk
+             *
+             * Used to refine NavHierarchy routes one chunk at a time; not cached.
+             */
+            bool findPathInChunk(int start, int goal, std::vector<Vector3> &path);
+
+            /**
+             * @brief Costs from start to targets, moving inside start's chunk only
+             *
+             * @param costs One per target, infinite when the target cannot be reached
+             */
+            void getChunkCosts(int start, const std::vector<int> &targets, std::vector<float> &costs);
+
+            /**
+             * @brief false only when start certainly cannot reach goal
+             */
+            bool mayReach(int start, int goal) { return !isUnreachable(start, goal); };
+
+            /**
+             * @brief Highest surface node in the position's column at most a step above it, or -1
+             */
+            int findNode(Vector3 position) const;
+            Vector3 getNodePosition(int node) const;
+
+            std::size_t getNodeCount() const { return _nodeHeight.size(); };
+            std::size_t getCachedPathCount() const { return _cache.size(); };
+
+            /**
+             * @brief Outgoing edges of a node are the range [getEdgeBegin(node), getEdgeEnd(node))
+             */
+            std::uint32_t getEdgeBegin(int node) const { return _edgeStart[node]; };
+            std::uint32_t getEdgeEnd(int node) const { return _edgeStart[node + 1]; };
+            std::size_t getEdgeCount() const { return _edgeTarget.size(); };
+            int getEdgeTarget(std::uint32_t edge) const { return _edgeTarget[edge]; };
+            float getEdgeCost(std::uint32_t edge) const { return _edgeCost[edge]; };
+
+            /**
+             * @brief Chunk of a node, chunks are numbered row by row
+             */
+            int getChunk(int node) const;
+            int getChunkCount() const { return static_cast<int>(_changedChunks.size()); };
+
+            /**
+             * @brief Chunks whose nodes or edges the last build changed, all of them when the map was resized
+             */
+            const std::vector<bool> &getChangedChunks() const { return _changedChunks; };
+            /**
+             * @brief Node of this build for each node of the previous one
+             *
+             * -1 for the nodes of columns whose blocks changed. Empty when the
+             * last build started over, as after a resize.
+             */
+            const std::vector<int> &getRenumbering() const { return _renumbering; };
+
+            /**
+             * @brief Changes on every build that changes a block, and on clear
+             *
+             * Node indices of other versions are stale.
+             */
+            std::uint32_t getVersion() const { return _version; };
+
+        protected:
+        private:
+            struct CellKey {
+                int x;
+                int z;
+                int level;      ///< Surface height in 1/16th of a block
+
+                bool operator==(const CellKey &other) const { return x == other.x && z == other.z && level == other.level; };
+            };
+
+            struct PathKey {
+                CellKey from;
+                CellKey to;
+
+                bool operator==(const PathKey &other) const { return from == other.from && to == other.to; };
+            };
+
+            struct PathKeyHash {
+                std::size_t operator()(const PathKey &key) const;
+            };
+
+            struct CachedPath {
+                std::vector<Vector3> points;
+                std::vector<int> chunks;    ///< Chunks the path has a node in
+            };
+
+            /**
+             * @brief Graph of the build before, its unchanged chunks are renumbered rather than rebuilt
+             */
+            struct PreviousGraph {
+                std::vector<std::uint32_t> columnNodes;
+                std::vector<int> nodeColumn;
+                std::vector<std::uint32_t> edgeStart;
+                std::vector<int> edgeTarget;
+                std::vector<float> edgeCost;
+            };
+
+            void buildNodes();
+            /**
+             * @param reuseUnchanged Copy the edges of unchanged chunks from _previous
+             */
+            void buildEdges(bool reuseUnchanged);
+            /**
+             * @brief Islands and components, worked out on the first reachability check after a build
+             */
+            void buildComponents();
+            bool isUnreachable(int start, int goal);
+            void invalidateChunks(const std::vector<bool> &changed);
+            /**
+             * @brief A* from start, or Dijkstra over everything reachable when goal is -1
+             *
+             * @param chunk Chunk the search stays in, -1 for the whole grid
+             */
+            bool search(int start, int goal, int chunk = -1);
+            int getColumn(int x, int z) const;
+            CellKey getCellKey(int node) const;
+            bool hasSurfaceAt(int column, float height) const;
+
+            // Blocks, as sorted bottoms per column (compressed rows)
+            int _originX = 0;
+            int _originZ = 0;
+            int _width = 0;
+            int _depth = 0;
+            std::uint32_t _version = 0;
+            std::vector<bool> _changedChunks;
+            std::vector<std::uint32_t> _columnBlocks;   ///< First block of each column, plus an end marker
+            std::vector<float> _blockBottoms;
+
+            // Surface nodes
+            std::vector<std::uint32_t> _columnNodes;    ///< First node of each column, plus an end marker
+            std::vector<int> _nodeColumn;
+            std::vector<float> _nodeHeight;
+            std::vector<float> _nodeHeadroom;           ///< Free height above the surface
+            std::vector<std::uint32_t> _edgeStart;      ///< First edge of each node, plus an end marker
+            std::vector<int> _edgeTarget;
+            std::vector<float> _edgeCost;
+            PreviousGraph _previous;                    ///< Swapped with the arrays above on each build
+            std::vector<int> _renumbering;
+            std::vector<int> _nodeIsland;               ///< Nodes joined by edges in any direction
+            std::vector<int> _nodeComponent;            ///< Nodes all reachable from one another
+            std::vector<bool> _componentEntered;        ///< Whether an edge leads into the component
+            bool _componentsStale = false;
+
+            // Search state, stamped so it is never cleared between queries
+            std::vector<float> _cost;
+            std::vector<int> _parent;
+            std::vector<std::uint32_t> _visited;
+            std::vector<std::uint32_t> _closed;
+            std::uint32_t _stamp = 0;
+            std::vector<std::pair<float, int>> _open;
+
+            std::unordered_map<PathKey, CachedPath, PathKeyHash> _cache;
+    };
+}
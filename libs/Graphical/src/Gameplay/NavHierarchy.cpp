@@ -0,0 +1,353 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** NavHierarchy
+*/
+
+#include "NavHierarchy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace
+{
+    constexpr float DIAGONAL_COST = 1.41421356f;
+
+    bool positionLess(const Vector3 &a, const Vector3 &b)
+    {
+        if (a.x != b.x)
+            return a.x < b.x;
+        if (a.z != b.z)
+            return a.z < b.z;
+        return a.y < b.y;
+    }
+
+    bool positionEqual(const Vector3 &a, const Vector3 &b)
+    {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+}
+
+namespace gameplay
+{
+    void NavHierarchy::update(NavGrid &grid)
+    {
+        if (grid.getVersion() == _version)
+            return;
+
+        std::size_t chunkCount = static_cast<std::size_t>(grid.getChunkCount());
+        std::vector<bool> rebuild;
+        // Changed chunks only describe the last build, missing one means starting over
+        if (_version != 0 && grid.getVersion() == _version + 1 && _chunks.size() == chunkCount) {
+            rebuild = grid.getChangedChunks();
+        } else {
+            _chunks.assign(chunkCount, Chunk());
+            rebuild.assign(chunkCount, true);
+        }
+
+        findPortals(grid, rebuild);
+        buildPortalGraph(grid);
+        _version = grid.getVersion();
+    }
+
+    void NavHierarchy::clear()
+    {
+        _chunks.clear();
+        _version = 0;
+        _lastRebuiltChunks = 0;
+        _crossings.clear();
+        _portalNodes.clear();
+        _portalOfNode.clear();
+        _edgeStart.clear();
+        _edgeTarget.clear();
+        _edgeCost.clear();
+        _cost.clear();
+        _parent.clear();
+        _visited.clear();
+        _closed.clear();
+        _open.clear();
+    }
+
+    bool NavHierarchy::planRoute(NavGrid &grid, Vector3 from, Vector3 to, Route &route)
+    {
+        update(grid);
+
+        int start = grid.findNode(from);
+        int goal = grid.findNode(to);
+
+        route.waypoints.clear();
+        route.next = 0;
+        if (start == -1 || goal == -1 || !grid.mayReach(start, goal))
+            return false;
+        route.position = grid.getNodePosition(start);
+        if (start == goal)
+            return true;
+
+        // Close goals are reached without leaving the chunk when possible
+        if (grid.getChunk(start) == grid.getChunk(goal) && grid.findPathInChunk(start, goal, _path)) {
+            route.waypoints.push_back(grid.getNodePosition(goal));
+            return true;
+        }
+        if (!searchPortals(grid, start, goal))
+            return false;
+
+        int portalCount = static_cast<int>(_portalNodes.size());
+        for (int node = _parent[portalCount + 1]; node != portalCount; node = _parent[node])
+            route.waypoints.push_back(grid.getNodePosition(_portalNodes[node]));
+        std::reverse(route.waypoints.begin(), route.waypoints.end());
+        route.waypoints.push_back(grid.getNodePosition(goal));
+        return true;
+    }
+
+    bool NavHierarchy::refineNext(NavGrid &grid, Route &route, std::vector<Vector3> &segment)
+    {
+        segment.clear();
+        if (route.next >= route.waypoints.size())
+            return false;
+
+        int from = grid.findNode(route.position);
+        int to = grid.findNode(route.waypoints[route.next]);
+        if (from == -1 || to == -1)
+            return false;
+
+        if (grid.getChunk(from) == grid.getChunk(to)) {
+            if (!grid.findPathInChunk(from, to, segment))
+                return false;
+        } else {
+            // Portals on both sides of a border are one edge apart
+            bool linked = false;
+            for (std::uint32_t edge = grid.getEdgeBegin(from); edge < grid.getEdgeEnd(from) && !linked; edge++)
+                linked = grid.getEdgeTarget(edge) == to;
+            if (!linked)
+                return false;
+            segment.push_back(grid.getNodePosition(to));
+        }
+        route.position = route.waypoints[route.next++];
+        return true;
+    }
+
+    void NavHierarchy::findPortals(NavGrid &grid, const std::vector<bool> &changed)
+    {
+        std::vector<bool> rebuild = changed;
+
+        // Untouched chunks keep their portals, under the new node numbers
+        for (std::size_t chunk = 0; chunk < _chunks.size(); chunk++) {
+            if (rebuild[chunk])
+                continue;
+            Chunk &data = _chunks[chunk];
+            for (std::size_t i = 0; i < data.portalPositions.size() && !rebuild[chunk]; i++) {
+                data.portals[i] = grid.findNode(data.portalPositions[i]);
+                rebuild[chunk] = data.portals[i] == -1;
+            }
+        }
+        _lastRebuiltChunks = static_cast<std::size_t>(std::count(rebuild.begin(), rebuild.end(), true));
+        for (std::size_t chunk = 0; chunk < _chunks.size(); chunk++) {
+            if (rebuild[chunk])
+                _chunks[chunk].portalPositions.clear();
+        }
+
+        // Straight edges between two chunks, one of them being rebuilt
+        int nodeCount = static_cast<int>(grid.getNodeCount());
+        _crossings.clear();
+        for (int node = 0; node < nodeCount; node++) {
+            int chunk = grid.getChunk(node);
+            Vector3 position = grid.getNodePosition(node);
+            for (std::uint32_t edge = grid.getEdgeBegin(node); edge < grid.getEdgeEnd(node); edge++) {
+                int target = grid.getEdgeTarget(edge);
+                int targetChunk = grid.getChunk(target);
+                if (targetChunk == chunk || (!rebuild[chunk] && !rebuild[targetChunk]))
+                    continue;
+                Vector3 targetPosition = grid.getNodePosition(target);
+                if (targetPosition.x != position.x && targetPosition.z != position.z)
+                    continue;
+                bool acrossX = targetPosition.x != position.x;
+                int westOrNorth = (acrossX ? targetPosition.x > position.x : targetPosition.z > position.z) ? chunk : targetChunk;
+                int along = static_cast<int>(std::floor(acrossX ? position.z : position.x));
+                _crossings.push_back({westOrNorth * 2 + (acrossX ? 0 : 1), along, node, target});
+            }
+        }
+        std::sort(_crossings.begin(), _crossings.end(), [](const Crossing &a, const Crossing &b) {
+            return a.border != b.border ? a.border < b.border : a.along < b.along;
+        });
+
+        // Cut each border into runs of neighbouring cells at a climbable height from one another and
+        // crossed the same ways; the middle cell of a run holds its portals
+        auto cellDirections = [this, &grid](std::size_t first, std::size_t last) {
+            int directions = 0;
+            for (std::size_t i = first; i < last; i++)
+                directions |= grid.getChunk(_crossings[i].from) == _crossings[i].border / 2 ? 1 : 2;
+            return directions;
+        };
+        std::vector<std::pair<std::size_t, std::size_t>> cells;
+        std::size_t index = 0;
+        while (index < _crossings.size()) {
+            cells.clear();
+            int border = _crossings[index].border;
+            int directions = -1;
+            float height = 0.0f;
+            while (index < _crossings.size() && _crossings[index].border == border) {
+                std::size_t cellEnd = index;
+                while (cellEnd < _crossings.size() && _crossings[cellEnd].border == border &&
+                    _crossings[cellEnd].along == _crossings[index].along)
+                    cellEnd++;
+                int cellDirection = cellDirections(index, cellEnd);
+                float cellHeight = grid.getNodePosition(_crossings[index].from).y;
+                bool continues = !cells.empty() && directions == cellDirection &&
+                    _crossings[cells.back().first].along + 1 == _crossings[index].along &&
+                    std::fabs(cellHeight - height) <= NavGrid::MAX_STEP_UP;
+                if (!cells.empty() && !continues)
+                    break;
+                cells.emplace_back(index, cellEnd);
+                directions = cellDirection;
+                height = cellHeight;
+                index = cellEnd;
+            }
+            const auto &middle = cells[cells.size() / 2];
+            for (std::size_t i = middle.first; i < middle.second; i++) {
+                for (int node : {_crossings[i].from, _crossings[i].to}) {
+                    int chunk = grid.getChunk(node);
+                    if (rebuild[chunk])
+                        _chunks[chunk].portalPositions.push_back(grid.getNodePosition(node));
+                }
+            }
+        }
+
+        // Costs between the portals of each rebuilt chunk
+        for (std::size_t chunk = 0; chunk < _chunks.size(); chunk++) {
+            if (!rebuild[chunk])
+                continue;
+            Chunk &data = _chunks[chunk];
+            std::sort(data.portalPositions.begin(), data.portalPositions.end(), positionLess);
+            data.portalPositions.erase(std::unique(data.portalPositions.begin(), data.portalPositions.end(), positionEqual),
+                data.portalPositions.end());
+            data.portals.resize(data.portalPositions.size());
+            for (std::size_t i = 0; i < data.portals.size(); i++)
+                data.portals[i] = grid.findNode(data.portalPositions[i]);
+
+            std::size_t count = data.portals.size();
+            data.distances.resize(count * count);
+            for (std::size_t i = 0; i < count; i++) {
+                grid.getChunkCosts(data.portals[i], data.portals, _scratch);
+                std::copy(_scratch.begin(), _scratch.end(), data.distances.begin() + i * count);
+            }
+        }
+    }
+
+    void NavHierarchy::buildPortalGraph(const NavGrid &grid)
+    {
+        _portalNodes.clear();
+        _portalOfNode.assign(grid.getNodeCount(), -1);
+        for (const Chunk &data : _chunks) {
+            for (int node : data.portals) {
+                _portalOfNode[node] = static_cast<int>(_portalNodes.size());
+                _portalNodes.push_back(node);
+            }
+        }
+
+        std::size_t portalCount = _portalNodes.size();
+        _edgeStart.assign(portalCount + 1, 0);
+        _edgeTarget.clear();
+        _edgeCost.clear();
+        std::size_t portal = 0;
+        for (const Chunk &data : _chunks) {
+            std::size_t count = data.portals.size();
+            for (std::size_t i = 0; i < count; i++, portal++) {
+                _edgeStart[portal] = static_cast<std::uint32_t>(_edgeTarget.size());
+                for (std::size_t j = 0; j < count; j++) {
+                    float cost = data.distances[i * count + j];
+                    if (i == j || std::isinf(cost))
+                        continue;
+                    _edgeTarget.push_back(_portalOfNode[data.portals[j]]);
+                    _edgeCost.push_back(cost);
+                }
+                int node = data.portals[i];
+                for (std::uint32_t edge = grid.getEdgeBegin(node); edge < grid.getEdgeEnd(node); edge++) {
+                    int target = grid.getEdgeTarget(edge);
+                    if (_portalOfNode[target] == -1 || grid.getChunk(target) == grid.getChunk(node))
+                        continue;
+                    _edgeTarget.push_back(_portalOfNode[target]);
+                    _edgeCost.push_back(grid.getEdgeCost(edge));
+                }
+            }
+        }
+        _edgeStart[portalCount] = static_cast<std::uint32_t>(_edgeTarget.size());
+
+        _cost.resize(portalCount + 2);
+        _parent.resize(portalCount + 2);
+        _visited.assign(portalCount + 2, 0);
+        _closed.assign(portalCount + 2, 0);
+        _stamp = 0;
+    }
+
+    bool NavHierarchy::searchPortals(NavGrid &grid, int start, int goal)
+    {
+        if (++_stamp == 0) {
+            std::fill(_visited.begin(), _visited.end(), 0);
+            std::fill(_closed.begin(), _closed.end(), 0);
+            _stamp = 1;
+        }
+
+        // The start links to its chunk's portals, the goal's chunk portals link to the goal
+        const Chunk &startChunk = _chunks[grid.getChunk(start)];
+        const Chunk &goalChunk = _chunks[grid.getChunk(goal)];
+        grid.getChunkCosts(start, startChunk.portals, _startCosts);
+        _goalTarget.assign(1, goal);
+        _goalCosts.resize(goalChunk.portals.size());
+        for (std::size_t i = 0; i < goalChunk.portals.size(); i++) {
+            grid.getChunkCosts(goalChunk.portals[i], _goalTarget, _scratch);
+            _goalCosts[i] = _scratch[0];
+        }
+
+        int startId = static_cast<int>(_portalNodes.size());
+        int goalId = startId + 1;
+        Vector3 goalPosition = grid.getNodePosition(goal);
+        auto heuristic = [&](int id) {
+            Vector3 position = grid.getNodePosition(id == startId ? start : _portalNodes[id]);
+            float dx = std::fabs(position.x - goalPosition.x);
+            float dz = std::fabs(position.z - goalPosition.z);
+            return std::max(dx, dz) + (DIAGONAL_COST - 1.0f) * std::min(dx, dz);
+        };
+        auto compare = std::greater<std::pair<float, int>>();
+        auto relax = [&](int from, int to, float cost) {
+            if (std::isinf(cost) || _closed[to] == _stamp || (_visited[to] == _stamp && cost >= _cost[to]))
+                return;
+            _visited[to] = _stamp;
+            _cost[to] = cost;
+            _parent[to] = from;
+            _open.emplace_back(cost + (to == goalId ? 0.0f : heuristic(to)), to);
+            std::push_heap(_open.begin(), _open.end(), compare);
+        };
+
+        _open.clear();
+        _cost[startId] = 0.0f;
+        _visited[startId] = _stamp;
+        _open.emplace_back(heuristic(startId), startId);
+        while (!_open.empty()) {
+            std::pop_heap(_open.begin(), _open.end(), compare);
+            int id = _open.back().second;
+            _open.pop_back();
+            if (_closed[id] == _stamp)
+                continue;
+            _closed[id] = _stamp;
+            if (id == goalId)
+                return true;
+
+            if (id == startId) {
+                for (std::size_t i = 0; i < startChunk.portals.size(); i++)
+                    relax(id, _portalOfNode[startChunk.portals[i]], _startCosts[i]);
+                continue;
+            }
+            for (std::uint32_t edge = _edgeStart[id]; edge < _edgeStart[id + 1]; edge++)
+                relax(id, _edgeTarget[edge], _cost[id] + _edgeCost[edge]);
+            if (grid.getChunk(_portalNodes[id]) != grid.getChunk(goal))
+                continue;
+            for (std::size_t i = 0; i < goalChunk.portals.size(); i++) {
+                if (goalChunk.portals[i] == _portalNodes[id])
+                    relax(id, goalId, _cost[id] + _goalCosts[i]);
+            }
+        }
+        return false;
+    }
+}
@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** NavHierarchy
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "NavGrid.hpp"
+
+namespace gameplay
+{
+    /**
+     * @brief Chunk-level route planning over a NavGrid (HPA*)
+     *
+     * Where a run of border cells links two chunks, the nodes on both sides
+     * of its middle cell become portals. Each chunk stores the costs between
+     * its own portals, found by searches that stay inside the chunk. Long
+     * routes are planned over this portal graph. They are then refined one
+     * segment at a time, and each segment is a search inside a single chunk.
+     *
+     * update() redoes the portal work only for the chunks the last grid
+     * build changed. An edit on a chunk border also changes the chunk across
+     * it. Any other chunk keeps its portals and costs and only maps them to
+     * the new node numbers.
+     */
+    class NavHierarchy
+    {
+        public:
+            /**
+             * @brief Planned route, walked by refining one segment after another
+             */
+            struct Route {
+                std::vector<Vector3> waypoints;     ///< Portals to go through, then the goal
+                std::size_t next = 0;
+                Vector3 position = {0.0f, 0.0f, 0.0f};  ///< End of the last refined segment
+            };
+
+            NavHierarchy() = default;
+            ~NavHierarchy() = default;
+
+            /**
+             * @brief Catch up with the grid's last build
+             *
+             * When builds were missed, every chunk is redone.
+             */
+            void update(NavGrid &grid);
+            void clear();
+
+            /**
+             * @brief Plan from the surface under from to the surface under to
+             *
+             * @return false if either end is off the surfaces or no route exists
+             */
+            bool planRoute(NavGrid &grid, Vector3 from, Vector3 to, Route &route);
+
+            /**
+             * @brief Grid path to the route's next waypoint
+             *
+             * @param segment Replaced by the node positions after the current one
+             * @return false once the goal is reached, or when the map changed under the route
+             */
+            bool refineNext(NavGrid &grid, Route &route, std::vector<Vector3> &segment);
+
+            bool isBuilt() const { return _version != 0; };
+            std::size_t getPortalCount() const { return _portalNodes.size(); };
+            std::size_t getLastRebuiltChunkCount() const { return _lastRebuiltChunks; };
+
+        protected:
+        private:
+            struct Chunk {
+                std::vector<Vector3> portalPositions;
+                std::vector<int> portals;           ///< Grid nodes of the positions
+                std::vector<float> distances;       ///< Portal to portal costs inside the chunk, row by row
+            };
+
+            struct Crossing {
+                int border;     ///< Chunk on the west or north side, times two, plus one for a south border
+                int along;      ///< Position of the cell along the border
+                int from;
+                int to;
+            };
+
+            void findPortals(NavGrid &grid, const std::vector<bool> &rebuild);
+            void buildPortalGraph(const NavGrid &grid);
+            bool searchPortals(NavGrid &grid, int start, int goal);
+
+            std::vector<Chunk> _chunks;
+            std::uint32_t _version = 0;
+            std::size_t _lastRebuiltChunks = 0;
+            std::vector<Crossing> _crossings;
+
+            // Portal graph, portals numbered chunk after chunk
+            std::vector<int> _portalNodes;          ///< Grid node of each portal
+            std::vector<int> _portalOfNode;         ///< Portal of each grid node, or -1
+            std::vector<std::uint32_t> _edgeStart;
+            std::vector<int> _edgeTarget;
+            std::vector<float> _edgeCost;
+
+            // Route search state, the start and goal are the two entries after the portals
+            std::vector<float> _cost;
+            std::vector<int> _parent;
+            std::vector<std::uint32_t> _visited;
+            std::vector<std::uint32_t> _closed;
+            std::uint32_t _stamp = 0;
+            std::vector<std::pair<float, int>> _open;
+            std::vector<float> _startCosts;         ///< From the start to the portals of its chunk
+            std::vector<float> _goalCosts;          ///< From the portals of the goal's chunk to the goal
+            std::vector<int> _goalTarget;
+            std::vector<float> _scratch;
+            std::vector<Vector3> _path;
+    };
+}
@@ -0,0 +1,42 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** SpriteTree
+*/
+
+#include "SpriteTree.hpp"
+
+namespace gameplay
+{
+    void SpriteTree::sync(const Sprites &sprites)
+    {
+        // Entries that now hold another character, or none, lose their proxy
+        for (std::size_t i = 0; i < _owners.size(); i++) {
+            if (i < sprites.size() && _owners[i] == sprites[i].get())
+                continue;
+            _tree.remove(_proxies[i]);
+            _proxies[i] = AabbTree::NULL_NODE;
+        }
+        _proxies.resize(sprites.size(), AabbTree::NULL_NODE);
+        _owners.resize(sprites.size(), nullptr);
+
+        for (std::size_t i = 0; i < sprites.size(); i++) {
+            BoundingBox bounds = getCharacterBounds(sprites[i]->getBoxPosition());
+
+            if (_proxies[i] == AabbTree::NULL_NODE) {
+                _proxies[i] = _tree.insert(bounds, static_cast<int>(i));
+                _owners[i] = sprites[i].get();
+            } else {
+                _tree.update(_proxies[i], bounds);
+            }
+        }
+    }
+
+    void SpriteTree::clear()
+    {
+        _tree.clear();
+        _proxies.clear();
+        _owners.clear();
+    }
+}
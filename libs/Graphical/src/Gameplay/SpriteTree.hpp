@@ -0,0 +1,69 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** SpriteTree
+*/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "../Entities/Character.hpp"
+#include "AabbTree.hpp"
+
+namespace gameplay
+{
+    static constexpr float CHARACTER_HALF_WIDTH = 0.25f;
+    static constexpr float CHARACTER_HEIGHT = 0.8f;
+
+    /**
+     * @brief Collision and picking box of a character: centred on x and z, rising from y
+     */
+    inline BoundingBox getCharacterBounds(Vector3D position)
+    {
+        return {
+            {position.x - CHARACTER_HALF_WIDTH, position.y, position.z - CHARACTER_HALF_WIDTH},
+            {position.x + CHARACTER_HALF_WIDTH, position.y + CHARACTER_HEIGHT, position.z + CHARACTER_HALF_WIDTH}
+        };
+    }
+
+    /**
+     * @brief AabbTree kept in step with a list of characters
+     *
+     * Results are indices into the list given to the last sync().
+     */
+    class SpriteTree
+    {
+        public:
+            using Sprites = std::vector<std::shared_ptr<objects::Character>>;
+
+            SpriteTree() = default;
+            ~SpriteTree() = default;
+
+            /**
+             * @brief Follow the moves, additions and removals since the last call
+             *
+             * Characters that stayed inside their fat box cost a containment test.
+             */
+            void sync(const Sprites &sprites);
+            void clear();
+
+            /**
+             * @return Index of the nearest character hit, or -1
+             */
+            int raycast(Ray ray, float maxDistance, float &distance) const { return _tree.raycast(ray, maxDistance, distance); };
+            void querySphere(Vector3 center, float radius, std::vector<int> &indices) const { _tree.querySphere(center, radius, indices); };
+            void queryBox(const BoundingBox &box, std::vector<int> &indices) const { _tree.queryBox(box, indices); };
+            void queryPairs(std::vector<std::pair<int, int>> &pairs) const { _tree.queryPairs(pairs); };
+
+            const AabbTree &getTree() const { return _tree; };
+
+        protected:
+        private:
+            AabbTree _tree;
+            std::vector<int> _proxies;                      ///< Tree proxy of each list entry
+            std::vector<const objects::Character *> _owners; ///< Character each proxy was made for
+    };
+}
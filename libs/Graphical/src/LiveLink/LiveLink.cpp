@@ -0,0 +1,371 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** LiveLink
+*/
+
+#include "LiveLink.hpp"
+#include "Scripting/BinaryStream.hpp"
+
+#include <cstring>
+#include <iostream>
+
+#ifndef _WIN32
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+namespace livelink
+{
+    namespace
+    {
+        constexpr uint8_t MAX_MESSAGE_TYPE = static_cast<uint8_t>(MessageType::SCRIPT_REMOVED);
+
+        void writePosition(scripting::BinaryWriter &writer, Vector3 position)
+        {
+            writer.writeFloat(position.x);
+            writer.writeFloat(position.y);
+            writer.writeFloat(position.z);
+        }
+
+        Vector3 readPosition(scripting::BinaryReader &reader)
+        {
+            Vector3 position;
+            position.x = reader.readFloat();
+            position.y = reader.readFloat();
+            position.z = reader.readFloat();
+            return position;
+        }
+
+#ifndef _WIN32
+        bool makeAddress(const std::string &path, sockaddr_un &address)
+        {
+            if (path.size() >= sizeof(address.sun_path)) {
+                std::cerr << "[LiveLink] Socket path too long: " << path << std::endl;
+                return false;
+            }
+            std::memset(&address, 0, sizeof(address));
+            address.sun_family = AF_UNIX;
+            std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+            return true;
+        }
+
+        bool setNonBlocking(int fd)
+        {
+            int flags = fcntl(fd, F_GETFL, 0);
+            return flags != -1 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1;
+        }
+#endif
+    }
+
+    void Protocol::encode(const Message &message, std::vector<uint8_t> &out)
+    {
+        std::size_t header = out.size();
+        out.resize(header + HEADER_SIZE);
+
+        scripting::BinaryWriter writer(out);
+        writer.writeU8(static_cast<uint8_t>(message.type));
+        switch (message.type) {
+            case MessageType::CUBE_ADDED:
+                writePosition(writer, message.position);
+                writer.writeString(message.path);
+                writer.writeFloat(message.scale);
+                break;
+            case MessageType::CUBE_REMOVED:
+                writePosition(writer, message.position);
+                break;
+            case MessageType::SPRITE_ADDED:
+                writePosition(writer, message.position);
+                writer.writeString(message.path);
+                writer.writeFloat(message.width);
+                writer.writeFloat(message.height);
+                writer.writeFloat(message.scale);
+                writer.writeVarInt(message.frames);
+                break;
+            case MessageType::SPRITE_REMOVED:
+            case MessageType::SCRIPT_REMOVED:
+                writer.writeVarInt(message.index);
+                break;
+            case MessageType::SCRIPT_UPDATED:
+                writer.writeVarUInt(message.payload.size());
+                writer.writeBytes(message.payload.data(), message.payload.size());
+                break;
+            case MessageType::MAP_CLEARED:
+                break;
+        }
+
+        uint32_t size = static_cast<uint32_t>(out.size() - header - HEADER_SIZE);
+        for (std::size_t i = 0; i < HEADER_SIZE; i++)
+            out[header + i] = static_cast<uint8_t>(size >> (i * 8));
+    }
+
+    long Protocol::decode(const uint8_t *data, std::size_t size, std::vector<Message> &out)
+    {
+        std::size_t offset = 0;
+
+        while (size - offset >= HEADER_SIZE) {
+            uint32_t frameSize = 0;
+            for (std::size_t i = 0; i < HEADER_SIZE; i++)
+                frameSize |= static_cast<uint32_t>(data[offset + i]) << (i * 8);
+            if (frameSize == 0 || frameSize > MAX_FRAME_SIZE)
+                return -1;
+            if (size - offset - HEADER_SIZE < frameSize)
+                break;
+
+            scripting::BinaryReader reader(data + offset + HEADER_SIZE, frameSize);
+            Message message;
+            uint8_t type = reader.readU8();
+            if (type > MAX_MESSAGE_TYPE)
+                return -1;
+            message.type = static_cast<MessageType>(type);
+            switch (message.type) {
+                case MessageType::CUBE_ADDED:
+                    message.position = readPosition(reader);
+                    reader.readString(message.path);
+                    message.scale = reader.readFloat();
+                    break;
+                case MessageType::CUBE_REMOVED:
+                    message.position = readPosition(reader);
+                    break;
+                case MessageType::SPRITE_ADDED:
+                    message.position = readPosition(reader);
+                    reader.readString(message.path);
+                    message.width = reader.readFloat();
+                    message.height = reader.readFloat();
+                    message.scale = reader.readFloat();
+                    message.frames = static_cast<int>(reader.readVarInt());
+                    break;
+                case MessageType::SPRITE_REMOVED:
+                case MessageType::SCRIPT_REMOVED:
+                    message.index = static_cast<int>(reader.readVarInt());
+                    break;
+                case MessageType::SCRIPT_UPDATED:
+                    message.payload.resize(reader.readCount());
+                    reader.readBytes(message.payload.data(), message.payload.size());
+                    break;
+                case MessageType::MAP_CLEARED:
+                    break;
+            }
+            if (!reader.isGood() || !reader.isAtEnd())
+                return -1;
+
+            out.push_back(std::move(message));
+            offset += HEADER_SIZE + frameSize;
+        }
+        return static_cast<long>(offset);
+    }
+
+    LiveLinkServer::~LiveLinkServer()
+    {
+        close();
+    }
+
+#ifndef _WIN32
+    bool LiveLinkServer::listen(const std::string &path)
+    {
+        sockaddr_un address;
+
+        close();
+        if (!makeAddress(path, address))
+            return false;
+
+        _listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (_listenFd == -1)
+            return false;
+        // A game that crashed leaves its socket file behind
+        unlink(path.c_str());
+        if (bind(_listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == -1 ||
+            ::listen(_listenFd, 1) == -1 || !setNonBlocking(_listenFd)) {
+            std::cerr << "[LiveLink] Cannot listen on " << path << ": " << std::strerror(errno) << std::endl;
+            ::close(_listenFd);
+            _listenFd = -1;
+            return false;
+        }
+        _path = path;
+        std::cout << "[LiveLink] Listening on " << path << std::endl;
+        return true;
+    }
+
+    void LiveLinkServer::close()
+    {
+        dropClient();
+        if (_listenFd != -1) {
+            ::close(_listenFd);
+            unlink(_path.c_str());
+            _listenFd = -1;
+        }
+    }
+
+    void LiveLinkServer::dropClient()
+    {
+        if (_clientFd != -1)
+            ::close(_clientFd);
+        _clientFd = -1;
+        _incoming.clear();
+    }
+
+    void LiveLinkServer::poll(std::vector<Message> &out)
+    {
+        if (_listenFd == -1)
+            return;
+
+        int accepted = accept(_listenFd, nullptr, nullptr);
+        if (accepted != -1) {
+            dropClient();
+            if (setNonBlocking(accepted)) {
+                _clientFd = accepted;
+                std::cout << "[LiveLink] Editor connected" << std::endl;
+            } else {
+                ::close(accepted);
+            }
+        }
+        if (_clientFd == -1)
+            return;
+
+        uint8_t chunk[16384];
+        while (true) {
+            ssize_t received = recv(_clientFd, chunk, sizeof(chunk), 0);
+            if (received > 0) {
+                _incoming.insert(_incoming.end(), chunk, chunk + received);
+                continue;
+            }
+            if (received == -1 && errno == EINTR)
+                continue;
+            if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                // Apply what arrived completely before the editor went away
+                Protocol::decode(_incoming.data(), _incoming.size(), out);
+                std::cout << "[LiveLink] Editor disconnected" << std::endl;
+                dropClient();
+                return;
+            }
+            break;
+        }
+
+        long consumed = Protocol::decode(_incoming.data(), _incoming.size(), out);
+        if (consumed < 0) {
+            std::cerr << "[LiveLink] Corrupt stream from the editor, dropping it" << std::endl;
+            dropClient();
+            return;
+        }
+        _incoming.erase(_incoming.begin(), _incoming.begin() + consumed);
+    }
+#else
+    bool LiveLinkServer::listen(const std::string &)
+    {
+        std::cerr << "[LiveLink] Not available on this platform" << std::endl;
+        return false;
+    }
+
+    void LiveLinkServer::close()
+    {
+    }
+
+    void LiveLinkServer::dropClient()
+    {
+    }
+
+    void LiveLinkServer::poll(std::vector<Message> &)
+    {
+    }
+#endif
+
+    LiveLinkClient::LiveLinkClient(const std::string &path)
+        : _path(path), _nextAttempt(std::chrono::steady_clock::now())
+    {
+    }
+
+    LiveLinkClient::~LiveLinkClient()
+    {
+        close();
+    }
+
+    void LiveLinkClient::update()
+    {
+        if (_fd == -1) {
+            if (std::chrono::steady_clock::now() < _nextAttempt)
+                return;
+            _nextAttempt = std::chrono::steady_clock::now() + RETRY_INTERVAL;
+            if (!connect())
+                return;
+        }
+        flush();
+    }
+
+    bool LiveLinkClient::send(const Message &message)
+    {
+        if (_fd == -1)
+            return false;
+        Protocol::encode(message, _outgoing);
+        return flush();
+    }
+
+#ifndef _WIN32
+    bool LiveLinkClient::connect()
+    {
+        sockaddr_un address;
+
+        if (!makeAddress(_path, address))
+            return false;
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd == -1)
+            return false;
+        if (::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == -1 || !setNonBlocking(fd)) {
+            ::close(fd);
+            return false;
+        }
+        _fd = fd;
+        _outgoing.clear();
+        std::cout << "[LiveLink] Connected to the running game" << std::endl;
+        return true;
+    }
+
+    bool LiveLinkClient::flush()
+    {
+        std::size_t sent = 0;
+
+        while (sent < _outgoing.size()) {
+            ssize_t written = ::send(_fd, _outgoing.data() + sent, _outgoing.size() - sent, MSG_NOSIGNAL);
+            if (written > 0) {
+                sent += static_cast<std::size_t>(written);
+                continue;
+            }
+            if (written == -1 && errno == EINTR)
+                continue;
+            if (written == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                break;
+            std::cout << "[LiveLink] Game disconnected" << std::endl;
+            close();
+            return false;
+        }
+        // The rest goes out on a later update(), in order
+        _outgoing.erase(_outgoing.begin(), _outgoing.begin() + static_cast<std::ptrdiff_t>(sent));
+        return true;
+    }
+
+    void LiveLinkClient::close()
+    {
+        if (_fd != -1)
+            ::close(_fd);
+        _fd = -1;
+        _outgoing.clear();
+    }
+#else
+    bool LiveLinkClient::connect()
+    {
+        return false;
+    }
+
+    bool LiveLinkClient::flush()
+    {
+        return false;
+    }
+
+    void LiveLinkClient::close()
+    {
+    }
+#endif
+}
@@ -0,0 +1,144 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** LiveLink
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "raylib.h"
+
+namespace livelink
+{
+    enum class MessageType : uint8_t {
+        MAP_CLEARED,        ///< Remove every cube and sprite
+        CUBE_ADDED,         ///< position, path (model), scale
+        CUBE_REMOVED,       ///< position
+        SPRITE_ADDED,       ///< position, path (texture), width, height, scale, frames; appended last
+        SPRITE_REMOVED,     ///< index, in placement order
+        SCRIPT_UPDATED,     ///< payload: compiled script, see CompiledScriptIO
+        SCRIPT_REMOVED      ///< index: object ID
+    };
+
+    /**
+     * @brief One change pushed from the editor to a running game
+     *
+     * Only the fields listed for the message type are meaningful.
+     */
+    struct Message {
+        MessageType type = MessageType::MAP_CLEARED;
+        Vector3 position = {0.0f, 0.0f, 0.0f};
+        std::string path;
+        float width = 0.0f;
+        float height = 0.0f;
+        float scale = 1.0f;
+        int frames = 1;
+        int index = -1;
+        std::vector<uint8_t> payload;
+    };
+
+    /**
+     * @brief Framing of messages on the socket
+     *
+     * Each frame is a 4-byte little-endian body size followed by the message
+     * type and its fields, encoded with BinaryWriter.
+     */
+    class Protocol
+    {
+        public:
+            static constexpr std::size_t HEADER_SIZE = 4;
+            static constexpr std::size_t MAX_FRAME_SIZE = 16 * 1024 * 1024;
+
+            static void encode(const Message &message, std::vector<uint8_t> &out);
+
+            /**
+             * @brief Decode the complete frames at the start of data
+             * @return Bytes consumed, or -1 if the stream is corrupt
+             */
+            static long decode(const uint8_t *data, std::size_t size, std::vector<Message> &out);
+
+        protected:
+        private:
+    };
+
+    constexpr const char *DEFAULT_SOCKET_PATH = "/tmp/isomaker_livelink.sock";
+
+    /**
+     * @brief Game side: listens on a Unix domain socket for one editor
+     *
+     * Everything is non-blocking; poll() is meant to be called between ticks
+     * and returns whatever arrived since the previous call. A new editor
+     * connection replaces the previous one.
+     */
+    class LiveLinkServer
+    {
+        public:
+            LiveLinkServer() = default;
+            ~LiveLinkServer();
+
+            LiveLinkServer(const LiveLinkServer &) = delete;
+            LiveLinkServer &operator=(const LiveLinkServer &) = delete;
+
+            bool listen(const std::string &path = DEFAULT_SOCKET_PATH);
+            void close();
+            bool isListening() const { return _listenFd != -1; };
+            bool hasClient() const { return _clientFd != -1; };
+
+            /**
+             * @brief Accept a waiting editor and append the complete messages received
+             */
+            void poll(std::vector<Message> &out);
+
+        protected:
+        private:
+            void dropClient();
+
+            std::string _path;
+            int _listenFd = -1;
+            int _clientFd = -1;
+            std::vector<uint8_t> _incoming;
+    };
+
+    /**
+     * @brief Editor side: pushes messages to a running game, reconnecting as needed
+     *
+     * Messages sent while no game is listening are dropped; the game reads the
+     * saved project when it starts, so only changes made while it runs matter.
+     */
+    class LiveLinkClient
+    {
+        public:
+            static constexpr std::chrono::milliseconds RETRY_INTERVAL{1000};
+
+            explicit LiveLinkClient(const std::string &path = DEFAULT_SOCKET_PATH);
+            ~LiveLinkClient();
+
+            LiveLinkClient(const LiveLinkClient &) = delete;
+            LiveLinkClient &operator=(const LiveLinkClient &) = delete;
+
+            /**
+             * @brief Retry the connection when due and flush what the socket could not take
+             */
+            void update();
+            bool isConnected() const { return _fd != -1; };
+            bool send(const Message &message);
+            void close();
+
+        protected:
+        private:
+            bool connect();
+            bool flush();
+
+            std::string _path;
+            int _fd = -1;
+            std::vector<uint8_t> _outgoing;
+            std::chrono::steady_clock::time_point _nextAttempt;
+    };
+}
@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** SkylinePacker
+*/
+
+#include "SkylinePacker.hpp"
+
+#include <algorithm>
+
+namespace Render
+{
+    SkylinePacker::SkylinePacker(int width, int height) : _width(width), _height(height)
+    {
+        _skyline.push_back({0, 0, width});
+    }
+
+    bool SkylinePacker::insert(int width, int height, int &x, int &y)
+    {
+        std::size_t best = _skyline.size();
+        int bestTop = _height + 1;
+
+        if (width <= 0 || height <= 0)
+            return false;
+        for (std::size_t segment = 0; segment < _skyline.size(); segment++) {
+            int top = fitAt(segment, width);
+            if (top == -1 || top + height > _height)
+                continue;
+            if (top + height < bestTop) {
+                bestTop = top + height;
+                best = segment;
+            }
+        }
+        if (best == _skyline.size())
+            return false;
+
+        x = _skyline[best].x;
+        y = bestTop - height;
+        _usedArea += static_cast<long long>(width) * height;
+
+        // The new segment covers the ones it was placed over, the last one may be cut
+        Segment placed = {x, bestTop, width};
+        std::size_t end = best;
+        while (end < _skyline.size() && _skyline[end].x + _skyline[end].width <= x + width)
+            end++;
+        if (end < _skyline.size() && _skyline[end].x < x + width) {
+            int cut = x + width - _skyline[end].x;
+            _skyline[end].x += cut;
+            _skyline[end].width -= cut;
+        }
+        _skyline.erase(_skyline.begin() + best, _skyline.begin() + end);
+        _skyline.insert(_skyline.begin() + best, placed);
+
+        // Neighbours at the same height become one segment
+        for (std::size_t segment = 0; segment + 1 < _skyline.size();) {
+            if (_skyline[segment].y == _skyline[segment + 1].y) {
+                _skyline[segment].width += _skyline[segment + 1].width;
+                _skyline.erase(_skyline.begin() + segment + 1);
+            } else {
+                segment++;
+            }
+        }
+        return true;
+    }
+
+    float SkylinePacker::getOccupancy() const
+    {
+        return static_cast<float>(_usedArea) / (static_cast<float>(_width) * _height);
+    }
+
+    int SkylinePacker::fitAt(std::size_t segment, int width) const
+    {
+        int x = _skyline[segment].x;
+        int top = 0;
+
+        if (x + width > _width)
+            return -1;
+        for (std::size_t next = segment; next < _skyline.size() && _skyline[next].x < x + width; next++)
+            top = std::max(top, _skyline[next].y);
+        return top;
+    }
+}
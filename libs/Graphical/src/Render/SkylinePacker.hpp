@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** SkylinePacker
+*/
+
+#pragma once
+
+#include <vector>
+
+namespace Render
+{
+    /**
+     * @brief Places rectangles in a fixed-size page, lowest spot first
+     *
+     * The page is described by its skyline: the top edge of what was placed
+     * so far, as horizontal segments. A rectangle goes where its top ends
+     * lowest, leftmost on ties. Feeding rectangles by decreasing height
+     * keeps the skyline flat and the waste low.
+     */
+    class SkylinePacker
+    {
+        public:
+            SkylinePacker(int width, int height);
+            ~SkylinePacker() = default;
+
+            /**
+             * @return false when the rectangle fits nowhere in the page
+             */
+            bool insert(int width, int height, int &x, int &y);
+
+            int getWidth() const { return _width; };
+            int getHeight() const { return _height; };
+            /**
+             * @brief Share of the page covered by the rectangles placed
+             */
+            float getOccupancy() const;
+
+        protected:
+        private:
+            struct Segment {
+                int x;
+                int y;
+                int width;
+            };
+
+            /**
+             * @return Top of the skyline under [x, x + width), or -1 past the page edge
+             */
+            int fitAt(std::size_t segment, int width) const;
+
+            int _width;
+            int _height;
+            long long _usedArea = 0;
+            std::vector<Segment> _skyline;
+    };
+}
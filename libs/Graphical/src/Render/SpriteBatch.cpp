@@ -0,0 +1,223 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** SpriteBatch
+*/
+
+#include "SpriteBatch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <raymath.h>
+#include <rlgl.h>
+
+namespace
+{
+    constexpr float NEAR_DEPTH = 0.01f;     ///< raylib's near plane
+    constexpr float MIN_TILT = 0.1f;        ///< Keeps sprites finite under a camera looking straight down
+}
+
+namespace Render
+{
+    void SpriteBatch::clear()
+    {
+        _x.clear();
+        _y.clear();
+        _z.clear();
+        _sources.clear();
+        _slots.clear();
+        _tints.clear();
+        _spins.clear();
+        _textures.clear();
+        _slotOfTexture.clear();
+        _order.clear();
+        _keys.clear();
+    }
+
+    void SpriteBatch::add(Texture2D texture, Rectangle source, Vector3 position)
+    {
+        add(texture, source, position, WHITE, 0.0f);
+    }
+
+    void SpriteBatch::add(Texture2D texture, Rectangle source, Vector3 position, Color tint, float spin)
+    {
+        if (texture.id == 0)
+            return;
+        _x.push_back(position.x);
+        _y.push_back(position.y);
+        _z.push_back(position.z);
+        _sources.push_back(source);
+        _slots.push_back(findTextureSlot(texture));
+        _tints.push_back(tint);
+        _spins.push_back(spin * DEG2RAD);
+    }
+
+    void SpriteBatch::prepare(const Camera3D &camera, Vector2 screenSize)
+    {
+        std::size_t count = _x.size();
+
+        _order.clear();
+        _keys.clear();
+        if (count == 0 || screenSize.x <= 0.0f || screenSize.y <= 0.0f)
+            return;
+
+        // One view transform for every sprite, over plain arrays so the loop vectorises
+        Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+        _viewX.resize(count);
+        _viewY.resize(count);
+        _depth.resize(count);
+        const float *x = _x.data();
+        const float *y = _y.data();
+        const float *z = _z.data();
+        float *viewX = _viewX.data();
+        float *viewY = _viewY.data();
+        float *depth = _depth.data();
+        for (std::size_t i = 0; i < count; i++) {
+            viewX[i] = view.m0 * x[i] + view.m4 * y[i] + view.m8 * z[i] + view.m12;
+            viewY[i] = view.m1 * x[i] + view.m5 * y[i] + view.m9 * z[i] + view.m13;
+            depth[i] = -(view.m2 * x[i] + view.m6 * y[i] + view.m10 * z[i] + view.m14);
+        }
+
+        // Quads stand upright and face the camera along the ground
+        _perspective = camera.projection == CAMERA_PERSPECTIVE;
+        float halfHeight = _perspective ? std::tan(camera.fovy * 0.5f * DEG2RAD) : camera.fovy * 0.5f;
+        float aspect = screenSize.x / screenSize.y;
+        float flatRight = std::hypot(view.m0, view.m8);
+        _pixelSize = 2.0f * halfHeight / screenSize.y;
+        _right = flatRight > 0.0f ? Vector3{view.m0 / flatRight, 0.0f, view.m8 / flatRight} : Vector3{1.0f, 0.0f, 0.0f};
+        _rise = 1.0f / std::max(view.m5, MIN_TILT);
+
+        float minDepth = std::numeric_limits<float>::max();
+        float maxDepth = std::numeric_limits<float>::lowest();
+        for (std::uint32_t i = 0; i < count; i++) {
+            if (depth[i] <= NEAR_DEPTH)
+                continue;
+            float distance = _perspective ? depth[i] : 1.0f;
+            float halfViewHeight = halfHeight * distance;
+            float halfViewWidth = halfViewHeight * aspect;
+            float halfWidth = std::fabs(_sources[i].width) * _pixelSize * distance * 0.5f;
+            float height = std::fabs(_sources[i].height) * _pixelSize * distance;
+            if (viewX[i] + halfWidth < -halfViewWidth || viewX[i] - halfWidth > halfViewWidth ||
+                viewY[i] + height < -halfViewHeight || viewY[i] > halfViewHeight)
+                continue;
+            _order.push_back(i);
+            minDepth = std::min(minDepth, depth[i]);
+            maxDepth = std::max(maxDepth, depth[i]);
+        }
+
+        // Far sprites get the small keys, the low half groups equal depths by texture
+        float range = maxDepth - minDepth;
+        float scale = range > 0.0f ? 65535.0f / range : 0.0f;
+        _keys.resize(_order.size());
+        for (std::size_t k = 0; k < _order.size(); k++) {
+            std::uint32_t i = _order[k];
+            std::uint32_t far = static_cast<std::uint32_t>((maxDepth - depth[i]) * scale);
+            _keys[k] = far << 16 | _slots[i];
+        }
+        sortKeys();
+    }
+
+    void SpriteBatch::submit()
+    {
+        unsigned int bound = 0;
+        std::size_t begin = 0;
+
+        _binds = 0;
+        while (begin < _order.size()) {
+            std::uint16_t slot = _slots[_order[begin]];
+            std::size_t end = begin + 1;
+            while (end < _order.size() && end - begin < MAX_RUN && _slots[_order[end]] == slot)
+                end++;
+
+            const Texture2D &texture = _textures[slot];
+            if (texture.id != bound) {
+                bound = texture.id;
+                _binds++;
+            }
+            rlCheckRenderBatchLimit(static_cast<int>(4 * (end - begin)));
+            rlSetTexture(texture.id);
+            rlBegin(RL_QUADS);
+            for (std::size_t k = begin; k < end; k++) {
+                std::uint32_t i = _order[k];
+                const Rectangle &source = _sources[i];
+                float distance = _perspective ? _depth[i] : 1.0f;
+                float halfWidth = std::fabs(source.width) * _pixelSize * distance * 0.5f;
+                float halfHeight = std::fabs(source.height) * _pixelSize * distance * 0.5f;
+                float u0 = source.x / texture.width;
+                float u1 = (source.x + source.width) / texture.width;
+                float v0 = source.y / texture.height;
+                float v1 = (source.y + source.height) / texture.height;
+
+                // Corners in screen-sized units across and up the frame, turned by the spin
+                float cosSpin = std::cos(_spins[i]);
+                float sinSpin = std::sin(_spins[i]);
+                float acrossX = halfWidth * cosSpin;
+                float acrossY = halfWidth * sinSpin;
+                float upX = -halfHeight * sinSpin;
+                float upY = halfHeight * cosSpin;
+                const float cornerX[4] = {-acrossX - upX, acrossX - upX, acrossX + upX, -acrossX + upX};
+                const float cornerY[4] = {-acrossY - upY, acrossY - upY, acrossY + upY, -acrossY + upY};
+                const float cornerU[4] = {u0, u1, u1, u0};
+                const float cornerV[4] = {v1, v1, v0, v0};
+                float centreY = _y[i] + halfHeight * _rise;
+
+                rlColor4ub(_tints[i].r, _tints[i].g, _tints[i].b, _tints[i].a);
+                // Counter-clockwise as seen from the camera
+                for (int corner = 0; corner < 4; corner++) {
+                    rlTexCoord2f(cornerU[corner], cornerV[corner]);
+                    rlVertex3f(_x[i] + _right.x * cornerX[corner], centreY + cornerY[corner] * _rise,
+                        _z[i] + _right.z * cornerX[corner]);
+                }
+            }
+            rlEnd();
+            begin = end;
+        }
+        rlSetTexture(0);
+    }
+
+    void SpriteBatch::draw(const Camera3D &camera)
+    {
+        prepare(camera, {static_cast<float>(GetScreenWidth()), static_cast<float>(GetScreenHeight())});
+        submit();
+    }
+
+    std::uint16_t SpriteBatch::findTextureSlot(Texture2D texture)
+    {
+        auto found = _slotOfTexture.find(texture.id);
+
+        if (found != _slotOfTexture.end())
+            return found->second;
+        std::uint16_t slot = static_cast<std::uint16_t>(_textures.size());
+        _textures.push_back(texture);
+        _slotOfTexture.emplace(texture.id, slot);
+        return slot;
+    }
+
+    void SpriteBatch::sortKeys()
+    {
+        std::size_t count = _keys.size();
+
+        _sortedKeys.resize(count);
+        _sortedOrder.resize(count);
+        for (int shift = 0; shift < 32 && count > 1; shift += 8) {
+            std::size_t offsets[257] = {};
+            for (std::uint32_t key : _keys)
+                offsets[((key >> shift) & 0xff) + 1]++;
+            // Every key has the same digit, this pass would move nothing
+            if (offsets[((_keys[0] >> shift) & 0xff) + 1] == count)
+                continue;
+            for (int digit = 0; digit < 256; digit++)
+                offsets[digit + 1] += offsets[digit];
+            for (std::size_t k = 0; k < count; k++) {
+                std::size_t slot = offsets[(_keys[k] >> shift) & 0xff]++;
+                _sortedKeys[slot] = _keys[k];
+                _sortedOrder[slot] = _order[k];
+            }
+            _keys.swap(_sortedKeys);
+            _order.swap(_sortedOrder);
+        }
+    }
+}
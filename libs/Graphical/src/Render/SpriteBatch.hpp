@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** SpriteBatch
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+
+namespace Render
+{
+    /**
+     * @brief Sprites drawn as upright quads in the 3D pass, sorted back to front
+     *
+     * Sprites are collected over the frame. prepare() moves all of them into
+     * view space in one pass over packed coordinate arrays, drops the ones
+     * outside the view and radix-sorts the rest by depth. submit() then
+     * sends each run of sprites sharing a texture as one quad stream.
+     *
+     * The depth test hides sprites behind blocks. Drawing back to front
+     * keeps transparent edges right where sprites overlap. Sprites at the
+     * same depth are grouped by texture.
+     *
+     * A sprite stands on its position, which is the bottom centre of the
+     * frame. It keeps the pixel size of its source rectangle on screen.
+     * A spun sprite turns about the centre of its frame instead.
+     */
+    class SpriteBatch
+    {
+        public:
+            static constexpr std::size_t MAX_RUN = 1024;       ///< Quads sent between two batch limit checks
+
+            SpriteBatch() = default;
+            ~SpriteBatch() = default;
+
+            void clear();
+            void add(Texture2D texture, Rectangle source, Vector3 position);
+            /**
+             * @param tint Multiplies the texture colours
+             * @param spin Degrees, counter-clockwise on screen about the centre of the quad
+             */
+            void add(Texture2D texture, Rectangle source, Vector3 position, Color tint, float spin);
+
+            /**
+             * @brief Project, cull and sort the sprites for the screen size
+             */
+            void prepare(const Camera3D &camera, Vector2 screenSize);
+
+            /**
+             * @brief Send the prepared sprites, between BeginMode3D and EndMode3D
+             */
+            void submit();
+
+            /**
+             * @brief prepare() for the current screen, then submit()
+             */
+            void draw(const Camera3D &camera);
+
+            std::size_t getSpriteCount() const { return _x.size(); };
+            /**
+             * @brief Sprites left after culling, back to front
+             */
+            const std::vector<std::uint32_t> &getOrder() const { return _order; };
+            std::size_t getTextureBindCount() const { return _binds; };
+
+        protected:
+        private:
+            std::uint16_t findTextureSlot(Texture2D texture);
+            void sortKeys();
+
+            // Sprites added this frame, coordinates packed per axis for the transform
+            std::vector<float> _x;
+            std::vector<float> _y;
+            std::vector<float> _z;
+            std::vector<Rectangle> _sources;
+            std::vector<std::uint16_t> _slots;
+            std::vector<Color> _tints;
+            std::vector<float> _spins;      ///< Radians
+            std::vector<Texture2D> _textures;
+            std::unordered_map<unsigned int, std::uint16_t> _slotOfTexture;
+
+            // Filled by prepare()
+            std::vector<float> _viewX;
+            std::vector<float> _viewY;
+            std::vector<float> _depth;
+            std::vector<std::uint32_t> _keys;
+            std::vector<std::uint32_t> _order;
+            std::vector<std::uint32_t> _sortedKeys;
+            std::vector<std::uint32_t> _sortedOrder;
+            float _pixelSize = 0.0f;        ///< World units per pixel, at unit depth for a perspective camera
+            bool _perspective = false;
+            Vector3 _right = {1.0f, 0.0f, 0.0f};
+            float _rise = 1.0f;             ///< World height per unit of screen height
+
+            std::size_t _binds = 0;
+    };
+}
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** TextureAtlas
+*/
+
+#include "TextureAtlas.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+#include "SkylinePacker.hpp"
+
+namespace Render
+{
+    TextureAtlas::TextureAtlas(int pageSize) : _pageSize(pageSize)
+    {
+    }
+
+    void TextureAtlas::add(const std::string &fileName)
+    {
+        if (std::find(_pending.begin(), _pending.end(), fileName) == _pending.end())
+            _pending.push_back(fileName);
+    }
+
+    void TextureAtlas::build()
+    {
+        std::vector<Image> images;
+        std::vector<Vector2> sizes;
+
+        for (const Texture2D &page : _pages)
+            UnloadTexture(page);
+        _pages.clear();
+        _regions.clear();
+        for (const std::string &fileName : _pending) {
+            images.push_back(LoadImage(fileName.c_str()));
+            if (images.back().data == nullptr)
+                sizes.push_back({0.0f, 0.0f});
+            else
+                sizes.push_back({static_cast<float>(images.back().width), static_cast<float>(images.back().height)});
+        }
+
+        std::vector<Region> regions = layout(sizes, _pageSize);
+        int pageCount = 0;
+        for (const Region &region : regions)
+            pageCount = std::max(pageCount, region.page + 1);
+
+        for (int page = 0; page < pageCount; page++) {
+            // Pages only take the space their sheets use
+            int width = 1;
+            int height = 1;
+            for (std::size_t i = 0; i < regions.size(); i++) {
+                if (regions[i].page != page)
+                    continue;
+                width = std::max(width, regions[i].x + images[i].width);
+                height = std::max(height, regions[i].y + images[i].height);
+            }
+            Image pageImage = GenImageColor(width, height, BLANK);
+            for (std::size_t i = 0; i < regions.size(); i++) {
+                if (regions[i].page != page)
+                    continue;
+                Rectangle source = {0.0f, 0.0f, sizes[i].x, sizes[i].y};
+                Rectangle destination = {static_cast<float>(regions[i].x), static_cast<float>(regions[i].y), sizes[i].x, sizes[i].y};
+                ImageDraw(&pageImage, images[i], source, destination, WHITE);
+                _regions[_pending[i]] = regions[i];
+            }
+            _pages.push_back(LoadTextureFromImage(pageImage));
+            UnloadImage(pageImage);
+        }
+        for (const Image &image : images) {
+            if (image.data != nullptr)
+                UnloadImage(image);
+        }
+        std::cout << "[TextureAtlas] " << _regions.size() << " of " << _pending.size() << " sheets in " << _pages.size() << " pages" << std::endl;
+    }
+
+    void TextureAtlas::unload()
+    {
+        for (const Texture2D &page : _pages)
+            UnloadTexture(page);
+        _pages.clear();
+        _regions.clear();
+        _pending.clear();
+    }
+
+    bool TextureAtlas::find(const std::string &fileName, Texture2D &texture, Vector2 &origin) const
+    {
+        auto found = _regions.find(fileName);
+
+        if (found == _regions.end() || _pages[found->second.page].id == 0)
+            return false;
+        texture = _pages[found->second.page];
+        origin = {static_cast<float>(found->second.x), static_cast<float>(found->second.y)};
+        return true;
+    }
+
+    std::vector<TextureAtlas::Region> TextureAtlas::layout(const std::vector<Vector2> &sizes, int pageSize)
+    {
+        std::vector<Region> regions(sizes.size());
+        std::vector<std::size_t> order(sizes.size());
+        std::vector<SkylinePacker> packers;
+
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+            if (sizes[a].y != sizes[b].y)
+                return sizes[a].y > sizes[b].y;
+            return sizes[a].x > sizes[b].x;
+        });
+        for (std::size_t i : order) {
+            int width = static_cast<int>(sizes[i].x);
+            int height = static_cast<int>(sizes[i].y);
+            int x = 0;
+            int y = 0;
+            if (width <= 0 || height <= 0 || width + PADDING > pageSize || height + PADDING > pageSize)
+                continue;
+            for (std::size_t page = 0; page < packers.size() && regions[i].page == -1; page++) {
+                if (packers[page].insert(width + PADDING, height + PADDING, x, y))
+                    regions[i] = {static_cast<int>(page), x, y};
+            }
+            if (regions[i].page == -1) {
+                packers.emplace_back(pageSize, pageSize);
+                packers.back().insert(width + PADDING, height + PADDING, x, y);
+                regions[i] = {static_cast<int>(packers.size()) - 1, x, y};
+            }
+        }
+        return regions;
+    }
+}
@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** TextureAtlas
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+
+namespace Render
+{
+    /**
+     * @brief Sprite sheets packed into a few large textures
+     *
+     * Sheets are queued by file name, then build() loads them, packs them
+     * by decreasing height with a SkylinePacker and uploads one texture per
+     * page. Sprites drawn from the pages share their texture, so the sprite
+     * batch sends them as one run.
+     *
+     * A sheet larger than a page, or one that fails to load, gets no region
+     * and keeps its own texture.
+     */
+    class TextureAtlas
+    {
+        public:
+            static constexpr int DEFAULT_PAGE_SIZE = 2048;
+            static constexpr int PADDING = 1;      ///< Transparent pixels between sheets, so filtering does not bleed
+
+            struct Region {
+                int page = -1;          ///< -1 when the sheet was left out
+                int x = 0;
+                int y = 0;
+            };
+
+            explicit TextureAtlas(int pageSize = DEFAULT_PAGE_SIZE);
+            ~TextureAtlas() = default;
+
+            void add(const std::string &fileName);
+            /**
+             * @brief Load and pack every sheet added, replacing the pages built before
+             */
+            void build();
+            /**
+             * @brief Free the pages and forget every sheet
+             */
+            void unload();
+
+            /**
+             * @brief Page and top-left corner of a sheet in it
+             *
+             * @return false if the sheet is not in the atlas
+             */
+            bool find(const std::string &fileName, Texture2D &texture, Vector2 &origin) const;
+
+            /**
+             * @brief Where sheets of the given sizes go, one region per size
+             *
+             * Tallest sheets are placed first, each in the first page it
+             * fits. Pages are opened as needed.
+             */
+            static std::vector<Region> layout(const std::vector<Vector2> &sizes, int pageSize);
+
+            std::size_t getPageCount() const { return _pages.size(); };
+
+        protected:
+        private:
+            int _pageSize;
+            std::vector<std::string> _pending;
+            std::unordered_map<std::string, Region> _regions;
+            std::vector<Texture2D> _pages;
+    };
+}
@@ -0,0 +1,173 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** BinaryStream
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace scripting
+{
+    /**
+     * @brief Appends little-endian primitives to a byte buffer
+     *
+     * Integers are written as LEB128 varints (signed ones zigzag-encoded),
+     * floats as raw IEEE-754 bits and strings as a varint length followed
+     * by the bytes.
+     */
+    class BinaryWriter
+    {
+        public:
+            explicit BinaryWriter(std::vector<uint8_t> &buffer) : _buffer(buffer) {}
+            ~BinaryWriter() = default;
+
+            void writeBytes(const void *data, std::size_t size)
+            {
+                const uint8_t *bytes = static_cast<const uint8_t *>(data);
+                _buffer.insert(_buffer.end(), bytes, bytes + size);
+            }
+
+            void writeU8(uint8_t value) { _buffer.push_back(value); }
+
+            void writeVarUInt(uint64_t value)
+            {
+                while (value >= 0x80) {
+                    _buffer.push_back(static_cast<uint8_t>(value | 0x80));
+                    value >>= 7;
+                }
+                _buffer.push_back(static_cast<uint8_t>(value));
+            }
+
+            void writeVarInt(int64_t value)
+            {
+                writeVarUInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+            }
+
+            void writeFloat(float value)
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                for (int i = 0; i < 4; i++)
+                    _buffer.push_back(static_cast<uint8_t>(bits >> (i * 8)));
+            }
+
+            void writeString(const std::string &value)
+            {
+                writeVarUInt(value.size());
+                writeBytes(value.data(), value.size());
+            }
+
+        protected:
+        private:
+            std::vector<uint8_t> &_buffer;
+    };
+
+    /**
+     * @brief Reads what BinaryWriter produced, without copying the buffer
+     *
+     * Reads past the end never touch memory: they return zero values and
+     * latch the failed state, so callers only need to check isGood() once
+     * at the end.
+     */
+    class BinaryReader
+    {
+        public:
+            BinaryReader(const uint8_t *data, std::size_t size) : _data(data), _size(size) {}
+            ~BinaryReader() = default;
+
+            bool readBytes(void *out, std::size_t size)
+            {
+                if (!_good || _size - _offset < size) {
+                    _good = false;
+                    return false;
+                }
+                std::memcpy(out, _data + _offset, size);
+                _offset += size;
+                return true;
+            }
+
+            uint8_t readU8()
+            {
+                if (!_good || _offset >= _size) {
+                    _good = false;
+                    return 0;
+                }
+                return _data[_offset++];
+            }
+
+            uint64_t readVarUInt()
+            {
+                uint64_t value = 0;
+                for (int shift = 0; shift < 64; shift += 7) {
+                    uint8_t byte = readU8();
+                    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                    if (!(byte & 0x80))
+                        return value;
+                }
+                _good = false;
+                return 0;
+            }
+
+            int64_t readVarInt()
+            {
+                uint64_t value = readVarUInt();
+                return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+            }
+
+            float readFloat()
+            {
+                uint8_t bytes[4] = {0, 0, 0, 0};
+                readBytes(bytes, sizeof(bytes));
+                uint32_t bits = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+                    (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            void readString(std::string &out)
+            {
+                uint64_t length = readVarUInt();
+                if (!_good || _size - _offset < length) {
+                    _good = false;
+                    out.clear();
+                    return;
+                }
+                out.assign(reinterpret_cast<const char *>(_data + _offset), static_cast<std::size_t>(length));
+                _offset += static_cast<std::size_t>(length);
+            }
+
+            /**
+             * @brief Read an element count, rejecting counts the remaining bytes cannot hold
+             * @param minElementSize Smallest encoded size of one element
+             */
+            std::size_t readCount(std::size_t minElementSize = 1)
+            {
+                uint64_t count = readVarUInt();
+                if (!_good || (minElementSize > 0 && count > (_size - _offset) / minElementSize)) {
+                    _good = false;
+                    return 0;
+                }
+                return static_cast<std::size_t>(count);
+            }
+
+            void fail() { _good = false; }   ///< Latch the failed state on malformed content
+            bool isGood() const { return _good; }
+            bool isAtEnd() const { return _offset == _size; }
+            std::size_t getOffset() const { return _offset; }
+
+        protected:
+        private:
+            const uint8_t *_data;
+            std::size_t _size;
+            std::size_t _offset = 0;
+            bool _good = true;
+    };
+}
@@ -0,0 +1,425 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** BlockConfig
+*/
+
+#include "BlockConfig.hpp"
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    constexpr std::size_t BLOCK_TYPE_COUNT = static_cast<std::size_t>(BlockType::LOG) + 1;
+
+    struct NameTable {
+        std::mutex mutex;
+        std::deque<std::string> names;                          ///< Stable addresses, indexed by ParamId
+        std::unordered_map<std::string_view, ParamId> ids;      ///< Views into names
+    };
+
+    NameTable &getNameTable()
+    {
+        static NameTable table;
+        return table;
+    }
+
+    const std::string &emptyString()
+    {
+        static const std::string empty;
+        return empty;
+    }
+
+    bool sameValue(const ParamSlot &a, const std::string &textA, const ParamSlot &b, const std::string &textB)
+    {
+        switch (a.type) {
+            case ParamType::FLOAT:
+                return a.value.x == b.value.x;
+            case ParamType::BOOL:
+                return (a.value.x != 0.0f) == (b.value.x != 0.0f);
+            case ParamType::VECTOR:
+                return a.value.x == b.value.x && a.value.y == b.value.y && a.value.z == b.value.z;
+            case ParamType::STRING:
+                return textA == textB;
+        }
+        return false;
+    }
+
+    void hashCombine(std::size_t &seed, std::size_t value)
+    {
+        seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    }
+}
+
+ParamId ParamNames::intern(std::string_view name)
+{
+    NameTable &table = getNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.ids.find(name);
+    if (it != table.ids.end())
+        return it->second;
+    if (table.names.size() >= INVALID)
+        return INVALID;
+
+    ParamId id = static_cast<ParamId>(table.names.size());
+    table.names.emplace_back(name);
+    table.ids.emplace(table.names.back(), id);
+    return id;
+}
+
+ParamId ParamNames::find(std::string_view name)
+{
+    NameTable &table = getNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.ids.find(name);
+    return it != table.ids.end() ? it->second : INVALID;
+}
+
+const std::string &ParamNames::get(ParamId id)
+{
+    NameTable &table = getNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    return id < table.names.size() ? table.names[id] : emptyString();
+}
+
+/**
+ * @brief Declared parameters of every block type
+ *
+ * The order of each list is the slot order, and must match the indices in
+ * BlockParams.
+ */
+BlockParamLayout BlockParamLayout::build(BlockType type)
+{
+    BlockParamLayout layout;
+    auto add = [&layout](std::string_view name, ParamType paramType, Vector3 value, std::string text = {}) {
+        layout._params.push_back({ParamNames::intern(name), paramType, value, std::move(text)});
+    };
+
+    switch (type) {
+        case BlockType::ON_KEY_PRESS:
+            add("key", ParamType::STRING, {}, "Space");
+            break;
+        case BlockType::MOVE:
+            add("direction", ParamType::VECTOR, {1.0f, 0.0f, 0.0f});
+            add("speed", ParamType::FLOAT, {1.0f, 0.0f, 0.0f});
+            break;
+        case BlockType::ROTATE:
+            add("axis", ParamType::VECTOR, {0.0f, 1.0f, 0.0f});
+            add("speed", ParamType::FLOAT, {90.0f, 0.0f, 0.0f});
+            break;
+        case BlockType::CHANGE_COLOR:
+            add("color", ParamType::VECTOR, {1.0f, 0.0f, 0.0f});
+            add("duration", ParamType::FLOAT, {0.5f, 0.0f, 0.0f});
+            break;
+        case BlockType::DELAY:
+            add("duration", ParamType::FLOAT, {1.0f, 0.0f, 0.0f});
+            break;
+        case BlockType::VALUE:
+            add("value", ParamType::FLOAT, {0.0f, 0.0f, 0.0f});
+            break;
+        case BlockType::LOG:
+            add("message", ParamType::STRING, {}, "Debug message");
+            break;
+        case BlockType::LOOP:
+            add("iterations", ParamType::FLOAT, {5.0f, 0.0f, 0.0f});
+            break;
+        default:
+            break;
+    }
+    return layout;
+}
+
+const BlockParamLayout &BlockParamLayout::get(BlockType type)
+{
+    static const std::array<BlockParamLayout, BLOCK_TYPE_COUNT> layouts = [] {
+        std::array<BlockParamLayout, BLOCK_TYPE_COUNT> result;
+        for (std::size_t i = 0; i < BLOCK_TYPE_COUNT; i++)
+            result[i] = build(static_cast<BlockType>(i));
+        return result;
+    }();
+    static const BlockParamLayout empty;
+
+    std::size_t index = static_cast<std::size_t>(type);
+    return index < BLOCK_TYPE_COUNT ? layouts[index] : empty;
+}
+
+int BlockParamLayout::findSlot(ParamId key) const
+{
+    for (std::size_t i = 0; i < _params.size(); i++) {
+        if (_params[i].key == key)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+BlockConfig BlockConfig::forType(BlockType type)
+{
+    const BlockParamLayout &layout = BlockParamLayout::get(type);
+    BlockConfig config;
+
+    config._slots.reserve(layout.size());
+    for (std::size_t i = 0; i < layout.size(); i++) {
+        const BlockParamLayout::Param &param = layout[i];
+        ParamSlot slot{param.key, param.type};
+        if (param.type == ParamType::STRING) {
+            slot.text = static_cast<uint32_t>(config._texts.size());
+            config._texts.push_back(param.text);
+        } else {
+            slot.value = param.value;
+        }
+        config._slots.push_back(slot);
+    }
+    return config;
+}
+
+void BlockConfig::conformTo(BlockType type)
+{
+    const BlockParamLayout &layout = BlockParamLayout::get(type);
+
+    bool conforming = _slots.size() >= layout.size();
+    for (std::size_t i = 0; conforming && i < layout.size(); i++)
+        conforming = _slots[i].key == layout[i].key && _slots[i].type == layout[i].type;
+    if (conforming)
+        return;
+
+    // Start from the defaults and take over every stored value the layout
+    // agrees on; a value stored with another type keeps the default
+    BlockConfig result = forType(type);
+    for (std::size_t i = 0; i < _slots.size(); i++) {
+        const ParamSlot &slot = _slots[i];
+        int target = layout.findSlot(slot.key);
+        if (target != -1 && layout[target].type != slot.type)
+            continue;
+        if (target == -1) {
+            target = static_cast<int>(result._slots.size());
+            result._slots.push_back({slot.key, slot.type});
+            if (slot.type == ParamType::STRING) {
+                result._slots.back().text = static_cast<uint32_t>(result._texts.size());
+                result._texts.emplace_back();
+            }
+        }
+        if (slot.type == ParamType::STRING)
+            result._texts[result._slots[target].text] = _texts[slot.text];
+        else
+            result._slots[target].value = slot.value;
+    }
+    *this = std::move(result);
+}
+
+void BlockConfig::merge(const BlockConfig &other)
+{
+    for (const ParamSlot &slot : other._slots) {
+        const std::string &name = ParamNames::get(slot.key);
+        switch (slot.type) {
+            case ParamType::FLOAT:
+                setFloat(name, slot.value.x);
+                break;
+            case ParamType::VECTOR:
+                setVector(name, slot.value);
+                break;
+            case ParamType::STRING:
+                setString(name, other._texts[slot.text]);
+                break;
+            case ParamType::BOOL:
+                setBool(name, slot.value.x != 0.0f);
+                break;
+        }
+    }
+}
+
+bool BlockConfig::hasSlot(int slot, ParamType type) const
+{
+    return slot >= 0 && static_cast<std::size_t>(slot) < _slots.size() && _slots[slot].type == type;
+}
+
+int BlockConfig::findSlot(ParamId key) const
+{
+    for (std::size_t i = 0; i < _slots.size(); i++) {
+        if (_slots[i].key == key)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+int BlockConfig::findSlot(std::string_view key) const
+{
+    ParamId id = ParamNames::find(key);
+    return id != ParamNames::INVALID ? findSlot(id) : -1;
+}
+
+int BlockConfig::findSlot(std::string_view key, ParamType type) const
+{
+    int slot = findSlot(key);
+    return hasSlot(slot, type) ? slot : -1;
+}
+
+float BlockConfig::getFloat(int slot) const
+{
+    return hasSlot(slot, ParamType::FLOAT) ? _slots[slot].value.x : 0.0f;
+}
+
+Vector3 BlockConfig::getVector(int slot) const
+{
+    return hasSlot(slot, ParamType::VECTOR) ? _slots[slot].value : Vector3{0.0f, 0.0f, 0.0f};
+}
+
+const std::string &BlockConfig::getString(int slot) const
+{
+    return hasSlot(slot, ParamType::STRING) ? _texts[_slots[slot].text] : emptyString();
+}
+
+bool BlockConfig::getBool(int slot) const
+{
+    return hasSlot(slot, ParamType::BOOL) && _slots[slot].value.x != 0.0f;
+}
+
+void BlockConfig::setFloat(int slot, float value)
+{
+    if (hasSlot(slot, ParamType::FLOAT))
+        _slots[slot].value.x = value;
+}
+
+void BlockConfig::setVector(int slot, Vector3 value)
+{
+    if (hasSlot(slot, ParamType::VECTOR))
+        _slots[slot].value = value;
+}
+
+void BlockConfig::setString(int slot, const std::string &value)
+{
+    if (hasSlot(slot, ParamType::STRING))
+        _texts[_slots[slot].text] = value;
+}
+
+void BlockConfig::setBool(int slot, bool value)
+{
+    if (hasSlot(slot, ParamType::BOOL))
+        _slots[slot].value.x = value ? 1.0f : 0.0f;
+}
+
+float BlockConfig::getFloat(std::string_view key, float fallback) const
+{
+    int slot = findSlot(key, ParamType::FLOAT);
+    return slot != -1 ? _slots[slot].value.x : fallback;
+}
+
+Vector3 BlockConfig::getVector(std::string_view key, Vector3 fallback) const
+{
+    int slot = findSlot(key, ParamType::VECTOR);
+    return slot != -1 ? _slots[slot].value : fallback;
+}
+
+std::string BlockConfig::getString(std::string_view key, const std::string &fallback) const
+{
+    int slot = findSlot(key, ParamType::STRING);
+    return slot != -1 ? _texts[_slots[slot].text] : fallback;
+}
+
+bool BlockConfig::getBool(std::string_view key, bool fallback) const
+{
+    int slot = findSlot(key, ParamType::BOOL);
+    return slot != -1 ? _slots[slot].value.x != 0.0f : fallback;
+}
+
+void BlockConfig::setFloat(std::string_view key, float value)
+{
+    slotFor(key, ParamType::FLOAT).value.x = value;
+}
+
+void BlockConfig::setVector(std::string_view key, Vector3 value)
+{
+    slotFor(key, ParamType::VECTOR).value = value;
+}
+
+void BlockConfig::setString(std::string_view key, std::string value)
+{
+    _texts[slotFor(key, ParamType::STRING).text] = std::move(value);
+}
+
+void BlockConfig::setBool(std::string_view key, bool value)
+{
+    slotFor(key, ParamType::BOOL).value.x = value ? 1.0f : 0.0f;
+}
+
+ParamSlot &BlockConfig::slotFor(std::string_view key, ParamType type)
+{
+    ParamId id = ParamNames::intern(key);
+    int index = findSlot(id);
+
+    if (index == -1) {
+        index = static_cast<int>(_slots.size());
+        _slots.push_back({id, type});
+    } else if (_slots[index].type == type) {
+        return _slots[index];
+    }
+
+    // New parameter, or one whose type changed: reset it to the new type
+    ParamSlot &slot = _slots[index];
+    slot.type = type;
+    slot.value = {0.0f, 0.0f, 0.0f};
+    if (type == ParamType::STRING) {
+        slot.text = static_cast<uint32_t>(_texts.size());
+        _texts.emplace_back();
+    }
+    return slot;
+}
+
+// Slots are matched by key rather than position, since parameters the
+// layout does not declare may have been added in any order
+bool BlockConfig::operator==(const BlockConfig &other) const
+{
+    if (_slots.size() != other._slots.size())
+        return false;
+    for (std::size_t i = 0; i < _slots.size(); i++) {
+        const ParamSlot &slot = _slots[i];
+        int match = other._slots[i].key == slot.key ? static_cast<int>(i) : other.findSlot(slot.key);
+        if (match == -1 || other._slots[match].type != slot.type)
+            return false;
+
+        const ParamSlot &otherSlot = other._slots[match];
+        const std::string &text = slot.type == ParamType::STRING ? _texts[slot.text] : emptyString();
+        const std::string &otherText = slot.type == ParamType::STRING ? other._texts[otherSlot.text] : emptyString();
+        if (!sameValue(slot, text, otherSlot, otherText))
+            return false;
+    }
+    return true;
+}
+
+// Each slot is hashed on its own and summed so the result does not depend
+// on slot order, matching operator==
+std::size_t BlockConfig::hash() const
+{
+    std::hash<float> hashFloat;
+    std::size_t result = 0;
+
+    for (const ParamSlot &slot : _slots) {
+        std::size_t entry = slot.key;
+        hashCombine(entry, static_cast<std::size_t>(slot.type));
+        switch (slot.type) {
+            case ParamType::FLOAT:
+                hashCombine(entry, hashFloat(slot.value.x));
+                break;
+            case ParamType::BOOL:
+                hashCombine(entry, slot.value.x != 0.0f ? 1 : 2);
+                break;
+            case ParamType::VECTOR:
+                hashCombine(entry, hashFloat(slot.value.x));
+                hashCombine(entry, hashFloat(slot.value.y));
+                hashCombine(entry, hashFloat(slot.value.z));
+                break;
+            case ParamType::STRING:
+                hashCombine(entry, std::hash<std::string>()(_texts[slot.text]));
+                break;
+        }
+        result += entry;
+    }
+    return result;
+}
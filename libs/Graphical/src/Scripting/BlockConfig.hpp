@@ -0,0 +1,198 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** BlockConfig
+*/
+
+#pragma once
+
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Block types for visual scripting
+ */
+enum class BlockType {
+    INVALID,      ///< Invalid/not found marker
+
+    ON_START,
+    ON_CLICK,
+    ON_UPDATE,
+    ON_KEY_PRESS,
+
+    MOVE,
+    ROTATE,
+    CHANGE_COLOR,
+    HIDE,
+    SHOW,
+
+    IF,
+    LOOP,
+
+    TRUE,
+    FALSE,
+    VALUE,
+    ENTITY,
+    DELAY,
+    LOG
+};
+
+/**
+ * @brief Value type stored in a parameter slot
+ */
+enum class ParamType : uint8_t {
+    FLOAT,
+    VECTOR,
+    STRING,
+    BOOL
+};
+
+using ParamId = uint16_t;   ///< Interned parameter name
+
+/**
+ * @brief Process-wide table of parameter names
+ *
+ * Each distinct name is stored once and referred to by a small integer, so
+ * configs compare and hash keys without touching strings. Safe to use from
+ * several threads.
+ */
+class ParamNames
+{
+    public:
+        static constexpr ParamId INVALID = 0xFFFF;
+
+        static ParamId intern(std::string_view name);
+        static ParamId find(std::string_view name);   ///< INVALID if the name was never interned
+        static const std::string &get(ParamId id);
+};
+
+/**
+ * @brief Slot indices of each block type's parameters
+ *
+ * Fixed by BlockParamLayout; a config that went through
+ * BlockConfig::conformTo() can be read with these directly.
+ */
+namespace BlockParams
+{
+    constexpr int KEY_PRESS_KEY = 0;
+    constexpr int MOVE_DIRECTION = 0;
+    constexpr int MOVE_SPEED = 1;
+    constexpr int ROTATE_AXIS = 0;
+    constexpr int ROTATE_SPEED = 1;
+    constexpr int CHANGE_COLOR_COLOR = 0;
+    constexpr int CHANGE_COLOR_DURATION = 1;
+    constexpr int DELAY_DURATION = 0;
+    constexpr int VALUE_VALUE = 0;
+    constexpr int LOG_MESSAGE = 0;
+    constexpr int LOOP_ITERATIONS = 0;
+}
+
+/**
+ * @brief Parameters a block type declares, in slot order, with their defaults
+ *
+ * The one place block defaults are written: new blocks, conformTo() and
+ * the editor's configuration fields all read them from here.
+ */
+class BlockParamLayout
+{
+    public:
+        struct Param {
+            ParamId key;
+            ParamType type;
+            Vector3 value;          ///< Default for FLOAT (x), BOOL (x != 0) and VECTOR
+            std::string text;       ///< Default for STRING
+        };
+
+        static const BlockParamLayout &get(BlockType type);
+
+        std::size_t size() const { return _params.size(); }
+        const Param &operator[](std::size_t slot) const { return _params[slot]; }
+        int findSlot(ParamId key) const;
+
+    protected:
+    private:
+        static BlockParamLayout build(BlockType type);
+
+        std::vector<Param> _params;
+};
+
+/**
+ * @brief One typed parameter of a BlockConfig
+ */
+struct ParamSlot {
+    ParamId key;
+    ParamType type;
+    uint32_t text = 0;                  ///< Index into the config's string table (STRING)
+    Vector3 value = {0.0f, 0.0f, 0.0f}; ///< FLOAT uses x, BOOL uses x != 0
+};
+
+/**
+ * @brief Block configuration parameters
+ *
+ * A flat array of typed slots keyed by interned names. Configs built with
+ * forType() or passed through conformTo() hold their type's declared
+ * parameters at the BlockParams slot indices, so reading them is an array
+ * access; parameters the layout does not know about follow after those.
+ */
+class BlockConfig
+{
+    public:
+        BlockConfig() = default;
+
+        static BlockConfig forType(BlockType type);
+
+        /**
+         * @brief Reorder into the type's layout, filling missing parameters with defaults
+         */
+        void conformTo(BlockType type);
+
+        /**
+         * @brief Overwrite parameters with the ones set in other, adding those missing
+         */
+        void merge(const BlockConfig &other);
+
+        std::size_t size() const { return _slots.size(); }
+        bool empty() const { return _slots.empty(); }
+        const ParamSlot &getSlot(int slot) const { return _slots[slot]; }
+        const std::string &getName(int slot) const { return ParamNames::get(_slots[slot].key); }
+        bool hasSlot(int slot, ParamType type) const;
+        int findSlot(ParamId key) const;
+        int findSlot(std::string_view key) const;
+
+        float getFloat(int slot) const;
+        Vector3 getVector(int slot) const;
+        const std::string &getString(int slot) const;
+        bool getBool(int slot) const;
+
+        void setFloat(int slot, float value);
+        void setVector(int slot, Vector3 value);
+        void setString(int slot, const std::string &value);
+        void setBool(int slot, bool value);
+
+        float getFloat(std::string_view key, float fallback) const;
+        Vector3 getVector(std::string_view key, Vector3 fallback) const;
+        std::string getString(std::string_view key, const std::string &fallback) const;
+        bool getBool(std::string_view key, bool fallback) const;
+
+        void setFloat(std::string_view key, float value);
+        void setVector(std::string_view key, Vector3 value);
+        void setString(std::string_view key, std::string value);
+        void setBool(std::string_view key, bool value);
+
+        bool operator==(const BlockConfig &other) const;
+        bool operator!=(const BlockConfig &other) const { return !(*this == other); }
+        std::size_t hash() const;
+
+    protected:
+    private:
+        int findSlot(std::string_view key, ParamType type) const;
+        ParamSlot &slotFor(std::string_view key, ParamType type);
+
+        std::vector<ParamSlot> _slots;
+        std::vector<std::string> _texts;    ///< Values of STRING slots
+};
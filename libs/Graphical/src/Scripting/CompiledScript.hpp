@@ -0,0 +1,57 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** CompiledScript
+*/
+
+#pragma once
+
+#include "BlockConfig.hpp"
+#include <vector>
+#include <string>
+
+/**
+ * @brief Compiled script node for runtime execution
+ */
+struct CompiledScriptNode {
+    int blockId;                            ///< Original block ID
+    BlockType blockType;                    ///< Type of block
+    BlockConfig config;                     ///< Block configuration parameters
+    std::vector<int> nextNodes;             ///< IDs of next nodes to execute
+    int trueNextNode = -1;                  ///< Next node for true branch (conditions)
+    int falseNextNode = -1;                 ///< Next node for false branch (conditions)
+    int loopBodyNode = -1;                  ///< First node of the loop body (LOOP blocks)
+    std::vector<int> valueInputs;           ///< IDs of value blocks feeding this node, by input port
+    bool isEntryPoint = false;              ///< Whether this is a script entry point
+
+    CompiledScriptNode(int id, BlockType type, const BlockConfig& cfg = {})
+        : blockId(id), blockType(type), config(cfg) {}
+};
+
+/**
+ * @brief Compiled script flow for runtime execution
+ */
+struct CompiledScript {
+    int objectId;                           ///< Associated scene object ID
+    std::string name;                       ///< Script name
+    std::vector<CompiledScriptNode> nodes;  ///< Execution nodes in topological order
+    std::vector<int> entryPoints;           ///< Entry point node IDs (OnStart, OnClick, etc.)
+    bool isValid = false;                   ///< Whether compilation was successful
+    std::string errors;                     ///< Compilation error messages
+
+    CompiledScript(int objId, const std::string& scriptName = "New Script")
+        : objectId(objId), name(scriptName) {}
+};
+
+/**
+ * @brief Check whether a block type starts an execution flow on its own
+ *
+ * @param type Block type to test
+ * @return true for OnStart, OnClick, OnUpdate and OnKeyPress
+ */
+inline bool isEventBlock(BlockType type)
+{
+    return type == BlockType::ON_START || type == BlockType::ON_CLICK ||
+           type == BlockType::ON_UPDATE || type == BlockType::ON_KEY_PRESS;
+}
@@ -0,0 +1,221 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** CompiledScriptIO
+*/
+
+#include "CompiledScriptIO.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace scripting
+{
+    namespace
+    {
+        constexpr char MAGIC[4] = {'I', 'S', 'C', 'S'};
+        constexpr uint8_t MAX_BLOCK_TYPE = static_cast<uint8_t>(BlockType::LOG);
+
+        constexpr uint8_t MAX_PARAM_TYPE = static_cast<uint8_t>(ParamType::BOOL);
+
+        void writeIds(BinaryWriter &writer, const std::vector<int> &ids)
+        {
+            writer.writeVarUInt(ids.size());
+            for (int id : ids)
+                writer.writeVarInt(id);
+        }
+
+        void readIds(BinaryReader &reader, std::vector<int> &ids)
+        {
+            std::size_t count = reader.readCount();
+            ids.resize(count);
+            for (std::size_t i = 0; i < count; i++)
+                ids[i] = static_cast<int>(reader.readVarInt());
+        }
+    }
+
+    // Parameters are written by name, sorted so identical configs encode to
+    // identical bytes; readers re-resolve them against their own layout
+    void CompiledScriptIO::writeConfig(BinaryWriter &writer, const BlockConfig &config)
+    {
+        std::vector<int> order(config.size());
+        for (std::size_t i = 0; i < order.size(); i++)
+            order[i] = static_cast<int>(i);
+        std::sort(order.begin(), order.end(), [&config](int a, int b) {
+            return config.getName(a) < config.getName(b);
+        });
+
+        writer.writeVarUInt(order.size());
+        for (int slot : order) {
+            const ParamSlot &param = config.getSlot(slot);
+            writer.writeString(config.getName(slot));
+            writer.writeU8(static_cast<uint8_t>(param.type));
+            switch (param.type) {
+                case ParamType::FLOAT:
+                    writer.writeFloat(param.value.x);
+                    break;
+                case ParamType::VECTOR:
+                    writer.writeFloat(param.value.x);
+                    writer.writeFloat(param.value.y);
+                    writer.writeFloat(param.value.z);
+                    break;
+                case ParamType::STRING:
+                    writer.writeString(config.getString(slot));
+                    break;
+                case ParamType::BOOL:
+                    writer.writeU8(param.value.x != 0.0f ? 1 : 0);
+                    break;
+            }
+        }
+    }
+
+    void CompiledScriptIO::readConfig(BinaryReader &reader, BlockConfig &config)
+    {
+        std::string key;
+        std::string text;
+
+        std::size_t count = reader.readCount(3);
+        for (std::size_t i = 0; i < count && reader.isGood(); i++) {
+            reader.readString(key);
+            uint8_t type = reader.readU8();
+            if (type > MAX_PARAM_TYPE) {
+                reader.fail();
+                return;
+            }
+            switch (static_cast<ParamType>(type)) {
+                case ParamType::FLOAT:
+                    config.setFloat(key, reader.readFloat());
+                    break;
+                case ParamType::VECTOR: {
+                    Vector3 value;
+                    value.x = reader.readFloat();
+                    value.y = reader.readFloat();
+                    value.z = reader.readFloat();
+                    config.setVector(key, value);
+                    break;
+                }
+                case ParamType::STRING:
+                    reader.readString(text);
+                    config.setString(key, text);
+                    break;
+                case ParamType::BOOL:
+                    config.setBool(key, reader.readU8() != 0);
+                    break;
+            }
+        }
+    }
+
+    void CompiledScriptIO::write(const CompiledScript &script, std::vector<uint8_t> &out)
+    {
+        BinaryWriter writer(out);
+
+        writer.writeBytes(MAGIC, sizeof(MAGIC));
+        writer.writeU8(FORMAT_VERSION);
+        writer.writeVarInt(script.objectId);
+        writer.writeString(script.name);
+        writer.writeU8(script.isValid ? 1 : 0);
+        writeIds(writer, script.entryPoints);
+
+        writer.writeVarUInt(script.nodes.size());
+        for (const auto &node : script.nodes) {
+            writer.writeVarInt(node.blockId);
+            writer.writeU8(static_cast<uint8_t>(node.blockType));
+            writer.writeU8(node.isEntryPoint ? 1 : 0);
+            writeIds(writer, node.nextNodes);
+            writer.writeVarInt(node.trueNextNode);
+            writer.writeVarInt(node.falseNextNode);
+            writer.writeVarInt(node.loopBodyNode);
+            writeIds(writer, node.valueInputs);
+            writeConfig(writer, node.config);
+        }
+    }
+
+    bool CompiledScriptIO::read(const uint8_t *data, std::size_t size, CompiledScript &out, std::string &error)
+    {
+        BinaryReader reader(data, size);
+
+        char magic[4] = {0, 0, 0, 0};
+        reader.readBytes(magic, sizeof(magic));
+        if (!reader.isGood() || !std::equal(magic, magic + 4, MAGIC)) {
+            error = "Not a compiled script file";
+            return false;
+        }
+        uint8_t version = reader.readU8();
+        if (version != FORMAT_VERSION) {
+            error = "Unsupported compiled script version " + std::to_string(version);
+            return false;
+        }
+
+        out.objectId = static_cast<int>(reader.readVarInt());
+        reader.readString(out.name);
+        out.isValid = reader.readU8() != 0;
+        out.errors.clear();
+        readIds(reader, out.entryPoints);
+
+        std::size_t nodeCount = reader.readCount(9);
+        out.nodes.clear();
+        out.nodes.reserve(nodeCount);
+        for (std::size_t i = 0; i < nodeCount && reader.isGood(); i++) {
+            int blockId = static_cast<int>(reader.readVarInt());
+            uint8_t type = reader.readU8();
+            if (type > MAX_BLOCK_TYPE) {
+                error = "Unknown block type " + std::to_string(type);
+                return false;
+            }
+            CompiledScriptNode &node = out.nodes.emplace_back(blockId, static_cast<BlockType>(type));
+            node.isEntryPoint = reader.readU8() != 0;
+            readIds(reader, node.nextNodes);
+            node.trueNextNode = static_cast<int>(reader.readVarInt());
+            node.falseNextNode = static_cast<int>(reader.readVarInt());
+            node.loopBodyNode = static_cast<int>(reader.readVarInt());
+            readIds(reader, node.valueInputs);
+            readConfig(reader, node.config);
+            node.config.conformTo(node.blockType);
+        }
+
+        if (!reader.isGood()) {
+            error = "Truncated compiled script";
+            return false;
+        }
+        return true;
+    }
+
+    bool CompiledScriptIO::saveToFile(const CompiledScript &script, const std::string &path)
+    {
+        std::vector<uint8_t> buffer;
+        write(script, buffer);
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "[CompiledScriptIO] Failed to open " << path << " for writing" << std::endl;
+            return false;
+        }
+        file.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        return file.good();
+    }
+
+    bool CompiledScriptIO::loadFromFile(const std::string &path, CompiledScript &out, std::string &error)
+    {
+        std::vector<uint8_t> buffer;
+        if (!readFile(path, buffer)) {
+            error = "Failed to read " + path;
+            return false;
+        }
+        return read(buffer.data(), buffer.size(), out, error);
+    }
+
+    bool CompiledScriptIO::readFile(const std::string &path, std::vector<uint8_t> &out)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            return false;
+        std::streamsize size = file.tellg();
+        if (size < 0)
+            return false;
+        file.seekg(0, std::ios::beg);
+        out.resize(static_cast<std::size_t>(size));
+        return size == 0 || static_cast<bool>(file.read(reinterpret_cast<char *>(out.data()), size));
+    }
+}
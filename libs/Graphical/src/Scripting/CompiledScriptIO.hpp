@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** CompiledScriptIO
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "BinaryStream.hpp"
+#include "CompiledScript.hpp"
+
+namespace scripting
+{
+    /**
+     * @brief Compact binary format for compiled scripts (.isc)
+     *
+     * Layout: "ISCS" magic, format version, then the script header, entry
+     * points and nodes. The game loads these directly, so it never has to
+     * parse the editor's JSON.
+     */
+    class CompiledScriptIO
+    {
+        public:
+            static constexpr uint8_t FORMAT_VERSION = 2;
+            static constexpr const char *FILE_EXTENSION = ".isc";
+
+            static void write(const CompiledScript &script, std::vector<uint8_t> &out);
+            static bool read(const uint8_t *data, std::size_t size, CompiledScript &out, std::string &error);
+
+            static bool saveToFile(const CompiledScript &script, const std::string &path);
+            static bool loadFromFile(const std::string &path, CompiledScript &out, std::string &error);
+
+            /**
+             * @brief Block configuration encoding, shared with the editor's script format
+             */
+            static void writeConfig(BinaryWriter &writer, const BlockConfig &config);
+            static void readConfig(BinaryReader &reader, BlockConfig &config);
+
+            static bool readFile(const std::string &path, std::vector<uint8_t> &out);
+
+        protected:
+        private:
+    };
+}
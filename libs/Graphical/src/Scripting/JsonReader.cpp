@@ -0,0 +1,361 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** JsonReader
+*/
+
+#include "JsonReader.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+namespace scripting
+{
+    namespace
+    {
+        constexpr double POWERS_OF_TEN[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        bool isDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        int hexValue(char c)
+        {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+            if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F')
+                return c - 'A' + 10;
+            return -1;
+        }
+
+        void appendUtf8(std::string &out, uint32_t codepoint)
+        {
+            if (codepoint < 0x80) {
+                out.push_back(static_cast<char>(codepoint));
+            } else if (codepoint < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+                out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            } else if (codepoint < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            } else {
+                out.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            }
+        }
+    }
+
+    bool JsonReader::parse(std::string_view text, IJsonHandler &handler)
+    {
+        _text = text;
+        _pos = 0;
+        _stack.clear();
+        _error.clear();
+        _errorOffset = 0;
+
+        bool expectValue = true;
+        std::string_view token;
+        double number = 0.0;
+
+        while (true) {
+            skipWhitespace();
+            if (expectValue) {
+                if (_pos >= _text.size())
+                    return fail("Unexpected end of input");
+                char c = _text[_pos];
+                bool ok = true;
+                switch (c) {
+                    case '{':
+                        _pos++;
+                        if (!handler.onObjectStart())
+                            return fail("Stopped by handler");
+                        _stack.push_back('{');
+                        skipWhitespace();
+                        if (_pos < _text.size() && _text[_pos] == '}') {
+                            _pos++;
+                            _stack.pop_back();
+                            ok = handler.onObjectEnd();
+                            break;
+                        }
+                        if (!parseString(token))
+                            return false;
+                        skipWhitespace();
+                        if (_pos >= _text.size() || _text[_pos] != ':')
+                            return fail("Expected ':' after key");
+                        _pos++;
+                        if (!handler.onKey(token))
+                            return fail("Stopped by handler");
+                        continue;
+                    case '[':
+                        _pos++;
+                        if (!handler.onArrayStart())
+                            return fail("Stopped by handler");
+                        _stack.push_back('[');
+                        skipWhitespace();
+                        if (_pos < _text.size() && _text[_pos] == ']') {
+                            _pos++;
+                            _stack.pop_back();
+                            ok = handler.onArrayEnd();
+                            break;
+                        }
+                        continue;
+                    case '"':
+                        if (!parseString(token))
+                            return false;
+                        ok = handler.onString(token);
+                        break;
+                    case 't':
+                        if (!parseLiteral("true"))
+                            return false;
+                        ok = handler.onBool(true);
+                        break;
+                    case 'f':
+                        if (!parseLiteral("false"))
+                            return false;
+                        ok = handler.onBool(false);
+                        break;
+                    case 'n':
+                        if (!parseLiteral("null"))
+                            return false;
+                        ok = handler.onNull();
+                        break;
+                    default:
+                        if (c != '-' && !isDigit(c))
+                            return fail("Unexpected character");
+                        if (!parseNumber(number))
+                            return false;
+                        ok = handler.onNumber(number);
+                        break;
+                }
+                if (!ok)
+                    return fail("Stopped by handler");
+                expectValue = false;
+                continue;
+            }
+
+            if (_stack.empty()) {
+                if (_pos != _text.size())
+                    return fail("Trailing characters after document");
+                return true;
+            }
+            if (_pos >= _text.size())
+                return fail("Unexpected end of input");
+
+            char c = _text[_pos++];
+            char container = _stack.back();
+            if (c == ',') {
+                if (container == '{') {
+                    skipWhitespace();
+                    if (!parseString(token))
+                        return false;
+                    skipWhitespace();
+                    if (_pos >= _text.size() || _text[_pos] != ':')
+                        return fail("Expected ':' after key");
+                    _pos++;
+                    if (!handler.onKey(token))
+                        return fail("Stopped by handler");
+                }
+                expectValue = true;
+            } else if (c == '}' && container == '{') {
+                _stack.pop_back();
+                if (!handler.onObjectEnd())
+                    return fail("Stopped by handler");
+            } else if (c == ']' && container == '[') {
+                _stack.pop_back();
+                if (!handler.onArrayEnd())
+                    return fail("Stopped by handler");
+            } else {
+                _pos--;
+                return fail("Expected ',' or closing bracket");
+            }
+        }
+    }
+
+    bool JsonReader::fail(const char *message)
+    {
+        _error = message;
+        _errorOffset = _pos;
+        return false;
+    }
+
+    void JsonReader::skipWhitespace()
+    {
+        while (_pos < _text.size()) {
+            char c = _text[_pos];
+            if (c != ' ' && c != '\n' && c != '\r' && c != '\t')
+                break;
+            _pos++;
+        }
+    }
+
+    bool JsonReader::parseString(std::string_view &out)
+    {
+        if (_pos >= _text.size() || _text[_pos] != '"')
+            return fail("Expected string");
+        std::size_t start = ++_pos;
+
+        // Fast path: no escapes, hand out a view into the input
+        while (_pos < _text.size()) {
+            char c = _text[_pos];
+            if (c == '"') {
+                out = _text.substr(start, _pos - start);
+                _pos++;
+                return true;
+            }
+            if (c == '\\')
+                break;
+            if (static_cast<unsigned char>(c) < 0x20)
+                return fail("Control character in string");
+            _pos++;
+        }
+        if (_pos >= _text.size())
+            return fail("Unterminated string");
+
+        _scratch.assign(_text.data() + start, _pos - start);
+        while (_pos < _text.size()) {
+            char c = _text[_pos++];
+            if (c == '"') {
+                out = _scratch;
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < 0x20)
+                return fail("Control character in string");
+            if (c != '\\') {
+                _scratch.push_back(c);
+                continue;
+            }
+            if (_pos >= _text.size())
+                break;
+            char escape = _text[_pos++];
+            switch (escape) {
+                case '"': _scratch.push_back('"'); break;
+                case '\\': _scratch.push_back('\\'); break;
+                case '/': _scratch.push_back('/'); break;
+                case 'b': _scratch.push_back('\b'); break;
+                case 'f': _scratch.push_back('\f'); break;
+                case 'n': _scratch.push_back('\n'); break;
+                case 'r': _scratch.push_back('\r'); break;
+                case 't': _scratch.push_back('\t'); break;
+                case 'u': {
+                    uint32_t codepoint = 0;
+                    for (int unit = 0; unit < 2; unit++) {
+                        if (_text.size() - _pos < 4)
+                            return fail("Truncated unicode escape");
+                        uint32_t value = 0;
+                        for (int i = 0; i < 4; i++) {
+                            int digit = hexValue(_text[_pos++]);
+                            if (digit < 0)
+                                return fail("Invalid unicode escape");
+                            value = (value << 4) | static_cast<uint32_t>(digit);
+                        }
+                        if (unit == 0) {
+                            codepoint = value;
+                            // A high surrogate must be followed by an escaped low surrogate
+                            if (value < 0xD800 || value > 0xDBFF)
+                                break;
+                            if (_text.size() - _pos < 2 || _text[_pos] != '\\' || _text[_pos + 1] != 'u')
+                                return fail("Unpaired surrogate in string");
+                            _pos += 2;
+                        } else {
+                            if (value < 0xDC00 || value > 0xDFFF)
+                                return fail("Unpaired surrogate in string");
+                            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (value - 0xDC00);
+                        }
+                    }
+                    appendUtf8(_scratch, codepoint);
+                    break;
+                }
+                default:
+                    return fail("Invalid escape sequence");
+            }
+        }
+        return fail("Unterminated string");
+    }
+
+    bool JsonReader::parseNumber(double &out)
+    {
+        bool negative = false;
+        uint64_t mantissa = 0;
+        int exponent = 0;
+        int digits = 0;
+
+        if (_text[_pos] == '-') {
+            negative = true;
+            _pos++;
+        }
+        if (_pos >= _text.size() || !isDigit(_text[_pos]))
+            return fail("Invalid number");
+        if (_text[_pos] == '0') {
+            _pos++;
+        } else {
+            while (_pos < _text.size() && isDigit(_text[_pos])) {
+                if (digits < 19) {
+                    mantissa = mantissa * 10 + static_cast<uint64_t>(_text[_pos] - '0');
+                    digits++;
+                } else {
+                    exponent++;
+                }
+                _pos++;
+            }
+        }
+        if (_pos < _text.size() && _text[_pos] == '.') {
+            _pos++;
+            if (_pos >= _text.size() || !isDigit(_text[_pos]))
+                return fail("Invalid number");
+            while (_pos < _text.size() && isDigit(_text[_pos])) {
+                if (digits < 19) {
+                    mantissa = mantissa * 10 + static_cast<uint64_t>(_text[_pos] - '0');
+                    if (mantissa != 0)
+                        digits++;
+                    exponent--;
+                }
+                _pos++;
+            }
+        }
+        if (_pos < _text.size() && (_text[_pos] == 'e' || _text[_pos] == 'E')) {
+            _pos++;
+            bool negativeExponent = false;
+            if (_pos < _text.size() && (_text[_pos] == '+' || _text[_pos] == '-'))
+                negativeExponent = _text[_pos++] == '-';
+            if (_pos >= _text.size() || !isDigit(_text[_pos]))
+                return fail("Invalid number");
+            int value = 0;
+            while (_pos < _text.size() && isDigit(_text[_pos])) {
+                if (value < 10000)
+                    value = value * 10 + (_text[_pos] - '0');
+                _pos++;
+            }
+            exponent += negativeExponent ? -value : value;
+        }
+
+        double result = static_cast<double>(mantissa);
+        if (mantissa != 0 && exponent != 0) {
+            if (exponent > 0 && exponent <= 22)
+                result *= POWERS_OF_TEN[exponent];
+            else if (exponent < 0 && exponent >= -22)
+                result /= POWERS_OF_TEN[-exponent];
+            else
+                result *= std::pow(10.0, exponent);
+        }
+        out = negative ? -result : result;
+        return true;
+    }
+
+    bool JsonReader::parseLiteral(std::string_view literal)
+    {
+        if (_text.compare(_pos, literal.size(), literal) != 0)
+            return fail("Invalid literal");
+        _pos += literal.size();
+        return true;
+    }
+}
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** JsonReader
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace scripting
+{
+    /**
+     * @brief Receives JSON events in document order
+     *
+     * String views are only valid for the duration of the call. Returning
+     * false from any callback stops parsing.
+     */
+    class IJsonHandler
+    {
+        public:
+            virtual ~IJsonHandler() = default;
+
+            virtual bool onObjectStart() = 0;
+            virtual bool onObjectEnd() = 0;
+            virtual bool onArrayStart() = 0;
+            virtual bool onArrayEnd() = 0;
+            virtual bool onKey(std::string_view key) = 0;
+            virtual bool onString(std::string_view value) = 0;
+            virtual bool onNumber(double value) = 0;
+            virtual bool onBool(bool value) = 0;
+            virtual bool onNull() = 0;
+
+        protected:
+        private:
+    };
+
+    /**
+     * @brief Single-pass, SAX-style JSON reader
+     *
+     * Walks the input once with an explicit container stack (no recursion)
+     * and hands strings out as views into the input. Only strings that
+     * contain escapes are decoded, into a scratch buffer that is reused
+     * across calls, so a reader kept alive across files stops allocating
+     * once it has warmed up.
+     */
+    class JsonReader
+    {
+        public:
+            JsonReader() = default;
+            ~JsonReader() = default;
+
+            bool parse(std::string_view text, IJsonHandler &handler);
+
+            const std::string &getError() const { return _error; }
+            std::size_t getErrorOffset() const { return _errorOffset; }
+
+        protected:
+        private:
+            bool fail(const char *message);
+            void skipWhitespace();
+            bool parseString(std::string_view &out);
+            bool parseNumber(double &out);
+            bool parseLiteral(std::string_view literal);
+
+            std::string_view _text;
+            std::size_t _pos = 0;
+            std::string _scratch;
+            std::vector<char> _stack;
+            std::string _error;
+            std::size_t _errorOffset = 0;
+    };
+}
@@ -0,0 +1,335 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** ScriptOptimizer
+*/
+
+#include "ScriptOptimizer.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace scripting;
+
+namespace
+{
+    std::unordered_map<int, int> indexNodes(const CompiledScript &script)
+    {
+        std::unordered_map<int, int> indexById;
+
+        indexById.reserve(script.nodes.size());
+        for (std::size_t i = 0; i < script.nodes.size(); i++)
+            indexById[script.nodes[i].blockId] = static_cast<int>(i);
+        return indexById;
+    }
+
+    bool hasValueInputs(const CompiledScriptNode &node)
+    {
+        return std::any_of(node.valueInputs.begin(), node.valueInputs.end(), [](int id) { return id != -1; });
+    }
+
+    bool isEntryPoint(const CompiledScript &script, int blockId)
+    {
+        return std::find(script.entryPoints.begin(), script.entryPoints.end(), blockId) != script.entryPoints.end();
+    }
+
+    void eraseNode(CompiledScript &script, int blockId)
+    {
+        script.nodes.erase(std::remove_if(script.nodes.begin(), script.nodes.end(),
+            [blockId](const CompiledScriptNode &node) { return node.blockId == blockId; }), script.nodes.end());
+        script.entryPoints.erase(std::remove(script.entryPoints.begin(), script.entryPoints.end(), blockId),
+            script.entryPoints.end());
+    }
+
+    /**
+     * Reroute every execution edge pointing at blockId to targets, then drop
+     * the node. Fails when a single-slot edge (branch or loop body) would need
+     * more than one target.
+     */
+    bool bypassNode(CompiledScript &script, int blockId, const std::vector<int> &targets)
+    {
+        if (std::find(targets.begin(), targets.end(), blockId) != targets.end())
+            return false;
+        if (targets.size() > 1) {
+            for (const CompiledScriptNode &node : script.nodes) {
+                if (node.trueNextNode == blockId || node.falseNextNode == blockId || node.loopBodyNode == blockId)
+                    return false;
+            }
+        }
+
+        int replacement = targets.empty() ? -1 : targets.front();
+        for (CompiledScriptNode &node : script.nodes) {
+            std::vector<int> rerouted;
+            rerouted.reserve(node.nextNodes.size() + targets.size());
+            for (int next : node.nextNodes) {
+                if (next == blockId)
+                    rerouted.insert(rerouted.end(), targets.begin(), targets.end());
+                else
+                    rerouted.push_back(next);
+            }
+            node.nextNodes.swap(rerouted);
+            if (node.trueNextNode == blockId)
+                node.trueNextNode = replacement;
+            if (node.falseNextNode == blockId)
+                node.falseNextNode = replacement;
+            if (node.loopBodyNode == blockId)
+                node.loopBodyNode = replacement;
+        }
+        eraseNode(script, blockId);
+        return true;
+    }
+}
+
+CompiledScript ScriptOptimizer::optimize(const CompiledScript &script, OptimizationReport &report) const
+{
+    report = OptimizationReport();
+    report.nodesBefore = static_cast<int>(script.nodes.size());
+    report.edgesBefore = countEdges(script);
+    report.nodesAfter = report.nodesBefore;
+    report.edgesAfter = report.edgesBefore;
+
+    if (!script.isValid)
+        return script;
+
+    using Pass = void (ScriptOptimizer::*)(CompiledScript &) const;
+    static const std::pair<const char *, Pass> passes[] = {
+        {"Fold IF", &ScriptOptimizer::foldConstantConditions},
+        {"Empty LOOP", &ScriptOptimizer::removeEmptyLoops},
+        {"Fuse transforms", &ScriptOptimizer::fuseTransforms},
+        {"Dead nodes", &ScriptOptimizer::eliminateDeadNodes}
+    };
+
+    // The passes read parameters by slot
+    CompiledScript optimized = script;
+    for (CompiledScriptNode &node : optimized.nodes)
+        node.config.conformTo(node.blockType);
+
+    for (const auto &pass : passes) {
+        int nodes = static_cast<int>(optimized.nodes.size());
+        int edges = countEdges(optimized);
+
+        (this->*pass.second)(optimized);
+
+        OptimizationPassStats stats;
+        stats.name = pass.first;
+        stats.removedNodes = nodes - static_cast<int>(optimized.nodes.size());
+        stats.removedEdges = edges - countEdges(optimized);
+        report.passes.push_back(stats);
+    }
+
+    std::string errors;
+    if (!validate(optimized, errors)) {
+        std::cerr << "[ScriptOptimizer] Optimized graph for '" << script.name << "' is invalid, keeping the original: "
+                  << errors << std::endl;
+        report.passes.clear();
+        return script;
+    }
+
+    report.nodesAfter = static_cast<int>(optimized.nodes.size());
+    report.edgesAfter = countEdges(optimized);
+    report.isValid = true;
+    return optimized;
+}
+
+int ScriptOptimizer::countEdges(const CompiledScript &script)
+{
+    int edges = 0;
+
+    for (const CompiledScriptNode &node : script.nodes) {
+        edges += static_cast<int>(node.nextNodes.size());
+        edges += (node.trueNextNode != -1) + (node.falseNextNode != -1) + (node.loopBodyNode != -1);
+        edges += static_cast<int>(std::count_if(node.valueInputs.begin(), node.valueInputs.end(),
+            [](int id) { return id != -1; }));
+    }
+    return edges;
+}
+
+bool ScriptOptimizer::validate(const CompiledScript &script, std::string &errors)
+{
+    std::unordered_map<int, int> indexById = indexNodes(script);
+    auto exists = [&indexById](int id) { return id == -1 || indexById.count(id) > 0; };
+
+    errors.clear();
+    if (indexById.size() != script.nodes.size())
+        errors += "Duplicate block ids.\n";
+    for (int entry : script.entryPoints) {
+        if (!indexById.count(entry))
+            errors += "Entry point " + std::to_string(entry) + " does not exist.\n";
+    }
+    for (const CompiledScriptNode &node : script.nodes) {
+        bool linked = exists(node.trueNextNode) && exists(node.falseNextNode) && exists(node.loopBodyNode);
+        for (int next : node.nextNodes)
+            linked = linked && next != -1 && exists(next);
+        for (int value : node.valueInputs)
+            linked = linked && exists(value);
+        if (!linked)
+            errors += "Block " + std::to_string(node.blockId) + " links to a missing block.\n";
+    }
+    return errors.empty();
+}
+
+void ScriptOptimizer::foldConstantConditions(CompiledScript &script) const
+{
+    std::vector<int> conditions;
+
+    for (const CompiledScriptNode &node : script.nodes) {
+        if (node.blockType == BlockType::IF && !isEntryPoint(script, node.blockId))
+            conditions.push_back(node.blockId);
+    }
+
+    for (int blockId : conditions) {
+        std::unordered_map<int, int> indexById = indexNodes(script);
+        const CompiledScriptNode &node = script.nodes[indexById[blockId]];
+
+        // The runtime treats an unconnected condition as false
+        int valueId = -1;
+        for (int input : node.valueInputs) {
+            if (input != -1) {
+                valueId = input;
+                break;
+            }
+        }
+
+        bool condition = false;
+        if (valueId != -1) {
+            auto value = indexById.find(valueId);
+            if (value == indexById.end())
+                continue;
+            const CompiledScriptNode &source = script.nodes[value->second];
+            if (source.blockType == BlockType::TRUE)
+                condition = true;
+            else if (source.blockType == BlockType::FALSE)
+                condition = false;
+            else if (source.blockType == BlockType::VALUE)
+                condition = source.config.getFloat(BlockParams::VALUE_VALUE) != 0.0f;
+            else
+                continue;
+        }
+
+        int taken = condition ? node.trueNextNode : node.falseNextNode;
+        bypassNode(script, blockId, taken == -1 ? std::vector<int>{} : std::vector<int>{taken});
+    }
+}
+
+void ScriptOptimizer::removeEmptyLoops(CompiledScript &script) const
+{
+    std::vector<int> loops;
+
+    for (const CompiledScriptNode &node : script.nodes) {
+        if (node.blockType != BlockType::LOOP || isEntryPoint(script, node.blockId))
+            continue;
+        if (node.loopBodyNode == -1 || node.config.getFloat(BlockParams::LOOP_ITERATIONS) < 1.0f)
+            loops.push_back(node.blockId);
+    }
+
+    for (int blockId : loops) {
+        std::unordered_map<int, int> indexById = indexNodes(script);
+        std::vector<int> exits = script.nodes[indexById[blockId]].nextNodes;
+        bypassNode(script, blockId, exits);
+    }
+}
+
+void ScriptOptimizer::fuseTransforms(CompiledScript &script) const
+{
+    bool changed = true;
+
+    while (changed) {
+        changed = false;
+        std::unordered_map<int, int> indexById = indexNodes(script);
+        std::unordered_map<int, int> incoming;
+
+        for (const CompiledScriptNode &node : script.nodes) {
+            for (int next : node.nextNodes)
+                incoming[next]++;
+            for (int target : {node.trueNextNode, node.falseNextNode, node.loopBodyNode}) {
+                if (target != -1)
+                    incoming[target]++;
+            }
+        }
+
+        for (CompiledScriptNode &first : script.nodes) {
+            if ((first.blockType != BlockType::MOVE && first.blockType != BlockType::ROTATE) ||
+                first.nextNodes.size() != 1 || hasValueInputs(first))
+                continue;
+
+            auto it = indexById.find(first.nextNodes.front());
+            if (it == indexById.end())
+                continue;
+            const CompiledScriptNode &second = script.nodes[it->second];
+            if (second.blockType != first.blockType || second.blockId == first.blockId ||
+                incoming[second.blockId] != 1 || isEntryPoint(script, second.blockId) || hasValueInputs(second))
+                continue;
+
+            if (first.blockType == BlockType::MOVE) {
+                // Both blocks apply direction * speed, so one combined vector at speed 1 is exact
+                Vector3 dirA = first.config.getVector(BlockParams::MOVE_DIRECTION);
+                Vector3 dirB = second.config.getVector(BlockParams::MOVE_DIRECTION);
+                float speedA = first.config.getFloat(BlockParams::MOVE_SPEED);
+                float speedB = second.config.getFloat(BlockParams::MOVE_SPEED);
+                first.config.setVector(BlockParams::MOVE_DIRECTION, {
+                    dirA.x * speedA + dirB.x * speedB,
+                    dirA.y * speedA + dirB.y * speedB,
+                    dirA.z * speedA + dirB.z * speedB
+                });
+                first.config.setFloat(BlockParams::MOVE_SPEED, 1.0f);
+            } else {
+                // Rotations only commute around the same axis
+                Vector3 axisA = first.config.getVector(BlockParams::ROTATE_AXIS);
+                Vector3 axisB = second.config.getVector(BlockParams::ROTATE_AXIS);
+                if (axisA.x != axisB.x || axisA.y != axisB.y || axisA.z != axisB.z)
+                    continue;
+                first.config.setFloat(BlockParams::ROTATE_SPEED, first.config.getFloat(BlockParams::ROTATE_SPEED) +
+                                                                 second.config.getFloat(BlockParams::ROTATE_SPEED));
+            }
+
+            int secondId = second.blockId;
+            first.nextNodes = second.nextNodes;
+            eraseNode(script, secondId);
+            changed = true;
+            break;
+        }
+    }
+}
+
+void ScriptOptimizer::eliminateDeadNodes(CompiledScript &script) const
+{
+    std::unordered_map<int, int> indexById = indexNodes(script);
+    std::unordered_set<int> reached;
+    std::vector<int> pending;
+
+    for (int entry : script.entryPoints) {
+        auto it = indexById.find(entry);
+        if (it != indexById.end() && isEventBlock(script.nodes[it->second].blockType) && reached.insert(entry).second)
+            pending.push_back(entry);
+    }
+
+    while (!pending.empty()) {
+        auto it = indexById.find(pending.back());
+        pending.pop_back();
+        if (it == indexById.end())
+            continue;
+
+        const CompiledScriptNode &node = script.nodes[it->second];
+        auto visit = [&reached, &pending](int id) {
+            if (id != -1 && reached.insert(id).second)
+                pending.push_back(id);
+        };
+        for (int next : node.nextNodes)
+            visit(next);
+        visit(node.trueNextNode);
+        visit(node.falseNextNode);
+        visit(node.loopBodyNode);
+        for (int value : node.valueInputs)
+            visit(value);
+    }
+
+    script.nodes.erase(std::remove_if(script.nodes.begin(), script.nodes.end(),
+        [&reached](const CompiledScriptNode &node) { return !reached.count(node.blockId); }), script.nodes.end());
+    script.entryPoints.erase(std::remove_if(script.entryPoints.begin(), script.entryPoints.end(),
+        [&reached](int id) { return !reached.count(id); }), script.entryPoints.end());
+    for (CompiledScriptNode &node : script.nodes)
+        node.isEntryPoint = isEntryPoint(script, node.blockId);
+}
@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** ScriptOptimizer
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "CompiledScript.hpp"
+
+namespace scripting
+{
+    /**
+     * @brief What a single optimizer pass removed from the graph
+     */
+    struct OptimizationPassStats {
+        std::string name;
+        int removedNodes = 0;
+        int removedEdges = 0;
+    };
+
+    struct OptimizationReport {
+        std::vector<OptimizationPassStats> passes;
+        int nodesBefore = 0;
+        int nodesAfter = 0;
+        int edgesBefore = 0;
+        int edgesAfter = 0;
+        bool isValid = false;
+    };
+
+    /**
+     * @brief Rewrites a CompiledScript into a smaller, equivalent graph
+     *
+     * Passes run in order: IF constant folding, empty LOOP removal,
+     * MOVE/ROTATE fusion, then dead-node elimination so that everything the
+     * earlier passes disconnected is swept. The result is validated before
+     * it is returned.
+     */
+    class ScriptOptimizer
+    {
+        public:
+            ScriptOptimizer() = default;
+            ~ScriptOptimizer() = default;
+
+            CompiledScript optimize(const CompiledScript &script, OptimizationReport &report) const;
+
+            static int countEdges(const CompiledScript &script);
+            static bool validate(const CompiledScript &script, std::string &errors);
+
+        protected:
+        private:
+            void foldConstantConditions(CompiledScript &script) const;
+            void removeEmptyLoops(CompiledScript &script) const;
+            void fuseTransforms(CompiledScript &script) const;
+            void eliminateDeadNodes(CompiledScript &script) const;
+    };
+}
@@ -0,0 +1,190 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** ScriptProfiler
+*/
+
+#include "ScriptProfiler.hpp"
+#include "BinaryStream.hpp"
+#include "CompiledScriptIO.hpp"
+#include "ScriptScheduler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace scripting
+{
+    namespace
+    {
+        constexpr char MAGIC[4] = {'I', 'S', 'P', 'F'};
+    }
+
+    std::unordered_map<int, NodeCounters> ScriptProfile::getBlockCounters(int objectId, std::size_t *sharedBy) const
+    {
+        std::unordered_map<int, NodeCounters> result;
+
+        if (sharedBy)
+            *sharedBy = 0;
+        for (const Program &program : programs) {
+            for (const ProfiledObject &object : program.objects) {
+                if (object.objectId != objectId)
+                    continue;
+                std::size_t count = std::min(object.blockIds.size(), program.nodes.size());
+                for (std::size_t i = 0; i < count; i++) {
+                    NodeCounters &counters = result[object.blockIds[i]];
+                    counters.calls += program.nodes[i].calls;
+                    counters.nanoseconds += program.nodes[i].nanoseconds;
+                }
+                if (sharedBy)
+                    *sharedBy = std::max(*sharedBy, program.objects.size());
+            }
+        }
+        return result;
+    }
+
+    int ScriptProfiler::attach(const std::shared_ptr<const ScriptProgram> &program, int objectId,
+        const std::vector<int> &blockIds)
+    {
+        auto found = _entryByProgram.find(program.get());
+        if (found == _entryByProgram.end()) {
+            Entry entry;
+            entry.program = program;
+            entry.base = static_cast<int>(_counters.size());
+            _counters.resize(_counters.size() + program->getNodes().size());
+            found = _entryByProgram.emplace(program.get(), _entries.size()).first;
+            _entries.push_back(std::move(entry));
+        }
+
+        Entry &entry = _entries[found->second];
+        // One object starts an instance per entry point; it is listed once
+        bool known = std::any_of(entry.objects.begin(), entry.objects.end(),
+            [objectId](const ScriptProfile::ProfiledObject &object) { return object.objectId == objectId; });
+        if (!known)
+            entry.objects.push_back({objectId, blockIds});
+        return entry.base;
+    }
+
+    void ScriptProfiler::reset()
+    {
+        std::fill(_counters.begin(), _counters.end(), NodeCounters());
+        _frames = 0;
+    }
+
+    void ScriptProfiler::clear()
+    {
+        _entries.clear();
+        _entryByProgram.clear();
+        _counters.clear();
+        _frames = 0;
+    }
+
+    ScriptProfile ScriptProfiler::snapshot() const
+    {
+        ScriptProfile profile;
+
+        profile.frames = _frames;
+        profile.programs.reserve(_entries.size());
+        for (const Entry &entry : _entries) {
+            ScriptProfile::Program &program = profile.programs.emplace_back();
+            auto begin = _counters.begin() + entry.base;
+            program.name = entry.program->getName();
+            program.nodes.assign(begin, begin + static_cast<std::ptrdiff_t>(entry.program->getNodes().size()));
+            program.objects = entry.objects;
+        }
+        return profile;
+    }
+
+    void ScriptProfileIO::write(const ScriptProfile &profile, std::vector<uint8_t> &out)
+    {
+        BinaryWriter writer(out);
+
+        writer.writeBytes(MAGIC, sizeof(MAGIC));
+        writer.writeU8(FORMAT_VERSION);
+        writer.writeVarUInt(profile.frames);
+        writer.writeVarUInt(profile.programs.size());
+        for (const ScriptProfile::Program &program : profile.programs) {
+            writer.writeString(program.name);
+            writer.writeVarUInt(program.nodes.size());
+            for (const NodeCounters &counters : program.nodes) {
+                writer.writeVarUInt(counters.calls);
+                writer.writeVarUInt(counters.nanoseconds);
+            }
+            writer.writeVarUInt(program.objects.size());
+            for (const ScriptProfile::ProfiledObject &object : program.objects) {
+                writer.writeVarInt(object.objectId);
+                writer.writeVarUInt(object.blockIds.size());
+                for (int blockId : object.blockIds)
+                    writer.writeVarInt(blockId);
+            }
+        }
+    }
+
+    bool ScriptProfileIO::read(const uint8_t *data, std::size_t size, ScriptProfile &out, std::string &error)
+    {
+        BinaryReader reader(data, size);
+        char magic[4] = {0, 0, 0, 0};
+
+        if (!reader.readBytes(magic, sizeof(magic)) || !std::equal(magic, magic + 4, MAGIC)) {
+            error = "Not a script profile";
+            return false;
+        }
+        uint8_t version = reader.readU8();
+        if (version != FORMAT_VERSION) {
+            error = "Unsupported profile version " + std::to_string(version);
+            return false;
+        }
+
+        out.frames = reader.readVarUInt();
+        std::size_t programCount = reader.readCount(3);
+        out.programs.clear();
+        out.programs.reserve(programCount);
+        for (std::size_t i = 0; i < programCount && reader.isGood(); i++) {
+            ScriptProfile::Program &program = out.programs.emplace_back();
+            reader.readString(program.name);
+            program.nodes.resize(reader.readCount(2));
+            for (NodeCounters &counters : program.nodes) {
+                counters.calls = reader.readVarUInt();
+                counters.nanoseconds = reader.readVarUInt();
+            }
+            program.objects.resize(reader.readCount(2));
+            for (ScriptProfile::ProfiledObject &object : program.objects) {
+                object.objectId = static_cast<int>(reader.readVarInt());
+                object.blockIds.resize(reader.readCount());
+                for (int &blockId : object.blockIds)
+                    blockId = static_cast<int>(reader.readVarInt());
+            }
+        }
+
+        if (!reader.isGood()) {
+            error = "Truncated script profile";
+            return false;
+        }
+        return true;
+    }
+
+    bool ScriptProfileIO::saveToFile(const ScriptProfile &profile, const std::string &path)
+    {
+        std::vector<uint8_t> buffer;
+        write(profile, buffer);
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "[ScriptProfileIO] Failed to open " << path << " for writing" << std::endl;
+            return false;
+        }
+        file.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        return file.good();
+    }
+
+    bool ScriptProfileIO::loadFromFile(const std::string &path, ScriptProfile &out, std::string &error)
+    {
+        std::vector<uint8_t> buffer;
+        if (!CompiledScriptIO::readFile(path, buffer)) {
+            error = "Failed to read " + path;
+            return false;
+        }
+        return read(buffer.data(), buffer.size(), out, error);
+    }
+}
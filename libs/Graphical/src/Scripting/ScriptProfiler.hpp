@@ -0,0 +1,159 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** ScriptProfiler
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace scripting
+{
+    class ScriptProgram;
+
+    struct NodeCounters {
+        uint64_t calls = 0;         ///< Executions, one per object for batched nodes
+        uint64_t nanoseconds = 0;   ///< Time spent in the node itself, successors excluded
+    };
+
+    /**
+     * @brief Counters of a profiling session, as saved to and loaded from disk
+     *
+     * Counters belong to programs, which are shared by every object whose
+     * compiled script has the same structure; each object keeps its own block
+     * IDs so the editor can map the program's nodes back onto its canvas.
+     */
+    struct ScriptProfile {
+        struct ProfiledObject {
+            int objectId = -1;
+            std::vector<int> blockIds;      ///< Block ID of each program node
+        };
+
+        struct Program {
+            std::string name;
+            std::vector<NodeCounters> nodes;
+            std::vector<ProfiledObject> objects;
+        };
+
+        uint64_t frames = 0;
+        std::vector<Program> programs;
+
+        /**
+         * @brief Counters of the program running an object's script, by block ID
+         * @param sharedBy Receives how many objects the counters are summed over
+         */
+        std::unordered_map<int, NodeCounters> getBlockCounters(int objectId, std::size_t *sharedBy = nullptr) const;
+    };
+
+    /**
+     * @brief Per-node execution counts and times, kept in one flat array
+     *
+     * Each attached program owns a contiguous range of counters, so recording
+     * a node is a single indexed add with no lookup.
+     */
+    class ScriptProfiler
+    {
+        public:
+            /**
+             * @brief Times one node execution and records it when it goes out of scope
+             */
+            class Scope
+            {
+                public:
+                    Scope(ScriptProfiler *profiler, int slot, uint64_t calls = 1)
+                        : _profiler(slot >= 0 ? profiler : nullptr), _slot(slot), _calls(calls)
+                    {
+                        if (_profiler)
+                            _start = std::chrono::steady_clock::now();
+                    }
+                    ~Scope() { stop(); }
+
+                    Scope(const Scope &) = delete;
+                    Scope &operator=(const Scope &) = delete;
+
+                    void stop()
+                    {
+                        if (!_profiler)
+                            return;
+                        auto elapsed = std::chrono::steady_clock::now() - _start;
+                        _profiler->record(_slot, _calls,
+                            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+                        _profiler = nullptr;
+                    }
+
+                private:
+                    ScriptProfiler *_profiler;
+                    int _slot;
+                    uint64_t _calls;
+                    std::chrono::steady_clock::time_point _start;
+            };
+
+            ScriptProfiler() = default;
+            ~ScriptProfiler() = default;
+
+            /**
+             * @brief Register an object running a program
+             * @param blockIds Block ID of each program node, as compiled for this object
+             * @return First counter of the program's range
+             */
+            int attach(const std::shared_ptr<const ScriptProgram> &program, int objectId, const std::vector<int> &blockIds);
+
+            void record(int slot, uint64_t calls, uint64_t nanoseconds)
+            {
+                NodeCounters &counters = _counters[slot];
+                counters.calls += calls;
+                counters.nanoseconds += nanoseconds;
+            }
+
+            void endFrame() { _frames++; };
+            void reset();   ///< Zero the counters, keeping the attached programs
+            void clear();
+
+            uint64_t getFrameCount() const { return _frames; };
+            const std::vector<NodeCounters> &getCounters() const { return _counters; };
+            ScriptProfile snapshot() const;
+
+        protected:
+        private:
+            struct Entry {
+                std::shared_ptr<const ScriptProgram> program;   ///< Kept alive so its address stays unique
+                int base = 0;
+                std::vector<ScriptProfile::ProfiledObject> objects;
+            };
+
+            std::vector<Entry> _entries;
+            std::unordered_map<const ScriptProgram *, std::size_t> _entryByProgram;
+            std::vector<NodeCounters> _counters;
+            uint64_t _frames = 0;
+    };
+
+    /**
+     * @brief Binary format for script profiles (.isp)
+     *
+     * Layout: "ISPF" magic, format version, frame count, then each program's
+     * name, node counters and the objects running it.
+     */
+    class ScriptProfileIO
+    {
+        public:
+            static constexpr uint8_t FORMAT_VERSION = 1;
+            static constexpr const char *FILE_EXTENSION = ".isp";
+
+            static void write(const ScriptProfile &profile, std::vector<uint8_t> &out);
+            static bool read(const uint8_t *data, std::size_t size, ScriptProfile &out, std::string &error);
+
+            static bool saveToFile(const ScriptProfile &profile, const std::string &path);
+            static bool loadFromFile(const std::string &path, ScriptProfile &out, std::string &error);
+
+        protected:
+        private:
+    };
+}
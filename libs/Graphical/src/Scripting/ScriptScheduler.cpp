@@ -0,0 +1,641 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** ScriptScheduler
+*/
+
+#include "ScriptScheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <unordered_map>
+
+using namespace scripting;
+
+namespace
+{
+    unsigned char toColorChannel(float value)
+    {
+        return static_cast<unsigned char>(std::clamp(value, 0.0f, 1.0f) * 255.0f);
+    }
+
+    void hashCombine(std::size_t &seed, std::size_t value)
+    {
+        seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    }
+}
+
+ScriptProgram::ScriptProgram(const CompiledScript &script)
+    : _name(script.name)
+{
+    std::unordered_map<int, int> indexById;
+
+    indexById.reserve(script.nodes.size());
+    for (std::size_t i = 0; i < script.nodes.size(); i++)
+        indexById[script.nodes[i].blockId] = static_cast<int>(i);
+
+    auto resolve = [&indexById](int blockId) {
+        auto it = indexById.find(blockId);
+        return it != indexById.end() ? it->second : -1;
+    };
+
+    _nodes.resize(script.nodes.size());
+    for (std::size_t i = 0; i < script.nodes.size(); i++) {
+        const CompiledScriptNode &source = script.nodes[i];
+        ProgramNode &node = _nodes[i];
+
+        node.type = source.blockType;
+        // Resolve parameter names once, so executors read fixed slots
+        node.config = source.config;
+        node.config.conformTo(node.type);
+        for (int nextId : source.nextNodes) {
+            int next = resolve(nextId);
+            if (next != -1)
+                node.next.push_back(next);
+        }
+        node.trueNext = resolve(source.trueNextNode);
+        node.falseNext = resolve(source.falseNextNode);
+        node.loopBody = resolve(source.loopBodyNode);
+        node.values.reserve(source.valueInputs.size());
+        for (int valueId : source.valueInputs)
+            node.values.push_back(resolve(valueId));
+    }
+
+    for (int entryId : script.entryPoints) {
+        int entry = resolve(entryId);
+        if (entry != -1 && isEventBlock(_nodes[entry].type))
+            _entryPoints.push_back(entry);
+    }
+
+    _structureHash = computeStructureHash();
+    _batchable = computeBatchable();
+}
+
+bool ScriptProgram::hasSameStructure(const ScriptProgram &other) const
+{
+    if (_structureHash != other._structureHash || _nodes.size() != other._nodes.size())
+        return false;
+    for (std::size_t i = 0; i < _nodes.size(); i++) {
+        const ProgramNode &a = _nodes[i];
+        const ProgramNode &b = other._nodes[i];
+        if (a.type != b.type || a.next != b.next || a.trueNext != b.trueNext ||
+            a.falseNext != b.falseNext || a.loopBody != b.loopBody || a.values != b.values ||
+            a.config != b.config)
+            return false;
+    }
+    return true;
+}
+
+std::size_t ScriptProgram::computeStructureHash() const
+{
+    std::size_t seed = _nodes.size();
+
+    for (const ProgramNode &node : _nodes) {
+        hashCombine(seed, static_cast<std::size_t>(node.type));
+        for (int next : node.next)
+            hashCombine(seed, static_cast<std::size_t>(next));
+        hashCombine(seed, static_cast<std::size_t>(node.trueNext));
+        hashCombine(seed, static_cast<std::size_t>(node.falseNext));
+        hashCombine(seed, static_cast<std::size_t>(node.loopBody));
+        for (int value : node.values)
+            hashCombine(seed, static_cast<std::size_t>(value));
+        hashCombine(seed, node.config.hash());
+    }
+    return seed;
+}
+
+bool ScriptProgram::computeBatchable() const
+{
+    // 0 = unvisited, 1 = on the DFS path, 2 = done
+    std::vector<char> marks(_nodes.size(), 0);
+    std::vector<std::pair<int, int>> path;
+
+    // A LOOP can outgrow the per-frame step budget, which only instances can yield on
+    for (const ProgramNode &node : _nodes) {
+        if (node.type == BlockType::DELAY || node.type == BlockType::LOOP)
+            return false;
+    }
+
+    auto successor = [this](int index, int edge) {
+        const ProgramNode &node = _nodes[index];
+        int count = static_cast<int>(node.next.size());
+        if (edge < count)
+            return node.next[edge];
+        switch (edge - count) {
+            case 0: return node.trueNext;
+            case 1: return node.falseNext;
+            case 2: return node.loopBody;
+            default: return -2;
+        }
+    };
+
+    for (std::size_t root = 0; root < _nodes.size(); root++) {
+        if (marks[root])
+            continue;
+        marks[root] = 1;
+        path.push_back({static_cast<int>(root), 0});
+        while (!path.empty()) {
+            int current = path.back().first;
+            int next = successor(current, path.back().second++);
+            if (next == -2) {
+                marks[current] = 2;
+                path.pop_back();
+            } else if (next >= 0) {
+                if (marks[next] == 1)
+                    return false;
+                if (marks[next] == 0) {
+                    marks[next] = 1;
+                    path.push_back({next, 0});
+                }
+            }
+        }
+    }
+    return true;
+}
+
+float ScriptProgram::evaluateValue(int nodeIndex) const
+{
+    if (nodeIndex < 0 || nodeIndex >= static_cast<int>(_nodes.size()))
+        return 0.0f;
+
+    const ProgramNode &node = _nodes[nodeIndex];
+    switch (node.type) {
+        case BlockType::TRUE:
+            return 1.0f;
+        case BlockType::FALSE:
+            return 0.0f;
+        case BlockType::VALUE:
+            return node.config.getFloat(BlockParams::VALUE_VALUE);
+        default:
+            return 0.0f;
+    }
+}
+
+float ScriptProgram::getInputValue(const ProgramNode &node, int port, float fallback) const
+{
+    if (port < 0 || port >= static_cast<int>(node.values.size()) || node.values[port] == -1)
+        return fallback;
+    return evaluateValue(node.values[port]);
+}
+
+ScriptScheduler::ScriptScheduler(IScriptHost &host) : _host(host)
+{
+}
+
+void ScriptScheduler::addScript(const CompiledScript &script)
+{
+    if (!script.isValid) {
+        std::cerr << "[ScriptScheduler] Skipping invalid script '" << script.name << "' for object " << script.objectId << std::endl;
+        return;
+    }
+
+    std::shared_ptr<const ScriptProgram> program = internProgram(script);
+    int profileSlot = -1;
+    if (_profiler) {
+        // Program nodes are in the script's node order
+        std::vector<int> blockIds;
+        blockIds.reserve(script.nodes.size());
+        for (const CompiledScriptNode &node : script.nodes)
+            blockIds.push_back(node.blockId);
+        profileSlot = _profiler->attach(program, script.objectId, blockIds);
+    }
+
+    for (int entry : program->getEntryPoints()) {
+        if (program->getNodes()[entry].type == BlockType::ON_UPDATE && program->isBatchable() &&
+            addToBatch(program, entry, script.objectId, profileSlot))
+            continue;
+
+        int index;
+        if (!_freeInstances.empty()) {
+            index = _freeInstances.back();
+            _freeInstances.pop_back();
+        } else {
+            index = static_cast<int>(_instances.size());
+            _instances.emplace_back();
+        }
+
+        ScriptInstance &instance = _instances[index];
+        const ProgramNode &node = program->getNodes()[entry];
+        instance = ScriptInstance();
+        instance.program = program;
+        instance.objectId = script.objectId;
+        instance.entryNode = entry;
+        instance.trigger = node.type;
+        instance.profileSlot = profileSlot;
+        if (node.type == BlockType::ON_KEY_PRESS)
+            instance.key = node.config.getString(BlockParams::KEY_PRESS_KEY);
+        if (node.type == BlockType::ON_UPDATE)
+            _updateInstances.push_back(index);
+        if (node.type == BlockType::ON_START && _started)
+            trigger(index);
+    }
+}
+
+std::shared_ptr<const ScriptProgram> ScriptScheduler::internProgram(const CompiledScript &script)
+{
+    auto program = std::make_shared<const ScriptProgram>(script);
+    auto &bucket = _programs[program->getStructureHash()];
+
+    for (const auto &entry : bucket) {
+        std::shared_ptr<const ScriptProgram> existing = entry.lock();
+        if (existing && existing->hasSameStructure(*program))
+            return existing;
+    }
+    bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+        [](const std::weak_ptr<const ScriptProgram> &entry) { return entry.expired(); }), bucket.end());
+    bucket.push_back(program);
+    return program;
+}
+
+std::size_t ScriptScheduler::getProgramCount() const
+{
+    std::size_t count = 0;
+
+    for (const auto &bucket : _programs) {
+        for (const auto &entry : bucket.second)
+            count += entry.expired() ? 0 : 1;
+    }
+    return count;
+}
+
+void ScriptScheduler::removeScripts(int objectId)
+{
+    for (std::size_t i = 0; i < _instances.size(); i++) {
+        ScriptInstance &instance = _instances[i];
+        if (!instance.program || instance.objectId != objectId)
+            continue;
+        _wheel.cancel(instance.timer);
+        instance = ScriptInstance();
+        _freeInstances.push_back(static_cast<int>(i));
+    }
+
+    for (ScriptBatch &batch : _batches) {
+        for (std::size_t lane = 0; lane < batch.objectIds.size();) {
+            if (batch.objectIds[lane] != objectId) {
+                lane++;
+                continue;
+            }
+            batch.objectIds[lane] = batch.objectIds.back();
+            batch.objectIds.pop_back();
+            batch.offsetX.pop_back();
+            batch.offsetY.pop_back();
+            batch.offsetZ.pop_back();
+            batch.conditions.pop_back();
+        }
+    }
+    _batches.erase(std::remove_if(_batches.begin(), _batches.end(),
+        [](const ScriptBatch &batch) { return batch.objectIds.empty(); }), _batches.end());
+
+    auto isFree = [this](int index) { return !_instances[index].program; };
+    _updateInstances.erase(std::remove_if(_updateInstances.begin(), _updateInstances.end(), isFree), _updateInstances.end());
+    _readyQueue.erase(std::remove_if(_readyQueue.begin(), _readyQueue.end(), isFree), _readyQueue.end());
+}
+
+void ScriptScheduler::clear()
+{
+    _wheel.clear();
+    _instances.clear();
+    _programs.clear();
+    _freeInstances.clear();
+    _updateInstances.clear();
+    _batches.clear();
+    _readyQueue.clear();
+    _tickRemainder = 0.0f;
+    _started = false;
+}
+
+void ScriptScheduler::setProfiler(ScriptProfiler *profiler)
+{
+    // Slots handed out by another profiler mean nothing to this one
+    if (profiler != _profiler) {
+        for (ScriptInstance &instance : _instances)
+            instance.profileSlot = -1;
+        for (ScriptBatch &batch : _batches)
+            batch.profileSlot = -1;
+    }
+    _profiler = profiler;
+}
+
+void ScriptScheduler::start()
+{
+    _started = true;
+    for (std::size_t i = 0; i < _instances.size(); i++) {
+        if (_instances[i].program && _instances[i].trigger == BlockType::ON_START)
+            trigger(static_cast<int>(i));
+    }
+}
+
+void ScriptScheduler::triggerClick(int objectId)
+{
+    for (std::size_t i = 0; i < _instances.size(); i++) {
+        const ScriptInstance &instance = _instances[i];
+        if (instance.program && instance.trigger == BlockType::ON_CLICK && instance.objectId == objectId)
+            trigger(static_cast<int>(i));
+    }
+}
+
+void ScriptScheduler::triggerKeyPress(const std::string &key)
+{
+    for (std::size_t i = 0; i < _instances.size(); i++) {
+        const ScriptInstance &instance = _instances[i];
+        if (instance.program && instance.trigger == BlockType::ON_KEY_PRESS && instance.key == key)
+            trigger(static_cast<int>(i));
+    }
+}
+
+void ScriptScheduler::update(float deltaTime)
+{
+    _deltaTime = deltaTime;
+    _tickRemainder += deltaTime * TICKS_PER_SECOND;
+
+    std::uint64_t ticks = static_cast<std::uint64_t>(std::max(0.0f, _tickRemainder));
+    _tickRemainder -= static_cast<float>(ticks);
+    if (ticks > 0) {
+        _expired.clear();
+        _wheel.advance(ticks, _expired);
+        for (int index : _expired) {
+            ScriptInstance &instance = _instances[index];
+            instance.timer = TimerWheel::INVALID_HANDLE;
+            instance.state = InstanceState::READY;
+            _readyQueue.push_back(index);
+        }
+    }
+
+    // OnUpdate flows restart once the previous run has fully completed
+    for (int index : _updateInstances)
+        trigger(index);
+
+    runReadyInstances();
+    runBatches();
+    if (_profiler)
+        _profiler->endFrame();
+}
+
+void ScriptScheduler::trigger(int instanceIndex)
+{
+    ScriptInstance &instance = _instances[instanceIndex];
+
+    if (instance.state != InstanceState::IDLE)
+        return;
+    instance.stack.clear();
+    instance.stack.push_back({instance.entryNode, -1});
+    instance.state = InstanceState::READY;
+    _readyQueue.push_back(instanceIndex);
+}
+
+void ScriptScheduler::runReadyInstances()
+{
+    // Instances re-queued while running (step budget exhausted) resume next frame
+    _running.swap(_readyQueue);
+    _readyQueue.clear();
+    for (int index : _running)
+        resume(index);
+    _running.clear();
+}
+
+void ScriptScheduler::pushSuccessors(ScriptInstance &instance, const ProgramNode &node)
+{
+    for (auto it = node.next.rbegin(); it != node.next.rend(); ++it)
+        instance.stack.push_back({*it, -1});
+}
+
+void ScriptScheduler::resume(int instanceIndex)
+{
+    ScriptInstance &instance = _instances[instanceIndex];
+    const ScriptProgram &program = *instance.program;
+    const std::vector<ProgramNode> &nodes = program.getNodes();
+    int budget = MAX_STEPS_PER_RESUME;
+
+    while (!instance.stack.empty()) {
+        if (budget-- <= 0) {
+            std::cerr << "[ScriptScheduler] Script '" << program.getName() << "' exceeded "
+                      << MAX_STEPS_PER_RESUME << " steps in one frame, yielding" << std::endl;
+            instance.state = InstanceState::READY;
+            _readyQueue.push_back(instanceIndex);
+            return;
+        }
+
+        ScriptInstance::Frame frame = instance.stack.back();
+        instance.stack.pop_back();
+        const ProgramNode &node = nodes[frame.node];
+
+        if (frame.remaining >= 0) {
+            if (frame.remaining > 0) {
+                instance.stack.push_back({frame.node, frame.remaining - 1});
+                instance.stack.push_back({node.loopBody, -1});
+            }
+            continue;
+        }
+
+        ScriptProfiler::Scope profile(_profiler, instance.profileSlot < 0 ? -1 : instance.profileSlot + frame.node);
+
+        switch (node.type) {
+            case BlockType::MOVE: {
+                Vector3 direction = node.config.getVector(BlockParams::MOVE_DIRECTION);
+                // Port 0 is the execution input, 1 is Direction, 2 is Speed
+                float speed = program.getInputValue(node, 2, node.config.getFloat(BlockParams::MOVE_SPEED));
+                float distance = speed * _deltaTime;
+                _host.moveObject(instance.objectId, {direction.x * distance, direction.y * distance, direction.z * distance});
+                break;
+            }
+            case BlockType::ROTATE: {
+                Vector3 axis = node.config.getVector(BlockParams::ROTATE_AXIS);
+                _host.rotateObject(instance.objectId, axis, node.config.getFloat(BlockParams::ROTATE_SPEED) * _deltaTime);
+                break;
+            }
+            case BlockType::CHANGE_COLOR: {
+                Vector3 color = node.config.getVector(BlockParams::CHANGE_COLOR_COLOR);
+                _host.setObjectColor(instance.objectId, {toColorChannel(color.x), toColorChannel(color.y), toColorChannel(color.z), 255});
+                break;
+            }
+            case BlockType::HIDE:
+                _host.setObjectVisible(instance.objectId, false);
+                break;
+            case BlockType::SHOW:
+                _host.setObjectVisible(instance.objectId, true);
+                break;
+            case BlockType::LOG:
+                _host.logMessage(instance.objectId, node.config.getString(BlockParams::LOG_MESSAGE));
+                break;
+            case BlockType::IF: {
+                int condition = -1;
+                for (int value : node.values) {
+                    if (value != -1) {
+                        condition = value;
+                        break;
+                    }
+                }
+                int branch = program.evaluateValue(condition) != 0.0f ? node.trueNext : node.falseNext;
+                if (branch != -1)
+                    instance.stack.push_back({branch, -1});
+                continue;
+            }
+            case BlockType::LOOP: {
+                pushSuccessors(instance, node);
+                int iterations = static_cast<int>(node.config.getFloat(BlockParams::LOOP_ITERATIONS));
+                if (node.loopBody != -1 && iterations > 0)
+                    instance.stack.push_back({frame.node, iterations});
+                continue;
+            }
+            case BlockType::DELAY: {
+                pushSuccessors(instance, node);
+                float seconds = std::max(0.0f, node.config.getFloat(BlockParams::DELAY_DURATION));
+                std::uint64_t ticks = static_cast<std::uint64_t>(std::lround(seconds * TICKS_PER_SECOND));
+                instance.timer = _wheel.schedule(ticks, instanceIndex);
+                instance.state = InstanceState::WAITING;
+                return;
+            }
+            default:
+                break;
+        }
+        pushSuccessors(instance, node);
+    }
+    instance.state = InstanceState::IDLE;
+}
+
+bool ScriptScheduler::addToBatch(const std::shared_ptr<const ScriptProgram> &program, int entry, int objectId,
+    int profileSlot)
+{
+    ScriptBatch *target = nullptr;
+
+    for (ScriptBatch &batch : _batches) {
+        if (batch.entryNode == entry && batch.program->hasSameStructure(*program)) {
+            target = &batch;
+            break;
+        }
+    }
+    if (!target) {
+        _batches.emplace_back();
+        target = &_batches.back();
+        target->program = program;
+        target->entryNode = entry;
+        target->profileSlot = profileSlot;
+        // The graph is acyclic, so no path is longer than the node count
+        target->laneLists.resize(program->getNodes().size() * 2 + 3);
+    }
+
+    target->objectIds.push_back(objectId);
+    target->offsetX.push_back(0.0f);
+    target->offsetY.push_back(0.0f);
+    target->offsetZ.push_back(0.0f);
+    target->conditions.push_back(0.0f);
+    return true;
+}
+
+void ScriptScheduler::runBatches()
+{
+    for (ScriptBatch &batch : _batches) {
+        std::size_t count = batch.objectIds.size();
+        std::vector<int> &lanes = batch.laneLists[0];
+
+        lanes.resize(count);
+        for (std::size_t lane = 0; lane < count; lane++)
+            lanes[lane] = static_cast<int>(lane);
+
+        runBatchNode(batch, batch.entryNode, lanes, 0);
+
+        _host.moveObjects(batch.objectIds.data(), batch.offsetX.data(), batch.offsetY.data(),
+            batch.offsetZ.data(), count);
+        std::fill(batch.offsetX.begin(), batch.offsetX.end(), 0.0f);
+        std::fill(batch.offsetY.begin(), batch.offsetY.end(), 0.0f);
+        std::fill(batch.offsetZ.begin(), batch.offsetZ.end(), 0.0f);
+    }
+}
+
+void ScriptScheduler::runBatchNode(ScriptBatch &batch, int nodeIndex, const std::vector<int> &lanes, int depth)
+{
+    if (nodeIndex < 0 || lanes.empty())
+        return;
+
+    const ScriptProgram &program = *batch.program;
+    const ProgramNode &node = program.getNodes()[nodeIndex];
+    std::size_t count = lanes.size();
+    // Successors are profiled on their own, so the scope stops before recursing
+    ScriptProfiler::Scope profile(_profiler, batch.profileSlot < 0 ? -1 : batch.profileSlot + nodeIndex, count);
+
+    switch (node.type) {
+        case BlockType::MOVE: {
+            Vector3 direction = node.config.getVector(BlockParams::MOVE_DIRECTION);
+            float distance = program.getInputValue(node, 2, node.config.getFloat(BlockParams::MOVE_SPEED)) * _deltaTime;
+            float stepX = direction.x * distance;
+            float stepY = direction.y * distance;
+            float stepZ = direction.z * distance;
+            float *offsetX = batch.offsetX.data();
+            float *offsetY = batch.offsetY.data();
+            float *offsetZ = batch.offsetZ.data();
+
+            if (count == batch.objectIds.size()) {
+                // Every lane is active: plain contiguous loops the compiler vectorizes
+                for (std::size_t lane = 0; lane < count; lane++)
+                    offsetX[lane] += stepX;
+                for (std::size_t lane = 0; lane < count; lane++)
+                    offsetY[lane] += stepY;
+                for (std::size_t lane = 0; lane < count; lane++)
+                    offsetZ[lane] += stepZ;
+            } else {
+                for (int lane : lanes) {
+                    offsetX[lane] += stepX;
+                    offsetY[lane] += stepY;
+                    offsetZ[lane] += stepZ;
+                }
+            }
+            break;
+        }
+        case BlockType::ROTATE: {
+            Vector3 axis = node.config.getVector(BlockParams::ROTATE_AXIS);
+            float degrees = node.config.getFloat(BlockParams::ROTATE_SPEED) * _deltaTime;
+            for (int lane : lanes)
+                _host.rotateObject(batch.objectIds[lane], axis, degrees);
+            break;
+        }
+        case BlockType::CHANGE_COLOR: {
+            Vector3 color = node.config.getVector(BlockParams::CHANGE_COLOR_COLOR);
+            Color tint = {toColorChannel(color.x), toColorChannel(color.y), toColorChannel(color.z), 255};
+            for (int lane : lanes)
+                _host.setObjectColor(batch.objectIds[lane], tint);
+            break;
+        }
+        case BlockType::HIDE:
+        case BlockType::SHOW:
+            for (int lane : lanes)
+                _host.setObjectVisible(batch.objectIds[lane], node.type == BlockType::SHOW);
+            break;
+        case BlockType::LOG: {
+            const std::string &message = node.config.getString(BlockParams::LOG_MESSAGE);
+            for (int lane : lanes)
+                _host.logMessage(batch.objectIds[lane], message);
+            break;
+        }
+        case BlockType::IF: {
+            int condition = -1;
+            for (int value : node.values) {
+                if (value != -1) {
+                    condition = value;
+                    break;
+                }
+            }
+            for (int lane : lanes)
+                batch.conditions[lane] = program.evaluateValue(condition);
+
+            // Compact the active lanes into one list per branch
+            std::vector<int> &trueLanes = batch.laneLists[depth * 2 + 1];
+            std::vector<int> &falseLanes = batch.laneLists[depth * 2 + 2];
+            trueLanes.clear();
+            falseLanes.clear();
+            for (int lane : lanes)
+                (batch.conditions[lane] != 0.0f ? trueLanes : falseLanes).push_back(lane);
+            profile.stop();
+            runBatchNode(batch, node.trueNext, trueLanes, depth + 1);
+            runBatchNode(batch, node.falseNext, falseLanes, depth + 1);
+            return;
+        }
+        default:
+            break;
+    }
+
+    profile.stop();
+    for (int next : node.next)
+        runBatchNode(batch, next, lanes, depth + 1);
+}
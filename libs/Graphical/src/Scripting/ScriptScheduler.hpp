@@ -0,0 +1,195 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** ScriptScheduler
+*/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CompiledScript.hpp"
+#include "ScriptProfiler.hpp"
+#include "TimerWheel.hpp"
+#include "../../includes/Scripting/IScriptHost.hpp"
+
+namespace scripting
+{
+    /**
+     * @brief Compiled node with its links resolved to node indices
+     */
+    struct ProgramNode {
+        BlockType type = BlockType::INVALID;
+        BlockConfig config;
+        std::vector<int> next;          ///< Execution successors, in port order
+        int trueNext = -1;
+        int falseNext = -1;
+        int loopBody = -1;
+        std::vector<int> values;        ///< Value nodes by input port, -1 when unconnected
+    };
+
+    /**
+     * @brief Immutable, index-based form of a CompiledScript shared by all its instances
+     *
+     * One program serves every object whose compiled script has the same
+     * structure; the name is that of the first script it was built from.
+     */
+    class ScriptProgram
+    {
+        public:
+            explicit ScriptProgram(const CompiledScript &script);
+            ~ScriptProgram() = default;
+
+            const std::string &getName() const { return _name; };
+            const std::vector<ProgramNode> &getNodes() const { return _nodes; };
+            const std::vector<int> &getEntryPoints() const { return _entryPoints; };
+
+            float evaluateValue(int nodeIndex) const;
+            float getInputValue(const ProgramNode &node, int port, float fallback) const;
+
+            /**
+             * @brief Hash of the node graph and configs, independent of the owning object
+             */
+            std::size_t getStructureHash() const { return _structureHash; };
+            bool hasSameStructure(const ScriptProgram &other) const;
+
+            /**
+             * @brief Whether every entity can step this program in lockstep
+             *
+             * True for acyclic programs without DELAY or LOOP: they never suspend,
+             * and their step count per frame is bounded by the graph size.
+             */
+            bool isBatchable() const { return _batchable; };
+
+        protected:
+        private:
+            std::size_t computeStructureHash() const;
+            bool computeBatchable() const;
+
+            std::string _name;
+            std::vector<ProgramNode> _nodes;
+            std::vector<int> _entryPoints;
+            std::size_t _structureHash = 0;
+            bool _batchable = false;
+    };
+
+    enum class InstanceState {
+        IDLE,       ///< Not running, waiting for its trigger
+        READY,      ///< Queued to resume on the next run
+        WAITING     ///< Suspended in the timer wheel
+    };
+
+    /**
+     * @brief One resumable execution of a script from a single entry point
+     *
+     * The instance is a coroutine whose continuation is an explicit stack of
+     * frames, which lets DELAY suspend mid-flow (even inside a LOOP body) and
+     * resume exactly where it stopped.
+     */
+    struct ScriptInstance {
+        struct Frame {
+            int node;
+            int remaining;              ///< Loop iterations left, -1 for a plain node
+        };
+
+        std::shared_ptr<const ScriptProgram> program;
+        int objectId = -1;
+        int entryNode = -1;
+        BlockType trigger = BlockType::INVALID;
+        std::string key;                ///< Key name for OnKeyPress instances
+        InstanceState state = InstanceState::IDLE;
+        std::vector<Frame> stack;
+        TimerWheel::Handle timer = TimerWheel::INVALID_HANDLE;
+        int profileSlot = -1;           ///< Profiler counter of the program's first node, -1 if not profiled
+    };
+
+    /**
+     * @brief OnUpdate flow shared by many objects, stored as one lane per object
+     *
+     * Every node runs once over all lanes. MOVE accumulates into the offset
+     * arrays and IF compacts the lanes into a true and a false list.
+     */
+    struct ScriptBatch {
+        std::shared_ptr<const ScriptProgram> program;
+        int entryNode = -1;
+        std::vector<int> objectIds;
+        std::vector<float> offsetX;
+        std::vector<float> offsetY;
+        std::vector<float> offsetZ;
+        std::vector<float> conditions;
+        std::vector<std::vector<int>> laneLists;    ///< Active lanes, two lists per graph depth
+        int profileSlot = -1;
+    };
+
+    /**
+     * @brief Runs compiled scripts cooperatively against a scene host
+     *
+     * Only instances that are ready are visited each frame; instances parked
+     * on a DELAY sit in the timer wheel and cost nothing until they expire.
+     * OnUpdate flows that never suspend are grouped by program structure and
+     * run as batches instead of one instance per object.
+     */
+    class ScriptScheduler
+    {
+        public:
+            static constexpr float TICKS_PER_SECOND = 1000.0f;
+            static constexpr int MAX_STEPS_PER_RESUME = 4096;
+
+            explicit ScriptScheduler(IScriptHost &host);
+            ~ScriptScheduler() = default;
+
+            void addScript(const CompiledScript &script);
+            void removeScripts(int objectId);
+            void clear();
+
+            /**
+             * @brief Record per-node counts and times of the scripts added from now on
+             *
+             * Pass nullptr to stop profiling. The profiler must outlive the scheduler
+             * or be detached first.
+             */
+            void setProfiler(ScriptProfiler *profiler);
+            ScriptProfiler *getProfiler() const { return _profiler; };
+
+            void start();
+            void triggerClick(int objectId);
+            void triggerKeyPress(const std::string &key);
+            void update(float deltaTime);
+
+            std::size_t getInstanceCount() const { return _instances.size() - _freeInstances.size(); };
+            std::size_t getWaitingCount() const { return _wheel.getPendingCount(); };
+            std::size_t getBatchCount() const { return _batches.size(); };
+            std::size_t getProgramCount() const;    ///< Distinct programs in use
+            bool isStarted() const { return _started; };
+
+        protected:
+        private:
+            std::shared_ptr<const ScriptProgram> internProgram(const CompiledScript &script);
+            void trigger(int instanceIndex);
+            void runReadyInstances();
+            void resume(int instanceIndex);
+            void pushSuccessors(ScriptInstance &instance, const ProgramNode &node);
+            bool addToBatch(const std::shared_ptr<const ScriptProgram> &program, int entry, int objectId, int profileSlot);
+            void runBatches();
+            void runBatchNode(ScriptBatch &batch, int nodeIndex, const std::vector<int> &lanes, int depth);
+
+            IScriptHost &_host;
+            ScriptProfiler *_profiler = nullptr;
+            TimerWheel _wheel;
+            std::vector<ScriptInstance> _instances;
+            std::vector<int> _freeInstances;
+            std::vector<int> _updateInstances;
+            std::vector<ScriptBatch> _batches;
+            std::unordered_map<std::size_t, std::vector<std::weak_ptr<const ScriptProgram>>> _programs; ///< By structure hash
+            std::vector<int> _readyQueue;
+            std::vector<int> _running;
+            std::vector<int> _expired;
+            float _tickRemainder = 0.0f;
+            float _deltaTime = 0.0f;
+            bool _started = false;
+    };
+}
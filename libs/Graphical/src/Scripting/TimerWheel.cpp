@@ -0,0 +1,186 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** TimerWheel
+*/
+
+#include "TimerWheel.hpp"
+
+#include <algorithm>
+
+using namespace scripting;
+
+TimerWheel::TimerWheel()
+{
+    _slotHeads.assign(ROOT_SIZE + (LEVELS - 1) * LEVEL_SIZE, -1);
+}
+
+TimerWheel::Handle TimerWheel::schedule(std::uint64_t delayTicks, int payload)
+{
+    int index = allocateTimer();
+    Timer &timer = _timers[index];
+
+    timer.deadline = _currentTick + delayTicks;
+    timer.payload = payload;
+    insertTimer(index);
+    _pendingCount++;
+    return (static_cast<Handle>(timer.generation) << 32) | static_cast<std::uint32_t>(index);
+}
+
+bool TimerWheel::cancel(Handle handle)
+{
+    if (handle == INVALID_HANDLE)
+        return false;
+
+    std::uint32_t index = static_cast<std::uint32_t>(handle & 0xFFFFFFFFu);
+    std::uint32_t generation = static_cast<std::uint32_t>(handle >> 32);
+
+    if (index >= _timers.size())
+        return false;
+    Timer &timer = _timers[index];
+    if (timer.generation != generation || timer.slot < 0)
+        return false;
+
+    unlinkTimer(index);
+    releaseTimer(index);
+    _pendingCount--;
+    return true;
+}
+
+void TimerWheel::advance(std::uint64_t ticks, std::vector<int> &expired)
+{
+    std::vector<int> slotTimers;
+
+    for (std::uint64_t step = 0; step < ticks; step++) {
+        int rootIndex = static_cast<int>(_currentTick & (ROOT_SIZE - 1));
+
+        if (rootIndex == 0) {
+            for (int level = 1; level < LEVELS; level++) {
+                if (cascade(level))
+                    break;
+            }
+        }
+
+        // Detach the whole slot first: expired callbacks never touch it,
+        // but timers that are not due yet get reinserted elsewhere.
+        slotTimers.clear();
+        for (int i = _slotHeads[rootIndex]; i != -1; i = _timers[i].next)
+            slotTimers.push_back(i);
+        _slotHeads[rootIndex] = -1;
+
+        // Slots are filled head-first, walk backwards to keep FIFO order
+        for (auto it = slotTimers.rbegin(); it != slotTimers.rend(); ++it) {
+            Timer &timer = _timers[*it];
+            timer.slot = -1;
+            timer.prev = -1;
+            timer.next = -1;
+            if (timer.deadline <= _currentTick) {
+                expired.push_back(timer.payload);
+                releaseTimer(*it);
+                _pendingCount--;
+            } else {
+                insertTimer(*it);
+            }
+        }
+        _currentTick++;
+    }
+}
+
+void TimerWheel::clear()
+{
+    std::fill(_slotHeads.begin(), _slotHeads.end(), -1);
+    _freeTimers.clear();
+    for (int i = static_cast<int>(_timers.size()) - 1; i >= 0; i--) {
+        if (_timers[i].slot >= 0)
+            _timers[i].generation = std::max<std::uint32_t>(1, _timers[i].generation + 1);
+        _timers[i].slot = -1;
+        _timers[i].prev = -1;
+        _timers[i].next = -1;
+        _freeTimers.push_back(i);
+    }
+    _pendingCount = 0;
+}
+
+int TimerWheel::allocateTimer()
+{
+    if (!_freeTimers.empty()) {
+        int index = _freeTimers.back();
+        _freeTimers.pop_back();
+        return index;
+    }
+    _timers.emplace_back();
+    return static_cast<int>(_timers.size()) - 1;
+}
+
+void TimerWheel::releaseTimer(int index)
+{
+    Timer &timer = _timers[index];
+
+    timer.slot = -1;
+    timer.prev = -1;
+    timer.next = -1;
+    timer.generation = std::max<std::uint32_t>(1, timer.generation + 1);
+    _freeTimers.push_back(index);
+}
+
+void TimerWheel::insertTimer(int index)
+{
+    Timer &timer = _timers[index];
+    std::uint64_t delta = timer.deadline > _currentTick ? timer.deadline - _currentTick : 0;
+    std::uint64_t placement = timer.deadline;
+    int slot = -1;
+
+    if (delta < ROOT_SIZE) {
+        slot = static_cast<int>(std::max(placement, _currentTick) & (ROOT_SIZE - 1));
+    } else {
+        // Far timers are parked at the wheel's horizon and re-cascaded until due
+        if (delta > MAX_DELAY)
+            placement = _currentTick + MAX_DELAY;
+        for (int level = 1; level < LEVELS; level++) {
+            int shift = ROOT_BITS + (level - 1) * LEVEL_BITS;
+            if (delta < (std::uint64_t(1) << (shift + LEVEL_BITS)) || level == LEVELS - 1) {
+                slot = ROOT_SIZE + (level - 1) * LEVEL_SIZE + static_cast<int>((placement >> shift) & (LEVEL_SIZE - 1));
+                break;
+            }
+        }
+    }
+
+    timer.slot = slot;
+    timer.prev = -1;
+    timer.next = _slotHeads[slot];
+    if (timer.next != -1)
+        _timers[timer.next].prev = index;
+    _slotHeads[slot] = index;
+}
+
+void TimerWheel::unlinkTimer(int index)
+{
+    Timer &timer = _timers[index];
+
+    if (timer.prev != -1)
+        _timers[timer.prev].next = timer.next;
+    else
+        _slotHeads[timer.slot] = timer.next;
+    if (timer.next != -1)
+        _timers[timer.next].prev = timer.prev;
+    timer.slot = -1;
+    timer.prev = -1;
+    timer.next = -1;
+}
+
+bool TimerWheel::cascade(int level)
+{
+    int shift = ROOT_BITS + (level - 1) * LEVEL_BITS;
+    int levelIndex = static_cast<int>((_currentTick >> shift) & (LEVEL_SIZE - 1));
+    int slot = ROOT_SIZE + (level - 1) * LEVEL_SIZE + levelIndex;
+    int current = _slotHeads[slot];
+
+    _slotHeads[slot] = -1;
+    while (current != -1) {
+        int next = _timers[current].next;
+        insertTimer(current);
+        current = next;
+    }
+    return levelIndex != 0;
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** Iso
+** File description:
+** TimerWheel
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace scripting
+{
+    /**
+     * @brief Hierarchical timer wheel used to park suspended scripts
+     *
+     * Timers live in a pooled array and are linked into per-slot intrusive
+     * lists, so scheduling and cancelling are O(1) and advancing costs one
+     * slot visit per tick plus the occasional cascade. Level 0 resolves single
+     * ticks over 256 slots, each higher level covers 64 times the range of the
+     * one below it.
+     */
+    class TimerWheel
+    {
+        public:
+            using Handle = std::uint64_t;
+            static constexpr Handle INVALID_HANDLE = 0;
+
+            TimerWheel();
+            ~TimerWheel() = default;
+
+            /**
+             * @brief Schedule a payload to expire after a number of ticks
+             *
+             * @param delayTicks Ticks from now, 0 expires on the next advance
+             * @param payload Value reported back when the timer expires
+             * @return Handle usable with cancel()
+             */
+            Handle schedule(std::uint64_t delayTicks, int payload);
+
+            /**
+             * @brief Cancel a pending timer
+             *
+             * @return false if the timer already expired or the handle is stale
+             */
+            bool cancel(Handle handle);
+
+            /**
+             * @brief Advance the wheel and collect expired payloads
+             *
+             * @param ticks Number of ticks to advance
+             * @param expired Payloads are appended in expiry order
+             */
+            void advance(std::uint64_t ticks, std::vector<int> &expired);
+
+            void clear();
+
+            std::uint64_t getCurrentTick() const { return _currentTick; };
+            std::size_t getPendingCount() const { return _pendingCount; };
+
+        protected:
+        private:
+            struct Timer {
+                std::uint64_t deadline = 0;
+                int payload = 0;
+                int prev = -1;
+                int next = -1;
+                int slot = -1;
+                std::uint32_t generation = 1;
+            };
+
+            static constexpr int ROOT_BITS = 8;
+            static constexpr int LEVEL_BITS = 6;
+            static constexpr int LEVELS = 4;
+            static constexpr int ROOT_SIZE = 1 << ROOT_BITS;
+            static constexpr int LEVEL_SIZE = 1 << LEVEL_BITS;
+            static constexpr std::uint64_t MAX_DELAY = (std::uint64_t(1) << (ROOT_BITS + (LEVELS - 1) * LEVEL_BITS)) - 1;
+
+            int allocateTimer();
+            void releaseTimer(int index);
+            void insertTimer(int index);
+            void unlinkTimer(int index);
+            bool cascade(int level);
+
+            std::vector<Timer> _timers;
+            std::vector<int> _freeTimers;
+            std::vector<int> _slotHeads;
+            std::uint64_t _currentTick = 0;
+            std::size_t _pendingCount = 0;
+    };
+}
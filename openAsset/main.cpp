@@ -110,7 +110,7 @@ void unloadData(AssetType type, std::shared_ptr<objects::Character> character, M
 
 void drawImagePreview(std::shared_ptr<objects::Character> character, Rectangle viewport, float scale)
 {
-    character->updateAnimation();
+    character->advanceAnimation(GetFrameTime());
     character->draw(viewport, 0);
 }
 
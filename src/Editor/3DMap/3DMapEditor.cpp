@@ -1,4 +1,5 @@
 #include "iostream"
+#include <algorithm>
 #include <filesystem>
 
 #include "3DMapEditor.hpp"
@@ -35,6 +36,11 @@ void MapEditor::update(input::IHandlerBase &inputHandler)
         std::cerr << "[ERROR] MapEditor::_camera is null in update()\n";
         return;
     }
+    if (_simulation) {
+        // Editing tools stay idle while the game owns the input
+        _simulation->update(inputHandler, GetFrameTime());
+        return;
+    }
     _cursorPosition = inputHandler.getCursorCoords();
     updateCursor();;
 
@@ -102,6 +108,9 @@ void MapEditor::update(input::IHandlerBase &inputHandler)
 
 void MapEditor::draw2DElements(Rectangle mainViewArea, std::shared_ptr<Render::Camera> camera)
 {
+    // With a camera the sprites were drawn in the 3D pass
+    if (_camera)
+        return;
     for (auto i = _objects2D.begin(); i != _objects2D.end(); i++) {
         i->get()->draw(mainViewArea, camera);
     }
@@ -114,6 +123,13 @@ void MapEditor::draw3DElements()
     for (auto i = _objects3D.begin(); i != _objects3D.end(); i++) {
         i->get()->draw();
     }
+    if (_camera) {
+        _spriteBatch.clear();
+        for (auto i = _objects2D.begin(); i != _objects2D.end(); i++) {
+            i->get()->draw(_spriteBatch);
+        }
+        _spriteBatch.draw(_camera->getRaylibCam());
+    }
 
     if (_currentTool == 4) {
         Vector3 size = (Vector3){ _cubeHeight, _cubeHeight, _cubeHeight };
@@ -127,11 +143,17 @@ void MapEditor::draw(Rectangle mainViewArea, std::shared_ptr<Render::Camera> cam
     // Draw 3D elements
     BeginScissorMode(mainViewArea.x, mainViewArea.y, mainViewArea.width, mainViewArea.height);
     _camera->start3D();
-    draw3DElements();
+    if (_simulation)
+        _simulation->draw3D();
+    else
+        draw3DElements();
     _camera->end3D();
     EndScissorMode();
     // Draw 2D elements
-    draw2DElements(mainViewArea, camera);
+    if (_simulation)
+        _simulation->draw2D(mainViewArea);
+    else
+        draw2DElements(mainViewArea, camera);
 }
 
 void MapEditor::changeCubeType(Asset3D newAsset)
@@ -166,6 +188,13 @@ void MapEditor::addCube(Vector3D position)
     std::cout << "ADD NEW CUBE POS: " << position.x << " " << position.y << " " << position.z << std::endl;
     _objects3D.push_back(newCube);
     updateCursor();
+
+    livelink::Message message;
+    message.type = livelink::MessageType::CUBE_ADDED;
+    message.position = position.convert();
+    message.path = _currentCubeType.getFileName();
+    message.scale = _currentCubeType.getScale();
+    sendLiveLink(message);
 }
 
 void MapEditor::addPlayer(Vector3D position, int totalFrames)
@@ -190,16 +219,34 @@ void MapEditor::addPlayer(Vector3D position, int totalFrames)
     _spriteSize = {_currentSpriteType.getWidth(), _currentSpriteType.getHeight()};
     newCharacter->setTotalFrames(totalFrames);
     _objects2D.push_back(newCharacter);
+
+    livelink::Message message;
+    message.type = livelink::MessageType::SPRITE_ADDED;
+    message.position = position.convert();
+    message.path = _currentSpriteType.getFileName();
+    message.width = _currentSpriteType.getWidth();
+    message.height = _currentSpriteType.getHeight();
+    message.scale = _currentSpriteType.getScale();
+    message.frames = totalFrames;
+    sendLiveLink(message);
 }
 
 void MapEditor::removeCube(std::vector<std::shared_ptr<MapElement>>::iterator toRemove)
 {
+    livelink::Message message;
+    message.type = livelink::MessageType::CUBE_REMOVED;
+    message.position = toRemove->get()->getBoxPosition().convert();
     _objects3D.erase(toRemove);
+    sendLiveLink(message);
 }
 
 void MapEditor::removePlayer(std::vector<std::shared_ptr<Character>>::iterator toRemove)
 {
+    livelink::Message message;
+    message.type = livelink::MessageType::SPRITE_REMOVED;
+    message.index = static_cast<int>(std::distance(_objects2D.begin(), toRemove));
     _objects2D.erase(toRemove);
+    sendLiveLink(message);
 }
 
 void MapEditor::findPositionFromHit(RayCollision &hit)
@@ -246,12 +293,14 @@ void MapEditor::updateCursor()
         }
     }
 
-    for (auto i = _objects2D.begin(); i != _objects2D.end(); i++) {
-        RayCollision collision = GetRayCollisionBox(ray, i->get()->getBox3D().convert());
-        if (collision.hit && collision.distance < closestHit.distance) {
-            closestHit = collision;
-            _closestSprite = i;
-        }
+    // Sprites are picked through the tree, it only follows the ones that moved
+    _spriteTree.sync(_objects2D);
+    float spriteDistance = 0.0f;
+    int sprite = _spriteTree.raycast(ray, closestHit.distance, spriteDistance);
+    if (sprite != -1) {
+        // The sprite stands in front of the cube: the hit has no cube face to place against
+        _closestObject = std::nullopt;
+        _closestSprite = _objects2D.begin() + sprite;
     }
 
     // if there was a hit, we adapt the position of the cube to be placed
@@ -290,6 +339,17 @@ void MapEditor::saveMap(const std::string& filename)
         file << pos2D.x << " " << pos2D.y << " " << pos2D.z << " " << obj->getAsset2D().getFileName() << " " << obj->getBox2D().getSize().x << " " << obj->getBox2D().getSize().y << " " << obj->getAsset2D().getScale() << " " << obj->getTotalFrames() << "\n";
     }
 
+    // Clips come last, so readers that stop after the sprites still load the map
+    std::vector<std::string> clips;
+    for (std::size_t i = 0; i < _objects2D.size(); i++) {
+        for (const AnimationClip &clip : _objects2D[i]->getAsset2D().getClips())
+            clips.push_back(std::to_string(i) + " " + AnimationSet::formatClip(clip));
+    }
+    file << "CLIPS\n";
+    file << clips.size() << "\n";
+    for (const std::string &clip : clips)
+        file << clip << "\n";
+
     file.close();
     std::cout << "Map saved to: " << filename << "\n";
 }
@@ -308,6 +368,10 @@ void MapEditor::loadMap(const std::string& filename)
     if (header == "MAP") {
         file >> count;
         _objects3D.clear();
+        _objects2D.clear();
+        livelink::Message cleared;
+        cleared.type = livelink::MessageType::MAP_CLEARED;
+        sendLiveLink(cleared);
         for (int i = 0; i < count; ++i) {
             Vector3 position;
             std::string filePath;
@@ -348,22 +412,124 @@ void MapEditor::loadMap(const std::string& filename)
             tmpAsset.setWidth(size.x);
             tmpAsset.setHeight(size.y);
             tmpAsset.setFramesCount(totalFrames);
+            tmpAsset.buildAnimations();
             changeSpriteType(tmpAsset);
             addPlayer(position, totalFrames);
             std::cout << "ADD NEW PLAYER : " << i << "\n";
         }
     }
+    loadClips(file);
     file.close();
     std::cout << "Map loaded.\n";
 }
 
+void MapEditor::loadClips(std::ifstream& file)
+{
+    std::string header;
+    std::size_t count = 0;
+
+    if (!(file >> header) || header != "CLIPS")
+        return;
+    file >> count;
+    std::vector<std::vector<AnimationClip>> clips(_objects2D.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t sprite = 0;
+        std::string line;
+        AnimationClip clip;
+        file >> sprite;
+        std::getline(file, line);
+        if (sprite < clips.size() && AnimationSet::parseClip(line, clip))
+            clips[sprite].push_back(clip);
+    }
+    for (std::size_t i = 0; i < clips.size(); ++i) {
+        if (clips[i].empty())
+            continue;
+        Asset2D &asset = _objects2D[i]->getAsset2D();
+        asset.setClips(clips[i]);
+        asset.buildAnimations();
+        _objects2D[i]->setAnimations(asset.getAnimations());
+    }
+}
+
 void MapEditor::gameCompilation(const std::string& gameProjectName)
 {
-    std::string script = gameProjectName + "/install-linux.sh";
+    if (_exportJob.isRunning()) {
+        std::cout << "Export already in progress\n";
+        return;
+    }
+    saveMap(gameProjectName + "/assets/maps/game_map.dat");
+
+    // Build and launch run in the background, see the Build tab of the bottom bar
+    _exportJob.start(gameProjectName, getReferencedAssets());
+}
 
-    saveMap("game_project/assets/maps/game_map.dat");
-    system(script.c_str());
-    system("./game_project/GenericGame");
+GameExportJob& MapEditor::getExportJob()
+{
+    return _exportJob;
+}
+
+void MapEditor::startPlay(const std::vector<CompiledScript>& scripts, const std::string& profilePath)
+{
+    if (_simulation || !_camera)
+        return;
+
+    PlaySnapshot snapshot{_objects3D, _objects2D, {}, {}, *_camera};
+    for (auto& obj : _objects3D)
+        snapshot.positions3D.push_back(obj->getBoxPosition());
+    for (auto& obj : _objects2D)
+        snapshot.positions2D.push_back(obj->getBoxPosition());
+    _playSnapshot.emplace(std::move(snapshot));
+
+    _simulation = std::make_unique<gameplay::GameSimulation>(_objects3D, _objects2D, _camera);
+    if (!profilePath.empty())
+        _simulation->enableProfiling(profilePath);
+    for (const CompiledScript& script : scripts)
+        _simulation->addScript(script);
+    _simulation->start();
+    std::cout << "[MapEditor] Play started with " << scripts.size() << " scripts" << std::endl;
+}
+
+void MapEditor::stopPlay()
+{
+    if (!_simulation)
+        return;
+
+    _simulation->saveProfile();
+    _simulation.reset();
+    _objects3D = _playSnapshot->objects3D;
+    _objects2D = _playSnapshot->objects2D;
+    for (size_t i = 0; i < _objects3D.size(); i++)
+        _objects3D[i]->setBox3DPosition(_playSnapshot->positions3D[i]);
+    for (size_t i = 0; i < _objects2D.size(); i++) {
+        _objects2D[i]->setBox3DPosition(_playSnapshot->positions2D[i]);
+        _objects2D[i]->setMoving(false);
+    }
+    *_camera = _playSnapshot->camera;
+    _playSnapshot.reset();
+
+    // Iterators into the lists were invalidated by the restore
+    _closestObject = std::nullopt;
+    _closestSprite = std::nullopt;
+    notifySceneChanged();
+    std::cout << "[MapEditor] Play stopped" << std::endl;
+}
+
+bool MapEditor::isPlaying() const
+{
+    return _simulation != nullptr;
+}
+
+std::vector<std::string> MapEditor::getReferencedAssets()
+{
+    std::vector<std::string> assets;
+
+    for (auto& obj : _objects3D)
+        assets.push_back(obj->getAsset3D().getFileName());
+    for (auto& obj : _objects2D)
+        assets.push_back(obj->getAsset2D().getFileName());
+    std::sort(assets.begin(), assets.end());
+    assets.erase(std::unique(assets.begin(), assets.end()), assets.end());
+    return assets;
 }
 
 void MapEditor::setupEventHandlers()
@@ -388,7 +554,7 @@ void MapEditor::setupEventHandlers()
     });
     
     UI::g_eventDispatcher.subscribe(UI::EditorEventType::OBJECT_DELETED, [this](const UI::EditorEvent& event) {
-        if (std::holds_alternative<int>(event.data)) {
+        if (std::holds_alternative<int>(event.data) && !isPlaying()) {
             int objectId = std::get<int>(event.data);
             if (objectId >= 0 && objectId < _objects3D.size() && _blocSelect) {
                 auto it = _objects3D.begin() + objectId;
@@ -452,14 +618,20 @@ void MapEditor::handleToolChanged(int toolIndex)
 
 void MapEditor::handleFileAction(UI::EditorEventType actionType, const std::string& filepath)
 {
+    // File actions work on the edited scene, not on the one being played
+    stopPlay();
     switch (actionType) {
-        case UI::EditorEventType::FILE_NEW:
+        case UI::EditorEventType::FILE_NEW: {
             // Clear current scene
             _objects3D.clear();
             _objects2D.clear();
+            livelink::Message cleared;
+            cleared.type = livelink::MessageType::MAP_CLEARED;
+            sendLiveLink(cleared);
             notifySceneChanged();
             std::cout << "New scene created" << std::endl;
             break;
+        }
         case UI::EditorEventType::FILE_SAVE:
             saveMap("game_project/assets/maps/game_map.dat");
             std::cout << "Map saved" << std::endl;
@@ -665,6 +837,9 @@ bool MapEditor::selectObject(int objectId)
 
 bool MapEditor::deleteObject(int objectId)
 {
+    if (isPlaying())
+        return false;
+
     // Check if it's a 3D object
     if (objectId >= 0 && objectId < static_cast<int>(_objects3D.size()) && _blocSelect) {
         auto it = _objects3D.begin() + objectId;
@@ -717,3 +892,14 @@ void MapEditor::setLoader(std::shared_ptr<AssetLoader> loader)
     _objects3DLoaded = _loader->getLoaded3DAssets();
     _objects2DLoaded = _loader->getLoaded2DAssets();
 }
+
+void MapEditor::setLiveLink(std::shared_ptr<livelink::LiveLinkClient> liveLink)
+{
+    _liveLink = liveLink;
+}
+
+void MapEditor::sendLiveLink(const livelink::Message& message)
+{
+    if (_liveLink)
+        _liveLink->send(message);
+}
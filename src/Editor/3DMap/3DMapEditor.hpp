@@ -9,6 +9,8 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <optional>
 #include <limits>
 #include "raylib.h"
 #include "rlgl.h"
@@ -23,11 +25,14 @@
 
 #include "Entities/MapElement.hpp"
 #include "Entities/Character.hpp"
+#include "Gameplay/GameSimulation.hpp"
+#include "LiveLink/LiveLink.hpp"
 
 #include "../../UI/EditorEvents.hpp"
 #include "../../UI/SceneObject.hpp"
 
 #include "../../Utilities/LoadedAssets.hpp"
+#include "../../Utilities/GameExportJob.hpp"
 
 using namespace Utilities;
 using namespace objects;
@@ -126,7 +131,7 @@ class MapEditor : public UI::ISceneProvider {
         /**
          * @brief Draw 3D scene elements
          * 
-         * Renders all 3D objects, the grid, and preview objects in the scene.
+         * Renders all 3D objects, the grid, the sprites and preview objects in the scene.
          */
         void draw3DElements();
 
@@ -223,11 +228,53 @@ class MapEditor : public UI::ISceneProvider {
         /**
          * @brief Compile the map for game runtime
          * 
-         * Generates game-ready assets and data for the specified game project.
+         * Saves the map and starts a background export: the player is rebuilt
+         * only if engine sources changed, the changed assets are copied into
+         * the game project's content directory, then the game is launched.
          * 
          * @param gameProjectName Name of the target game project
          */
         void gameCompilation(const std::string& gameProjectName);
+
+        /**
+         * @brief Get the asset files the map refers to, without duplicates
+         * 
+         * @return std::vector<std::string> Paths as written in the saved map
+         */
+        std::vector<std::string> getReferencedAssets();
+
+        /**
+         * @brief Get the background export started by gameCompilation
+         * 
+         * Must be updated once per frame to make progress.
+         * 
+         * @return GameExportJob& The export job, idle if none was started
+         */
+        GameExportJob& getExportJob();
+
+        /**
+         * @brief Start playing the map inside the viewport
+         * 
+         * Runs the game rules on the objects being edited, so no asset is
+         * reloaded. Their positions, the object lists and the camera are
+         * saved first and put back by stopPlay().
+         * 
+         * @param scripts Compiled scripts of the scripting editor
+         * @param profilePath Where stopPlay() saves the scripts' costs, empty to not profile
+         */
+        void startPlay(const std::vector<CompiledScript>& scripts, const std::string& profilePath = "");
+
+        /**
+         * @brief Stop playing, save the profile and restore the scene as it was edited
+         */
+        void stopPlay();
+
+        /**
+         * @brief Check if the viewport is running the game
+         * 
+         * @return true while playing, false while editing
+         */
+        bool isPlaying() const;
         
         // Event handling
         /**
@@ -361,6 +408,13 @@ class MapEditor : public UI::ISceneProvider {
 
         void setLoader(std::shared_ptr<AssetLoader> loader);
 
+        /**
+         * @brief Set the link used to mirror placement changes into a running game
+         *
+         * @param liveLink Shared editor-side connection, may be null
+         */
+        void setLiveLink(std::shared_ptr<livelink::LiveLinkClient> liveLink);
+
     protected:
     private:
         // Internal helper methods
@@ -372,6 +426,15 @@ class MapEditor : public UI::ISceneProvider {
          * @param hit Ray collision data
          */
         void findPositionFromHit(RayCollision &hit);
+
+        /**
+         * @brief Read the clips saved after the sprites
+         * 
+         * Maps saved before clips existed end after the sprites and keep the default strip.
+         * 
+         * @param file Map stream, positioned after the sprites
+         */
+        void loadClips(std::ifstream& file);
         
         /**
          * @brief Find position from grid intersection
@@ -392,6 +455,22 @@ class MapEditor : public UI::ISceneProvider {
          */
         void updateCursor();
 
+        /**
+         * @brief Forward a scene change to the running game, if one is connected
+         */
+        void sendLiveLink(const livelink::Message& message);
+
+        /**
+         * @brief Editing state put back when play mode stops
+         */
+        struct PlaySnapshot {
+            std::vector<std::shared_ptr<MapElement>> objects3D;
+            std::vector<std::shared_ptr<Character>> objects2D;
+            std::vector<Vector3D> positions3D;
+            std::vector<Vector3D> positions2D;
+            Render::Camera camera;
+        };
+
         // Scene objects
         std::vector<std::shared_ptr<MapElement>> _objects3D; ///< All 3D objects in the scene
         std::vector<std::shared_ptr<Character>> _objects2D;  ///< All 2D objects in the scene
@@ -406,10 +485,18 @@ class MapEditor : public UI::ISceneProvider {
         std::shared_ptr<AssetLoader> _loader;
         std::vector<Asset3D> _objects3DLoaded;            ///< All 3D objects loaded
         std::vector<Asset2D> _objects2DLoaded;             ///< All 2D objects loaded
+        std::shared_ptr<livelink::LiveLinkClient> _liveLink; ///< Connection to a running game
+        GameExportJob _exportJob;                            ///< Export, build and launch in progress
+
+        // Play mode
+        std::unique_ptr<gameplay::GameSimulation> _simulation; ///< Running game, null while editing
+        std::optional<PlaySnapshot> _playSnapshot;           ///< Scene to restore when play stops
+        gameplay::SpriteTree _spriteTree;                    ///< Sprite boxes for cursor picking
 
         // Core references
         std::shared_ptr<Render::Window> _window;             ///< Reference to the application window
         std::shared_ptr<Render::Camera> _camera;             ///< Reference to the 3D camera
+        Render::SpriteBatch _spriteBatch;                    ///< Sprites of the 3D pass, sorted among the cubes
         map::MapGrid _grid;                                  
 
         // Editor state
@@ -0,0 +1,155 @@
+/**
+ * @file BlockTextureCache.cpp
+ * @brief Implementation of the canvas block atlas
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#include "BlockTextureCache.hpp"
+#include "rlgl.h"
+#include <iostream>
+
+BlockTextureCache::BlockTextureCache(Vector2 blockSize)
+    : _blockSize(blockSize),
+      _slotWidth(static_cast<int>(blockSize.x) + MARGIN_X * 2),
+      _slotHeight(static_cast<int>(blockSize.y) + MARGIN_Y * 2),
+      _columns(ATLAS_SIZE / _slotWidth),
+      _rows(ATLAS_SIZE / _slotHeight) {
+    clear();
+}
+
+BlockTextureCache::~BlockTextureCache() {
+    // The GL context may already be gone when the editor is torn down
+    if (_atlasLoaded && IsWindowReady()) {
+        UnloadRenderTexture(_atlas);
+    }
+}
+
+void BlockTextureCache::beginFrame() {
+    _frame++;
+    _rendersThisFrame = 0;
+}
+
+bool BlockTextureCache::prepare(int blockId, Vector2 blockSize, const RenderFunction& render) {
+    if (!accepts(blockSize)) return false;
+
+    auto found = _slotOfBlock.find(blockId);
+    if (found != _slotOfBlock.end()) {
+        _slots[found->second].frame = _frame;
+        return true;
+    }
+
+    if (_rendersThisFrame >= MAX_RENDERS_PER_FRAME || !ensureAtlas()) return false;
+    int slot = acquireSlot();
+    if (slot == -1) return false;
+
+    Rectangle rect = getSlotRect(slot);
+    BeginTextureMode(_atlas);
+
+    // Overwrite the previous occupant, alpha included
+    rlSetBlendFactorsSeparate(RL_ONE, RL_ZERO, RL_ONE, RL_ZERO, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    DrawRectangleRec(rect, BLANK);
+    EndBlendMode();
+
+    // Blend colour as usual but accumulate coverage, leaving premultiplied colour in the slot
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                              RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    render({rect.x + MARGIN_X, rect.y + MARGIN_Y});
+    EndBlendMode();
+
+    EndTextureMode();
+
+    _slots[slot] = {blockId, _frame};
+    _slotOfBlock[blockId] = slot;
+    _rendersThisFrame++;
+    return true;
+}
+
+void BlockTextureCache::beginDraw() {
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+}
+
+bool BlockTextureCache::draw(int blockId, Vector2 position) {
+    auto found = _slotOfBlock.find(blockId);
+    if (found == _slotOfBlock.end()) return false;
+
+    // Render textures are stored bottom-up, hence the negative source height
+    Rectangle rect = getSlotRect(found->second);
+    Rectangle source = {rect.x, ATLAS_SIZE - rect.y - rect.height, rect.width, -rect.height};
+    DrawTextureRec(_atlas.texture, source, {position.x - MARGIN_X, position.y - MARGIN_Y}, WHITE);
+    return true;
+}
+
+void BlockTextureCache::endDraw() {
+    EndBlendMode();
+}
+
+void BlockTextureCache::invalidate(int blockId) {
+    auto found = _slotOfBlock.find(blockId);
+    if (found == _slotOfBlock.end()) return;
+
+    _slots[found->second] = Slot{};
+    _freeSlots.push_back(found->second);
+    _slotOfBlock.erase(found);
+}
+
+void BlockTextureCache::clear() {
+    int capacity = static_cast<int>(getCapacity());
+    _slots.assign(capacity, Slot{});
+    _slotOfBlock.clear();
+    _freeSlots.clear();
+    for (int slot = capacity - 1; slot >= 0; --slot) {
+        _freeSlots.push_back(slot);
+    }
+}
+
+bool BlockTextureCache::accepts(Vector2 blockSize) const {
+    return blockSize.x == _blockSize.x && blockSize.y == _blockSize.y;
+}
+
+bool BlockTextureCache::ensureAtlas() {
+    if (_atlasLoaded) return true;
+    if (_atlasFailed || getCapacity() == 0) return false;
+
+    _atlas = LoadRenderTexture(ATLAS_SIZE, ATLAS_SIZE);
+    if (_atlas.id == 0) {
+        std::cerr << "[BlockTextureCache] Failed to create block atlas, drawing blocks live" << std::endl;
+        _atlasFailed = true;
+        return false;
+    }
+    SetTextureFilter(_atlas.texture, TEXTURE_FILTER_BILINEAR);
+    _atlasLoaded = true;
+    return true;
+}
+
+int BlockTextureCache::acquireSlot() {
+    if (!_freeSlots.empty()) {
+        int slot = _freeSlots.back();
+        _freeSlots.pop_back();
+        return slot;
+    }
+
+    // Evict the block drawn least recently, never one already drawn this frame
+    int oldest = -1;
+    for (int slot = 0; slot < static_cast<int>(_slots.size()); ++slot) {
+        if (_slots[slot].frame == _frame) continue;
+        if (oldest == -1 || _slots[slot].frame < _slots[oldest].frame) {
+            oldest = slot;
+        }
+    }
+    if (oldest != -1) {
+        _slotOfBlock.erase(_slots[oldest].blockId);
+    }
+    return oldest;
+}
+
+Rectangle BlockTextureCache::getSlotRect(int slot) const {
+    return {
+        static_cast<float>((slot % _columns) * _slotWidth),
+        static_cast<float>((slot / _columns) * _slotHeight),
+        static_cast<float>(_slotWidth),
+        static_cast<float>(_slotHeight)
+    };
+}
@@ -0,0 +1,96 @@
+/**
+ * @file BlockTextureCache.hpp
+ * @brief Atlas of pre-rendered canvas blocks
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#pragma once
+
+#include "raylib.h"
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Keeps the full-detail image of static blocks in one render texture
+ *
+ * A block that is not selected, hovered or dragged looks the same from one
+ * frame to the next, so its shadow, header, parameter text and ports are
+ * rendered once into a fixed-size slot of a shared atlas. Drawing it is
+ * then a single textured quad, and all cached blocks share one texture so
+ * they batch together. Slots are reused least-recently-drawn first; a block
+ * that does not get a slot is simply drawn live.
+ *
+ * The atlas holds premultiplied colour, so cached blocks must be drawn
+ * between beginDraw() and endDraw().
+ */
+class BlockTextureCache {
+public:
+    static constexpr int ATLAS_SIZE = 2048;
+    static constexpr int MARGIN_X = 64;              ///< Room for the port labels left and right of the block
+    static constexpr int MARGIN_Y = 12;              ///< Room for the shadow and the top/bottom ports
+    static constexpr int MAX_RENDERS_PER_FRAME = 32; ///< Spreads warming a large graph over several frames
+
+    using RenderFunction = std::function<void(Vector2 origin)>;
+
+    /**
+     * @param blockSize Canvas size of the blocks this cache accepts
+     */
+    explicit BlockTextureCache(Vector2 blockSize = {160, 60});
+    ~BlockTextureCache();
+
+    BlockTextureCache(const BlockTextureCache&) = delete;
+    BlockTextureCache& operator=(const BlockTextureCache&) = delete;
+
+    void beginFrame();
+
+    /**
+     * @brief Make sure a block has an up-to-date slot, rendering it if needed
+     *
+     * Must be called outside of BeginMode2D()/BeginScissorMode(), since it
+     * switches to the atlas render target.
+     *
+     * @param render Draws the block with its top-left corner at origin
+     * @return true if the block can be drawn from the atlas this frame
+     */
+    bool prepare(int blockId, Vector2 blockSize, const RenderFunction& render);
+
+    void beginDraw();
+    bool draw(int blockId, Vector2 position);
+    void endDraw();
+
+    void invalidate(int blockId);
+    void clear();
+
+    bool accepts(Vector2 blockSize) const;
+    bool contains(int blockId) const { return _slotOfBlock.count(blockId) != 0; }
+    size_t getCachedCount() const { return _slotOfBlock.size(); }
+    size_t getCapacity() const { return static_cast<size_t>(_columns) * _rows; }
+
+private:
+    struct Slot {
+        int blockId = -1;
+        uint32_t frame = 0;     ///< Last frame the slot was prepared
+    };
+
+    bool ensureAtlas();
+    int acquireSlot();
+    Rectangle getSlotRect(int slot) const;
+
+    Vector2 _blockSize;
+    int _slotWidth;
+    int _slotHeight;
+    int _columns;
+    int _rows;
+
+    RenderTexture2D _atlas = {};
+    bool _atlasLoaded = false;
+    bool _atlasFailed = false;
+    std::vector<Slot> _slots;
+    std::vector<int> _freeSlots;
+    std::unordered_map<int, int> _slotOfBlock;   ///< Block ID -> slot index
+    uint32_t _frame = 0;
+    int _rendersThisFrame = 0;
+};
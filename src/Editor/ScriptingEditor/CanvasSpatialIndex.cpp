@@ -0,0 +1,153 @@
+/**
+ * @file CanvasSpatialIndex.cpp
+ * @brief Implementation of the canvas block grid
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#include "CanvasSpatialIndex.hpp"
+#include <algorithm>
+#include <cmath>
+
+CanvasSpatialIndex::CanvasSpatialIndex(float cellSize)
+    : _cellSize(cellSize > 0.0f ? cellSize : 256.0f) {}
+
+void CanvasSpatialIndex::clear() {
+    _entries.clear();
+    _cells.clear();
+}
+
+void CanvasSpatialIndex::insert(int id, Rectangle bounds, int order) {
+    if (_entries.count(id)) {
+        update(id, bounds, order);
+        return;
+    }
+
+    Entry entry{bounds, order, getCellRange(bounds)};
+    for (int y = entry.cells.minY; y <= entry.cells.maxY; ++y) {
+        for (int x = entry.cells.minX; x <= entry.cells.maxX; ++x) {
+            _cells[getCellKey(x, y)].push_back(id);
+        }
+    }
+    _entries.emplace(id, entry);
+}
+
+void CanvasSpatialIndex::update(int id, Rectangle bounds, int order) {
+    auto found = _entries.find(id);
+    if (found == _entries.end()) {
+        insert(id, bounds, order);
+        return;
+    }
+
+    // Only re-bucket when the block crossed a cell boundary
+    CellRange cells = getCellRange(bounds);
+    const CellRange& old = found->second.cells;
+    if (cells.minX != old.minX || cells.minY != old.minY || cells.maxX != old.maxX || cells.maxY != old.maxY) {
+        remove(id);
+        insert(id, bounds, order);
+        return;
+    }
+    found->second.bounds = bounds;
+    found->second.order = order;
+}
+
+void CanvasSpatialIndex::remove(int id) {
+    auto found = _entries.find(id);
+    if (found == _entries.end()) return;
+
+    const CellRange& cells = found->second.cells;
+    for (int y = cells.minY; y <= cells.maxY; ++y) {
+        for (int x = cells.minX; x <= cells.maxX; ++x) {
+            auto cell = _cells.find(getCellKey(x, y));
+            if (cell == _cells.end()) continue;
+            std::vector<int>& ids = cell->second;
+            auto it = std::find(ids.begin(), ids.end(), id);
+            if (it != ids.end()) {
+                *it = ids.back();
+                ids.pop_back();
+            }
+            if (ids.empty()) {
+                _cells.erase(cell);
+            }
+        }
+    }
+    _entries.erase(found);
+}
+
+int CanvasSpatialIndex::queryTopmost(Vector2 point) const {
+    int cellX = static_cast<int>(std::floor(point.x / _cellSize));
+    int cellY = static_cast<int>(std::floor(point.y / _cellSize));
+    auto cell = _cells.find(getCellKey(cellX, cellY));
+    if (cell == _cells.end()) return -1;
+
+    int bestId = -1;
+    int bestOrder = 0;
+    for (int id : cell->second) {
+        const Entry& entry = _entries.at(id);
+        const Rectangle& r = entry.bounds;
+        if (point.x >= r.x && point.x <= r.x + r.width && point.y >= r.y && point.y <= r.y + r.height) {
+            if (bestId == -1 || entry.order > bestOrder) {
+                bestId = id;
+                bestOrder = entry.order;
+            }
+        }
+    }
+    return bestId;
+}
+
+void CanvasSpatialIndex::queryRect(Rectangle area, std::vector<int>& out) const {
+    out.clear();
+    _scratch.clear();
+    if (++_queryStamp == 0) {
+        // Stamp wrapped around: forget stale stamps so nothing is skipped by mistake
+        for (auto& entry : _entries) entry.second.queryStamp = 0;
+        _queryStamp = 1;
+    }
+
+    auto visit = [&](const std::vector<int>& ids) {
+        for (int id : ids) {
+            const Entry& entry = _entries.at(id);
+            if (entry.queryStamp == _queryStamp) continue;
+            entry.queryStamp = _queryStamp;
+            if (overlaps(entry.bounds, area)) {
+                _scratch.emplace_back(entry.order, id);
+            }
+        }
+    };
+
+    CellRange range = getCellRange(area);
+    int64_t cellCount = static_cast<int64_t>(range.maxX - range.minX + 1) * (range.maxY - range.minY + 1);
+    if (cellCount > static_cast<int64_t>(_cells.size())) {
+        // Zoomed far out: walking the occupied cells is cheaper than the empty ones
+        for (const auto& cell : _cells) visit(cell.second);
+    } else {
+        for (int y = range.minY; y <= range.maxY; ++y) {
+            for (int x = range.minX; x <= range.maxX; ++x) {
+                auto cell = _cells.find(getCellKey(x, y));
+                if (cell != _cells.end()) visit(cell->second);
+            }
+        }
+    }
+
+    std::sort(_scratch.begin(), _scratch.end());
+    out.reserve(_scratch.size());
+    for (const auto& hit : _scratch) out.push_back(hit.second);
+}
+
+CanvasSpatialIndex::CellRange CanvasSpatialIndex::getCellRange(Rectangle bounds) const {
+    return {
+        static_cast<int>(std::floor(bounds.x / _cellSize)),
+        static_cast<int>(std::floor(bounds.y / _cellSize)),
+        static_cast<int>(std::floor((bounds.x + bounds.width) / _cellSize)),
+        static_cast<int>(std::floor((bounds.y + bounds.height) / _cellSize))
+    };
+}
+
+int64_t CanvasSpatialIndex::getCellKey(int x, int y) {
+    return (static_cast<int64_t>(x) << 32) ^ static_cast<uint32_t>(y);
+}
+
+bool CanvasSpatialIndex::overlaps(Rectangle a, Rectangle b) {
+    return a.x <= b.x + b.width && a.x + a.width >= b.x &&
+           a.y <= b.y + b.height && a.y + a.height >= b.y;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file ConnectionRenderer.cpp
+ * @brief Implementation of the batched connection renderer
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#include "ConnectionRenderer.hpp"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Screen pixels covered by one segment before the curve gets another one
+constexpr float PIXELS_PER_SEGMENT = 12.0f;
+
+// Vertices submitted per rlBegin/rlEnd, kept well under the default render batch size
+constexpr size_t VERTICES_PER_CHUNK = 3 * 1024;
+
+float getCurvature(Vector2 start, Vector2 end) {
+    return std::min(std::abs(end.x - start.x) * 0.5f, 100.0f);
+}
+
+} // namespace
+
+void ConnectionRenderer::beginFrame() {
+    _frame++;
+    _vertices.clear();
+}
+
+void ConnectionRenderer::addConnection(const ConnectionKey& key, Vector2 start, Vector2 end, Color color,
+                                       float thickness, float zoom) {
+    int segments = getSegmentCount(start, end, zoom);
+    CachedCurve& curve = _curves[key];
+
+    if (curve.points.empty() || curve.segments != segments ||
+        curve.start.x != start.x || curve.start.y != start.y ||
+        curve.end.x != end.x || curve.end.y != end.y) {
+        curve.start = start;
+        curve.end = end;
+        curve.segments = segments;
+        curve.hasArrow = tessellate(start, end, segments, curve.points);
+        _tessellations++;
+    }
+    curve.frame = _frame;
+
+    appendCurve(curve.points, curve.hasArrow, color, thickness);
+}
+
+void ConnectionRenderer::retain(const ConnectionKey& key) {
+    auto found = _curves.find(key);
+    if (found != _curves.end()) {
+        found->second.frame = _frame;
+    }
+}
+
+void ConnectionRenderer::flush(Vector2 offset) {
+    for (size_t first = 0; first < _vertices.size(); first += VERTICES_PER_CHUNK) {
+        size_t last = std::min(first + VERTICES_PER_CHUNK, _vertices.size());
+        rlCheckRenderBatchLimit(static_cast<int>(last - first));
+        rlBegin(RL_TRIANGLES);
+        for (size_t i = first; i < last; ++i) {
+            const Vertex& vertex = _vertices[i];
+            rlColor4ub(vertex.color.r, vertex.color.g, vertex.color.b, vertex.color.a);
+            rlVertex2f(vertex.x + offset.x, vertex.y + offset.y);
+        }
+        rlEnd();
+    }
+    _vertices.clear();
+}
+
+void ConnectionRenderer::endFrame() {
+    // Drop curves whose connection was removed or re-routed
+    for (auto it = _curves.begin(); it != _curves.end();) {
+        if (it->second.frame != _frame) {
+            it = _curves.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ConnectionRenderer::drawCurve(Vector2 start, Vector2 end, Color color, float thickness, float zoom) {
+    std::vector<Vertex> pending;
+    pending.swap(_vertices);
+
+    bool hasArrow = tessellate(start, end, getSegmentCount(start, end, zoom), _scratch);
+    appendCurve(_scratch, hasArrow, color, thickness);
+    flush({0, 0});
+
+    _vertices.swap(pending);
+}
+
+int ConnectionRenderer::getSegmentCount(Vector2 start, Vector2 end, float zoom) {
+    float curvature = getCurvature(start, end);
+    Vector2 control1 = {start.x + curvature, start.y};
+    Vector2 control2 = {end.x - curvature, end.y};
+
+    // The control polygon is an upper bound of the curve length
+    float length = std::hypot(control1.x - start.x, control1.y - start.y) +
+                   std::hypot(control2.x - control1.x, control2.y - control1.y) +
+                   std::hypot(end.x - control2.x, end.y - control2.y);
+    int segments = static_cast<int>(std::ceil(length * zoom / PIXELS_PER_SEGMENT));
+    return std::clamp(segments, MIN_SEGMENTS, MAX_SEGMENTS);
+}
+
+bool ConnectionRenderer::tessellate(Vector2 start, Vector2 end, int segments, std::vector<Vector2>& points) {
+    // Calculate control points for smooth bezier curve
+    float curvature = getCurvature(start, end);
+    Vector2 control1 = {start.x + curvature, start.y};
+    Vector2 control2 = {end.x - curvature, end.y};
+
+    points.clear();
+    points.reserve(static_cast<size_t>(segments) + 3);
+    points.push_back(start);
+    for (int i = 1; i <= segments; i++) {
+        float t = static_cast<float>(i) / segments;
+        float u = 1.0f - t;
+        float tt = t * t;
+        float uu = u * u;
+        float uuu = uu * u;
+        float ttt = tt * t;
+
+        points.push_back({
+            uuu * start.x + 3 * uu * t * control1.x + 3 * u * tt * control2.x + ttt * end.x,
+            uuu * start.y + 3 * uu * t * control1.y + 3 * u * tt * control2.y + ttt * end.y
+        });
+    }
+
+    // Arrow head tips; a degenerate direction leaves the curve without an arrow
+    Vector2 direction = {end.x - control2.x, end.y - control2.y};
+    float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    if (length > 0.1f) {
+        direction.x /= length;
+        direction.y /= length;
+        points.push_back({end.x - direction.x * 10 - direction.y * 5, end.y - direction.y * 10 + direction.x * 5});
+        points.push_back({end.x - direction.x * 10 + direction.y * 5, end.y - direction.y * 10 - direction.x * 5});
+        return true;
+    }
+    return false;
+}
+
+void ConnectionRenderer::appendCurve(const std::vector<Vector2>& points, bool hasArrow, Color color, float thickness) {
+    size_t curvePoints = hasArrow ? points.size() - 2 : points.size();
+    if (curvePoints < 2) return;
+
+    float halfThickness = thickness * 0.5f;
+    for (size_t i = 1; i < curvePoints; ++i) {
+        appendSegment(points[i - 1], points[i], color, halfThickness);
+    }
+    if (hasArrow) {
+        const Vector2& tip = points[curvePoints - 1];
+        appendSegment(tip, points[curvePoints], color, halfThickness);
+        appendSegment(tip, points[curvePoints + 1], color, halfThickness);
+    }
+}
+
+void ConnectionRenderer::appendSegment(Vector2 from, Vector2 to, Color color, float halfThickness) {
+    float dx = to.x - from.x;
+    float dy = to.y - from.y;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f) return;
+
+    Vector2 normal = {-dy / length * halfThickness, dx / length * halfThickness};
+    Vector2 a = {from.x + normal.x, from.y + normal.y};
+    Vector2 b = {from.x - normal.x, from.y - normal.y};
+    Vector2 c = {to.x - normal.x, to.y - normal.y};
+    Vector2 d = {to.x + normal.x, to.y + normal.y};
+
+    appendTriangle(a, b, c, color);
+    appendTriangle(a, c, d, color);
+}
+
+void ConnectionRenderer::appendTriangle(Vector2 a, Vector2 b, Vector2 c, Color color) {
+    // raylib culls clockwise triangles; in screen space (y down) that is a positive cross product
+    float cross = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    if (cross > 0.0f) {
+        std::swap(b, c);
+    }
+    _vertices.push_back({a.x, a.y, color});
+    _vertices.push_back({b.x, b.y, color});
+    _vertices.push_back({c.x, c.y, color});
+}
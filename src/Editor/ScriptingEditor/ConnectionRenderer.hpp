@@ -0,0 +1,110 @@
+/**
+ * @file ConnectionRenderer.hpp
+ * @brief Cached Bezier tessellation and batched drawing of script connections
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#pragma once
+
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Identifies a connection by its two ports
+ */
+struct ConnectionKey {
+    int fromBlockId;
+    int fromPortIndex;
+    int toBlockId;
+    int toPortIndex;
+
+    bool operator==(const ConnectionKey& other) const {
+        return fromBlockId == other.fromBlockId && fromPortIndex == other.fromPortIndex &&
+               toBlockId == other.toBlockId && toPortIndex == other.toPortIndex;
+    }
+};
+
+struct ConnectionKeyHash {
+    size_t operator()(const ConnectionKey& key) const {
+        uint64_t hash = static_cast<uint32_t>(key.fromBlockId);
+        hash = hash * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(key.fromPortIndex);
+        hash = hash * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(key.toBlockId);
+        hash = hash * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(key.toPortIndex);
+        return static_cast<size_t>(hash ^ (hash >> 29));
+    }
+};
+
+/**
+ * @brief Draws all canvas connections as one stream of triangles
+ *
+ * Each connection's Bezier curve is tessellated once and kept, in canvas
+ * space, until one of its end points moves or the zoom changes its level
+ * of detail. Panning never re-tessellates. Every frame the visible curves
+ * are appended to a single triangle list that is submitted in one
+ * rlBegin/rlEnd pass, so the whole graph costs one draw call.
+ */
+class ConnectionRenderer {
+public:
+    static constexpr int MIN_SEGMENTS = 2;
+    static constexpr int MAX_SEGMENTS = 24;
+
+    /**
+     * @brief Start a frame; curves not added again before endFrame() are evicted
+     */
+    void beginFrame();
+    void addConnection(const ConnectionKey& key, Vector2 start, Vector2 end, Color color, float thickness, float zoom);
+    void retain(const ConnectionKey& key);  ///< Keep a culled connection's curve cached without drawing it
+    void flush(Vector2 offset);
+    void endFrame();
+
+    /**
+     * @brief Draw one uncached curve immediately (connection drag preview)
+     */
+    void drawCurve(Vector2 start, Vector2 end, Color color, float thickness, float zoom);
+
+    /**
+     * @brief Number of segments used for a curve at the given zoom
+     *
+     * Follows the on-screen length of the control polygon, so zoomed-out
+     * views of large graphs use far fewer triangles.
+     */
+    static int getSegmentCount(Vector2 start, Vector2 end, float zoom);
+
+    /**
+     * @brief Fill points with segments + 1 curve points, followed by the two arrow head tips
+     * @return true if the arrow tips were appended
+     */
+    static bool tessellate(Vector2 start, Vector2 end, int segments, std::vector<Vector2>& points);
+
+    size_t getCachedCount() const { return _curves.size(); }
+    size_t getTessellationCount() const { return _tessellations; }
+
+private:
+    struct CachedCurve {
+        Vector2 start;
+        Vector2 end;
+        int segments = 0;
+        bool hasArrow = false;
+        uint32_t frame = 0;
+        std::vector<Vector2> points;
+    };
+
+    struct Vertex {
+        float x, y;
+        Color color;
+    };
+
+    void appendCurve(const std::vector<Vector2>& points, bool hasArrow, Color color, float thickness);
+    void appendSegment(Vector2 from, Vector2 to, Color color, float halfThickness);
+    void appendTriangle(Vector2 a, Vector2 b, Vector2 c, Color color);
+
+    std::unordered_map<ConnectionKey, CachedCurve, ConnectionKeyHash> _curves;
+    std::vector<Vertex> _vertices;     ///< Triangle list for the current frame
+    std::vector<Vector2> _scratch;     ///< Points for uncached curves
+    uint32_t _frame = 0;
+    size_t _tessellations = 0;
+};
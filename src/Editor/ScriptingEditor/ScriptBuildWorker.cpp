@@ -0,0 +1,105 @@
+/**
+ * @file ScriptBuildWorker.cpp
+ * @brief Implementation of the background script builder
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#include "ScriptBuildWorker.hpp"
+#include "ScriptingEditor.hpp"
+
+ScriptBuildWorker::ScriptBuildWorker()
+    : _thread(&ScriptBuildWorker::run, this) {
+}
+
+ScriptBuildWorker::~ScriptBuildWorker() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        _queue.clear();
+        _jobs.clear();
+    }
+    _wake.notify_one();
+    _thread.join();
+}
+
+void ScriptBuildWorker::submit(int objectId, uint64_t version, std::shared_ptr<const VisualScript> snapshot) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _jobs.find(objectId);
+        if (it == _jobs.end()) {
+            _queue.push_back(objectId);
+            _jobs[objectId] = {version, std::move(snapshot)};
+        } else {
+            // Still waiting: only the newest snapshot is worth building
+            it->second = {version, std::move(snapshot)};
+        }
+    }
+    _wake.notify_one();
+}
+
+void ScriptBuildWorker::cancelPending() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queue.clear();
+    _jobs.clear();
+}
+
+bool ScriptBuildWorker::poll(std::vector<ScriptBuildResult>& results) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_results.empty()) return false;
+
+    for (auto& result : _results) {
+        results.push_back(std::move(result));
+    }
+    _results.clear();
+    return true;
+}
+
+size_t ScriptBuildWorker::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _jobs.size() + _building;
+}
+
+ScriptBuildResult ScriptBuildWorker::build(int objectId, uint64_t version, const VisualScript& script) {
+    ScriptBuildResult result;
+    result.objectId = objectId;
+    result.version = version;
+
+    result.isValid = script.validateConnections(result.errors);
+    result.blockErrors = script.getBlockErrors();
+    if (!result.isValid) {
+        return result;
+    }
+
+    CompiledScript compiled = script.compileToExecutionFlow();
+    if (!compiled.isValid) {
+        result.isValid = false;
+        result.errors = compiled.errors;
+        return result;
+    }
+    result.compiled = std::make_shared<const CompiledScript>(
+        scripting::ScriptOptimizer().optimize(compiled, result.report));
+    return result;
+}
+
+void ScriptBuildWorker::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _wake.wait(lock, [this] { return _stopping || !_queue.empty(); });
+        if (_stopping) return;
+
+        int objectId = _queue.front();
+        _queue.pop_front();
+        Job job = std::move(_jobs[objectId]);
+        _jobs.erase(objectId);
+        _building++;
+
+        lock.unlock();
+        ScriptBuildResult result = build(objectId, job.version, *job.snapshot);
+        job.snapshot.reset();
+        lock.lock();
+
+        _building--;
+        _results.push_back(std::move(result));
+    }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file ScriptBuildWorker.hpp
+ * @brief Background validation and compilation of edited scripts
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#pragma once
+
+#include "Scripting/CompiledScript.hpp"
+#include "Scripting/ScriptOptimizer.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct VisualScript;
+
+/**
+ * @brief Outcome of validating and compiling one script snapshot
+ */
+struct ScriptBuildResult {
+    int objectId = -1;
+    uint64_t version = 0;                               ///< Version the snapshot was submitted with
+    bool isValid = false;
+    std::string errors;                                 ///< All errors, in block order
+    std::unordered_map<int, std::string> blockErrors;   ///< Errors attributed to a block, by block ID
+    std::shared_ptr<const CompiledScript> compiled;     ///< Optimized script, nullptr if invalid
+    scripting::OptimizationReport report;
+};
+
+/**
+ * @brief Validates and compiles script snapshots on a worker thread
+ *
+ * Snapshots are immutable copies taken on the UI thread, so the canvas keeps
+ * editing its own script while the worker runs. Submitting a new snapshot for
+ * an object replaces the one still waiting for it; results carry the version
+ * they were submitted with so the caller can drop those that are out of date.
+ */
+class ScriptBuildWorker {
+public:
+    ScriptBuildWorker();
+    ~ScriptBuildWorker();
+
+    ScriptBuildWorker(const ScriptBuildWorker&) = delete;
+    ScriptBuildWorker& operator=(const ScriptBuildWorker&) = delete;
+
+    void submit(int objectId, uint64_t version, std::shared_ptr<const VisualScript> snapshot);
+
+    /**
+     * @brief Drop the snapshots not started yet; builds in progress still report
+     */
+    void cancelPending();
+
+    /**
+     * @brief Move the finished results into results, oldest first
+     * @return true if any result was added
+     */
+    bool poll(std::vector<ScriptBuildResult>& results);
+
+    size_t getPendingCount() const;  ///< Snapshots queued or being built
+
+    /**
+     * @brief Validate and compile a script on the calling thread
+     */
+    static ScriptBuildResult build(int objectId, uint64_t version, const VisualScript& script);
+
+private:
+    struct Job {
+        uint64_t version = 0;
+        std::shared_ptr<const VisualScript> snapshot;
+    };
+
+    void run();
+
+    mutable std::mutex _mutex;
+    std::condition_variable _wake;
+    std::deque<int> _queue;                     ///< Object IDs in submission order
+    std::unordered_map<int, Job> _jobs;         ///< Latest snapshot waiting per object
+    std::vector<ScriptBuildResult> _results;
+    size_t _building = 0;
+    bool _stopping = false;
+    std::thread _thread;                        ///< Started last, once the state above exists
+};
@@ -0,0 +1,352 @@
+/**
+ * @file ScriptLibrary.cpp
+ * @brief Implementation of the shared script storage
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#include "ScriptLibrary.hpp"
+#include "ScriptingEditor.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+void hashCombine(size_t& seed, size_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
+
+void hashFloat(size_t& seed, float value) {
+    hashCombine(seed, std::hash<float>()(value));
+}
+
+// Everything the designer laid out except block parameters, which may
+// differ per object
+size_t hashStructure(const VisualScript& script) {
+    size_t seed = script.blocks.size();
+    for (const auto& block : script.blocks) {
+        hashCombine(seed, static_cast<size_t>(block.id));
+        hashCombine(seed, static_cast<size_t>(block.type));
+        hashFloat(seed, block.position.x);
+        hashFloat(seed, block.position.y);
+        hashFloat(seed, block.size.x);
+        hashFloat(seed, block.size.y);
+        hashCombine(seed, std::hash<std::string>()(block.title));
+        hashCombine(seed, block.isOnCanvas ? 1 : 2);
+        hashCombine(seed, static_cast<size_t>(block.canvasOrder));
+    }
+    hashCombine(seed, script.connections.size());
+    for (const auto& connection : script.connections) {
+        hashCombine(seed, static_cast<size_t>(connection.fromBlockId));
+        hashCombine(seed, static_cast<size_t>(connection.toBlockId));
+        hashCombine(seed, static_cast<size_t>(connection.fromPortType));
+        hashCombine(seed, static_cast<size_t>(connection.toPortType));
+        hashCombine(seed, static_cast<size_t>(connection.fromPortIndex));
+        hashCombine(seed, static_cast<size_t>(connection.toPortIndex));
+        hashCombine(seed, connection.isValid ? 1 : 2);
+    }
+    return seed;
+}
+
+bool sameStructure(const VisualScript& a, const VisualScript& b) {
+    if (a.blocks.size() != b.blocks.size() || a.connections.size() != b.connections.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.blocks.size(); ++i) {
+        const ScriptBlock& x = a.blocks[i];
+        const ScriptBlock& y = b.blocks[i];
+        if (x.id != y.id || x.type != y.type || x.position.x != y.position.x || x.position.y != y.position.y ||
+            x.size.x != y.size.x || x.size.y != y.size.y || x.title != y.title ||
+            x.isOnCanvas != y.isOnCanvas || x.canvasOrder != y.canvasOrder) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < a.connections.size(); ++i) {
+        const BlockConnection& x = a.connections[i];
+        const BlockConnection& y = b.connections[i];
+        if (x.fromBlockId != y.fromBlockId || x.toBlockId != y.toBlockId ||
+            x.fromPortType != y.fromPortType || x.toPortType != y.toPortType ||
+            x.fromPortIndex != y.fromPortIndex || x.toPortIndex != y.toPortIndex || x.isValid != y.isValid) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void pruneTable(std::unordered_map<size_t, std::vector<std::weak_ptr<const T>>>& table) {
+    for (auto it = table.begin(); it != table.end();) {
+        auto& entries = it->second;
+        entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                     [](const std::weak_ptr<const T>& entry) { return entry.expired(); }),
+                      entries.end());
+        it = entries.empty() ? table.erase(it) : std::next(it);
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Shared graph; block configs are those of the first object that used it
+ */
+struct ScriptLibrary::Definition {
+    VisualScript graph;
+    size_t hash = 0;
+};
+
+/**
+ * @brief Definition plus one set of overrides, which is what gets compiled
+ */
+struct ScriptLibrary::Variant {
+    std::shared_ptr<const Definition> definition;
+    std::map<int, BlockOverride> overrides;    ///< By block ID
+    size_t hash = 0;
+
+    mutable bool compiled = false;
+    mutable std::shared_ptr<const CompiledScript> script;   ///< nullptr once compiled if the graph is invalid
+    mutable scripting::OptimizationReport report;
+
+    VisualScript build() const {
+        VisualScript result = definition->graph;
+        for (auto& block : result.blocks) {
+            auto found = overrides.find(block.id);
+            if (found != overrides.end()) {
+                block.config = found->second.config;
+                block.subtitle = found->second.subtitle;
+            }
+        }
+        result.invalidateIndex();
+        return result;
+    }
+};
+
+ScriptLibrary::ScriptLibrary() = default;
+
+ScriptLibrary::~ScriptLibrary() = default;
+
+size_t ScriptLibrary::getDefinitionCount() const {
+    size_t count = 0;
+    for (const auto& bucket : _definitions) {
+        for (const auto& entry : bucket.second) {
+            count += entry.expired() ? 0 : 1;
+        }
+    }
+    return count;
+}
+
+size_t ScriptLibrary::getVariantCount() const {
+    size_t count = 0;
+    for (const auto& bucket : _variants) {
+        for (const auto& entry : bucket.second) {
+            count += entry.expired() ? 0 : 1;
+        }
+    }
+    return count;
+}
+
+std::vector<int> ScriptLibrary::getObjectIds() const {
+    std::vector<int> ids;
+    ids.reserve(_objects.size());
+    for (const auto& object : _objects) {
+        ids.push_back(object.first);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+std::string ScriptLibrary::getName(int objectId) const {
+    if (objectId == _checkedOutId && _working) {
+        return _working->name;
+    }
+    auto it = _objects.find(objectId);
+    return it != _objects.end() ? it->second.name : std::string();
+}
+
+void ScriptLibrary::assign(VisualScript&& script) {
+    if (script.objectId == _checkedOutId) {
+        _working.reset();
+        _checkedOutId = -1;
+    }
+    store(script);
+    prune();
+}
+
+void ScriptLibrary::erase(int objectId) {
+    if (objectId == _checkedOutId) {
+        _working.reset();
+        _checkedOutId = -1;
+    }
+    _objects.erase(objectId);
+    prune();
+}
+
+void ScriptLibrary::clear() {
+    _working.reset();
+    _checkedOutId = -1;
+    _objects.clear();
+    _definitions.clear();
+    _variants.clear();
+}
+
+VisualScript& ScriptLibrary::checkout(int objectId) {
+    if (_working && objectId == _checkedOutId) {
+        return *_working;
+    }
+    release();
+
+    if (contains(objectId)) {
+        _working = std::make_unique<VisualScript>(materialize(objectId));
+    } else {
+        _working = std::make_unique<VisualScript>(objectId);
+        store(*_working);
+    }
+    _checkedOutId = objectId;
+    return *_working;
+}
+
+void ScriptLibrary::sync() {
+    if (!_working) return;
+    store(*_working);
+    prune();
+}
+
+void ScriptLibrary::release() {
+    sync();
+    _working.reset();
+    _checkedOutId = -1;
+}
+
+VisualScript ScriptLibrary::materialize(int objectId) const {
+    if (_working && objectId == _checkedOutId) {
+        return *_working;
+    }
+    auto it = _objects.find(objectId);
+    if (it == _objects.end()) {
+        return VisualScript(objectId);
+    }
+
+    VisualScript result = it->second.variant->build();
+    result.objectId = objectId;
+    result.name = it->second.name;
+    result.enabled = it->second.enabled;
+    return result;
+}
+
+std::shared_ptr<const CompiledScript> ScriptLibrary::compile(int objectId, bool* reused) {
+    if (objectId == _checkedOutId) {
+        sync();
+    }
+    auto it = _objects.find(objectId);
+    if (it == _objects.end()) return nullptr;
+
+    const Variant& variant = *it->second.variant;
+    if (reused) *reused = variant.compiled;
+    if (!variant.compiled) {
+        VisualScript script = variant.build();
+        CompiledScript compiled = script.compileToExecutionFlow();
+        if (compiled.isValid) {
+            compiled = scripting::ScriptOptimizer().optimize(compiled, variant.report);
+        }
+        variant.script = std::make_shared<const CompiledScript>(std::move(compiled));
+        variant.compiled = true;
+    }
+    return variant.script;
+}
+
+void ScriptLibrary::adoptCompiled(int objectId, std::shared_ptr<const CompiledScript> compiled,
+                                  const scripting::OptimizationReport& report) {
+    if (objectId == _checkedOutId) {
+        sync();
+    }
+    auto it = _objects.find(objectId);
+    if (it == _objects.end() || !compiled) return;
+
+    const Variant& variant = *it->second.variant;
+    if (variant.compiled) return;
+    variant.script = std::move(compiled);
+    variant.report = report;
+    variant.compiled = true;
+}
+
+const scripting::OptimizationReport* ScriptLibrary::getOptimizationReport(int objectId) const {
+    auto it = _objects.find(objectId);
+    if (it == _objects.end()) return nullptr;
+
+    const Variant& variant = *it->second.variant;
+    return variant.compiled && variant.script->isValid ? &variant.report : nullptr;
+}
+
+void ScriptLibrary::store(const VisualScript& script) {
+    size_t hash = hashStructure(script);
+    std::shared_ptr<const Definition> definition = internDefinition(script, hash);
+
+    // Only the parameters that differ from the shared graph are kept per object
+    std::map<int, BlockOverride> overrides;
+    const std::vector<ScriptBlock>& shared = definition->graph.blocks;
+    for (size_t i = 0; i < script.blocks.size(); ++i) {
+        const ScriptBlock& block = script.blocks[i];
+        if (block.config != shared[i].config || block.subtitle != shared[i].subtitle) {
+            overrides[block.id] = {block.config, block.subtitle};
+        }
+    }
+
+    ObjectEntry& entry = _objects[script.objectId];
+    entry.variant = internVariant(definition, std::move(overrides));
+    entry.name = script.name;
+    entry.enabled = script.enabled;
+}
+
+std::shared_ptr<const ScriptLibrary::Definition> ScriptLibrary::internDefinition(const VisualScript& script,
+                                                                                 size_t hash) {
+    auto& bucket = _definitions[hash];
+    for (const auto& entry : bucket) {
+        std::shared_ptr<const Definition> existing = entry.lock();
+        if (existing && sameStructure(existing->graph, script)) {
+            return existing;
+        }
+    }
+
+    auto definition = std::make_shared<Definition>();
+    definition->graph = script;
+    definition->graph.objectId = -1;
+    definition->hash = hash;
+    // Editor interaction state is not part of the shared graph
+    for (auto& block : definition->graph.blocks) {
+        block.isSelected = false;
+        block.isHovered = false;
+        block.isDragging = false;
+    }
+    definition->graph.invalidateIndex();
+    bucket.push_back(definition);
+    return definition;
+}
+
+std::shared_ptr<const ScriptLibrary::Variant> ScriptLibrary::internVariant(
+    const std::shared_ptr<const Definition>& definition, std::map<int, BlockOverride>&& overrides) {
+    size_t hash = definition->hash;
+    for (const auto& blockOverride : overrides) {
+        hashCombine(hash, static_cast<size_t>(blockOverride.first));
+        hashCombine(hash, blockOverride.second.config.hash());
+        hashCombine(hash, std::hash<std::string>()(blockOverride.second.subtitle));
+    }
+
+    auto& bucket = _variants[hash];
+    for (const auto& entry : bucket) {
+        std::shared_ptr<const Variant> existing = entry.lock();
+        if (existing && existing->definition == definition && existing->overrides == overrides) {
+            return existing;
+        }
+    }
+
+    auto variant = std::make_shared<Variant>();
+    variant->definition = definition;
+    variant->overrides = std::move(overrides);
+    variant->hash = hash;
+    bucket.push_back(variant);
+    return variant;
+}
+
+void ScriptLibrary::prune() {
+    pruneTable(_variants);
+    pruneTable(_definitions);
+}
@@ -0,0 +1,133 @@
+/**
+ * @file ScriptLibrary.hpp
+ * @brief Content-hashed storage of the scripts attached to scene objects
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#pragma once
+
+#include "Scripting/CompiledScript.hpp"
+#include "Scripting/ScriptOptimizer.hpp"
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct VisualScript;
+
+/**
+ * @brief Parameter values an object uses in place of its shared graph's
+ */
+struct BlockOverride {
+    BlockConfig config;
+    std::string subtitle;   ///< Parameter summary shown on the block
+
+    bool operator==(const BlockOverride& other) const {
+        return config == other.config && subtitle == other.subtitle;
+    }
+};
+
+/**
+ * @brief Scripts of all scene objects, stored once per distinct graph
+ *
+ * Objects whose scripts have the same blocks, layout and connections share
+ * one definition; block parameters that differ from it are kept per object
+ * as overrides. Each distinct definition + overrides pair is compiled once
+ * and the result is shared by every object using it.
+ *
+ * The canvas edits a private copy of one object's script (checkout()).
+ * Shared definitions are never written to: sync() hashes the copy and files
+ * the object under the matching definition, or under a new one if the graph
+ * changed, so the other objects keep the graph they had.
+ */
+class ScriptLibrary {
+public:
+    ScriptLibrary();
+    ~ScriptLibrary();
+
+    ScriptLibrary(const ScriptLibrary&) = delete;
+    ScriptLibrary& operator=(const ScriptLibrary&) = delete;
+
+    bool contains(int objectId) const { return _objects.count(objectId) != 0; }
+    size_t getObjectCount() const { return _objects.size(); }
+    size_t getDefinitionCount() const;  ///< Distinct graphs in use
+    size_t getVariantCount() const;     ///< Distinct graph + overrides pairs in use
+    std::vector<int> getObjectIds() const;
+    std::string getName(int objectId) const;
+
+    /**
+     * @brief Store a script for script.objectId, replacing the previous one
+     */
+    void assign(VisualScript&& script);
+    void erase(int objectId);
+    void clear();
+
+    /**
+     * @brief Private, editable copy of an object's script, created empty if missing
+     *
+     * Checking out another object syncs and drops the previous copy, which
+     * invalidates every pointer into it.
+     */
+    VisualScript& checkout(int objectId);
+    int getCheckedOutId() const { return _checkedOutId; }
+
+    /**
+     * @brief File the checked out copy's current state back into the shared tables
+     */
+    void sync();
+    void release();
+
+    /**
+     * @brief Complete script of an object, overrides applied
+     */
+    VisualScript materialize(int objectId) const;
+
+    /**
+     * @brief Compiled and optimized form of an object's script, or nullptr if it has none
+     *
+     * The result carries objectId -1 and is shared with every object whose
+     * script has the same content.
+     *
+     * @param reused Set to true when no compilation was needed
+     */
+    std::shared_ptr<const CompiledScript> compile(int objectId, bool* reused = nullptr);
+
+    /**
+     * @brief Hand in a compile done elsewhere, kept unless the content is already compiled
+     *
+     * The caller guarantees that compiled was built from the object's current script.
+     */
+    void adoptCompiled(int objectId, std::shared_ptr<const CompiledScript> compiled,
+                       const scripting::OptimizationReport& report);
+
+    /**
+     * @brief Optimizer statistics of the last successful compile, or nullptr
+     */
+    const scripting::OptimizationReport* getOptimizationReport(int objectId) const;
+
+private:
+    struct Definition;
+    struct Variant;
+
+    struct ObjectEntry {
+        std::shared_ptr<const Variant> variant;
+        std::string name;
+        bool enabled = true;
+    };
+
+    void store(const VisualScript& script);
+    std::shared_ptr<const Definition> internDefinition(const VisualScript& script, size_t hash);
+    std::shared_ptr<const Variant> internVariant(const std::shared_ptr<const Definition>& definition,
+                                                 std::map<int, BlockOverride>&& overrides);
+    void prune();
+
+    std::unordered_map<int, ObjectEntry> _objects;
+    std::unordered_map<size_t, std::vector<std::weak_ptr<const Definition>>> _definitions;  ///< By structure hash
+    std::unordered_map<size_t, std::vector<std::weak_ptr<const Variant>>> _variants;        ///< By content hash
+
+    int _checkedOutId = -1;
+    std::unique_ptr<VisualScript> _working;     ///< Copy being edited on the canvas
+};
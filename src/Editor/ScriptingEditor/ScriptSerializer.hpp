@@ -0,0 +1,51 @@
+/**
+ * @file ScriptSerializer.hpp
+ * @brief Loading and saving visual scripts as JSON or compact binary
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#pragma once
+
+#include "ScriptingEditor.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Reads and writes VisualScript files
+ *
+ * Two formats share the same content: the readable JSON layout the editor
+ * has always written, and a binary layout (.isb) that is a fraction of the
+ * size and loads without any text parsing. Both loaders run in a single
+ * pass; JSON goes through the streaming scripting::JsonReader so no DOM is
+ * built. Loaded blocks are rebuilt from their type, so ports and colors
+ * always match the current block definitions.
+ */
+class ScriptSerializer {
+public:
+    static constexpr uint8_t BINARY_VERSION = 2;
+    static constexpr const char* BINARY_EXTENSION = ".isb";
+    static constexpr const char* JSON_EXTENSION = ".json";
+
+    static std::string toJson(const VisualScript& script);
+    static bool fromJson(std::string_view json, VisualScript& script, std::string& error);
+
+    static void toBinary(const VisualScript& script, std::vector<uint8_t>& out);
+    static bool fromBinary(const uint8_t* data, size_t size, VisualScript& script, std::string& error);
+
+    /**
+     * @brief Load either format, detected from the binary magic
+     */
+    static bool load(const uint8_t* data, size_t size, VisualScript& script, std::string& error);
+    static bool isBinary(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Save to disk, picking the format from the file extension
+     */
+    static bool saveToFile(const VisualScript& script, const std::string& filepath);
+
+private:
+    static void finishLoad(VisualScript& script);
+};
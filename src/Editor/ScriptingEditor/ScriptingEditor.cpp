@@ -6,9 +6,13 @@
  */
 
 #include "ScriptingEditor.hpp"
+#include "ScriptSerializer.hpp"
+#include "Scripting/CompiledScriptIO.hpp"
 #include "../../UI/UITheme.hpp"
 #include <iostream>
 #include <algorithm>
+#include <cmath>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <sys/stat.h>
@@ -29,6 +33,8 @@ void ScriptingEditor::init(std::shared_ptr<Render::Window> window, std::shared_p
     setupEventHandlers();
     initializeBlockPalette();
     initializeBlockConfigTemplates();
+    loadScriptsFromDirectory(getScriptsDirectory());
+    reloadProfile();
     _initialized = true;
     
     std::cout << "[ScriptingEditor] Initialized successfully" << std::endl;
@@ -39,6 +45,8 @@ void ScriptingEditor::update(input::IHandlerBase &inputHandler) {
         return;
     }
     
+    collectBuildResults();
+    
     Vector2D mousePosD = inputHandler.getCursorCoords();
     Vector2 mousePos = {(float)mousePosD.x, (float)mousePosD.y};
     bool mousePressed = IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
@@ -50,8 +58,20 @@ void ScriptingEditor::update(input::IHandlerBase &inputHandler) {
     _leftMousePressed = mousePressed;
     _leftMouseReleased = mouseReleased;
     
+    float wheel = GetMouseWheelMove();
+    if (wheel != 0.0f && isPositionInCanvas(mousePos) && !_showConfigDialog && !_contextMenu.isVisible) {
+        zoomCanvas(mousePos, wheel);
+    }
+    
     updateBlockHover(mousePos);
     handleMouseInput(mousePos, mousePressed, mouseReleased, rightClick);
+    
+    // Scripts that were never checked get a first build when they are shown
+    int selectedObjId = getSelectedObjectId();
+    if (selectedObjId != -1 && _scripts.contains(selectedObjId) && !_buildStatus.count(selectedObjId)) {
+        markScriptEdited(selectedObjId);
+    }
+    submitEditedScripts();
 }
 
 void ScriptingEditor::draw(Rectangle mainViewArea) {
@@ -97,7 +117,9 @@ void ScriptingEditor::draw(Rectangle mainViewArea) {
     }
     
     if (_connectionDrag.isDragging) {
+        BeginMode2D(getCanvasCamera());
         drawConnectionPreview();
+        EndMode2D();
     }
     
     if (_contextMenu.isVisible) {
@@ -149,7 +171,9 @@ void ScriptingEditor::handleFileAction(UI::EditorEventType actionType, const std
             std::cout << "[ScriptingEditor] Scripts saved" << std::endl;
             break;
         case UI::EditorEventType::FILE_OPEN:
-            if (!filepath.empty()) {
+            if (std::filesystem::path(filepath).extension() == scripting::ScriptProfileIO::FILE_EXTENSION) {
+                loadProfileFromFile(filepath);
+            } else if (!filepath.empty()) {
                 loadScriptFromFile(filepath);
             }
             std::cout << "[ScriptingEditor] Script project loaded" << std::endl;
@@ -160,7 +184,7 @@ void ScriptingEditor::handleFileAction(UI::EditorEventType actionType, const std
 }
 
 int ScriptingEditor::getScriptCount() const {
-    return _objectScripts.size();
+    return static_cast<int>(_scripts.getObjectCount());
 }
 
 int ScriptingEditor::getSelectedObjectId() const {
@@ -175,9 +199,8 @@ std::string ScriptingEditor::getSelectedScriptName() const {
     if (_selectedObjectId == -1) {
         return "";
     }
-    auto it = _objectScripts.find(_selectedObjectId);
-    if (it != _objectScripts.end()) {
-        return it->second.name;
+    if (_scripts.contains(_selectedObjectId)) {
+        return _scripts.getName(_selectedObjectId);
     }
     return "Script_" + std::to_string(_selectedObjectId);
 }
@@ -186,6 +209,23 @@ void ScriptingEditor::setSceneProvider(UI::ISceneProvider* provider) {
     _currentSceneProvider = provider;
 }
 
+void ScriptingEditor::setLiveLink(std::shared_ptr<livelink::LiveLinkClient> liveLink) {
+    _liveLink = liveLink;
+}
+
+void ScriptingEditor::pushToLiveLink(int objectId, const CompiledScript& compiled) {
+    // Shared builds may come from another object's graph, the game needs this one's ID
+    CompiledScript script = compiled;
+    script.objectId = objectId;
+    
+    livelink::Message message;
+    message.type = livelink::MessageType::SCRIPT_UPDATED;
+    scripting::CompiledScriptIO::write(script, message.payload);
+    if (_liveLink->send(message)) {
+        std::cout << "[ScriptingEditor] Pushed script of object " << objectId << " to the running game" << std::endl;
+    }
+}
+
 // ISceneProvider interface implementation
 std::vector<UI::SceneObjectInfo> ScriptingEditor::getSceneObjects() const {
     // Forward to the current scene provider (usually the Map Editor)
@@ -475,7 +515,7 @@ void ScriptBlock::setProfessionalBlockProperties() {
             primaryColor = UI::BLOCK_CONDITION;       // Harmonized condition green
             secondaryColor = UI::BLOCK_CONDITION_SECONDARY;
             headerColor = UI::BLOCK_CONDITION;
-            hasExecutionFlow = false; // No input execution port
+            hasExecutionFlow = true;
             canHaveBranches = true; // Has true/false outputs
             size = {180, 90};
             break;
@@ -568,69 +608,34 @@ void ScriptBlock::setProfessionalBlockProperties() {
 }
 
 void ScriptBlock::setDefaultConfig() {
-    switch (type) {
-        case BlockType::ON_KEY_PRESS:
-            config.stringParams["key"] = "Space";
-            break;
-        case BlockType::MOVE:
-            config.vectorParams["direction"] = {1.0f, 0.0f, 0.0f};
-            config.floatParams["speed"] = 1.0f;
-            break;
-        case BlockType::ROTATE:
-            config.vectorParams["axis"] = {0.0f, 1.0f, 0.0f};
-            config.floatParams["speed"] = 90.0f;
-            break;
-        case BlockType::CHANGE_COLOR:
-            config.vectorParams["color"] = {1.0f, 1.0f, 1.0f};
-            break;
-        case BlockType::DELAY:
-            config.floatParams["duration"] = 1.0f;
-            break;
-        case BlockType::VALUE:
-            config.floatParams["value"] = 0.0f;
-            break;
-        case BlockType::LOG:
-            config.stringParams["message"] = "Debug message";
-            break;
-        case BlockType::LOOP:
-            config.floatParams["iterations"] = 5.0f;
-            break;
-        default:
-            // No configuration needed for other blocks
-            break;
-    }
+    // Parameters and defaults come from the shared layout, so editor and runtime agree on slots
+    config = BlockConfig::forType(type);
 }
 
 std::string ScriptBlock::getDisplayLabel() const {
     switch (type) {
         case BlockType::ON_KEY_PRESS: {
-            auto keyIt = config.stringParams.find("key");
-            std::string key = (keyIt != config.stringParams.end()) ? keyIt->second : "Space";
+            const std::string& key = config.getString(BlockParams::KEY_PRESS_KEY);
             return "On key press " + key;
         }
         case BlockType::MOVE: {
-            auto speedIt = config.floatParams.find("speed");
-            float speed = (speedIt != config.floatParams.end()) ? speedIt->second : 1.0f;
+            float speed = config.getFloat(BlockParams::MOVE_SPEED);
             return "Move (speed: " + std::to_string((int)speed) + ")";
         }
         case BlockType::ROTATE: {
-            auto speedIt = config.floatParams.find("speed");
-            float speed = (speedIt != config.floatParams.end()) ? speedIt->second : 90.0f;
+            float speed = config.getFloat(BlockParams::ROTATE_SPEED);
             return "Rotate (" + std::to_string((int)speed) + "°/s)";
         }
         case BlockType::DELAY: {
-            auto durationIt = config.floatParams.find("duration");
-            float duration = (durationIt != config.floatParams.end()) ? durationIt->second : 1.0f;
+            float duration = config.getFloat(BlockParams::DELAY_DURATION);
             return "Delay " + std::to_string(duration) + "s";
         }
         case BlockType::VALUE: {
-            auto valueIt = config.floatParams.find("value");
-            float value = (valueIt != config.floatParams.end()) ? valueIt->second : 0.0f;
+            float value = config.getFloat(BlockParams::VALUE_VALUE);
             return "Value: " + std::to_string((int)value);
         }
         case BlockType::LOG: {
-            auto messageIt = config.stringParams.find("message");
-            std::string message = (messageIt != config.stringParams.end()) ? messageIt->second : "Debug message";
+            const std::string& message = config.getString(BlockParams::LOG_MESSAGE);
             return "Log: " + message.substr(0, 10) + "...";
         }
         default:
@@ -655,33 +660,27 @@ Rectangle ScriptBlock::getConnectionBounds() const {
 std::string ScriptBlock::getParameterSummary() const {
     switch (type) {
         case BlockType::ON_KEY_PRESS: {
-            auto keyIt = config.stringParams.find("key");
-            std::string key = (keyIt != config.stringParams.end()) ? keyIt->second : "Space";
+            const std::string& key = config.getString(BlockParams::KEY_PRESS_KEY);
             return "Key: " + key;
         }
         case BlockType::MOVE: {
-            auto speedIt = config.floatParams.find("speed");
-            float speed = (speedIt != config.floatParams.end()) ? speedIt->second : 1.0f;
+            float speed = config.getFloat(BlockParams::MOVE_SPEED);
             return "Speed: " + std::to_string((int)speed);
         }
         case BlockType::ROTATE: {
-            auto speedIt = config.floatParams.find("speed");
-            float speed = (speedIt != config.floatParams.end()) ? speedIt->second : 90.0f;
+            float speed = config.getFloat(BlockParams::ROTATE_SPEED);
             return std::to_string((int)speed) + "°/s";
         }
         case BlockType::DELAY: {
-            auto durationIt = config.floatParams.find("duration");
-            float duration = (durationIt != config.floatParams.end()) ? durationIt->second : 1.0f;
+            float duration = config.getFloat(BlockParams::DELAY_DURATION);
             return std::to_string(duration) + "s";
         }
         case BlockType::VALUE: {
-            auto valueIt = config.floatParams.find("value");
-            float value = (valueIt != config.floatParams.end()) ? valueIt->second : 0.0f;
+            float value = config.getFloat(BlockParams::VALUE_VALUE);
             return std::to_string((int)value);
         }
         case BlockType::LOOP: {
-            auto iterIt = config.floatParams.find("iterations");
-            float iterations = (iterIt != config.floatParams.end()) ? iterIt->second : 5.0f;
+            float iterations = config.getFloat(BlockParams::LOOP_ITERATIONS);
             return std::to_string((int)iterations) + " times";
         }
         default:
@@ -689,6 +688,17 @@ std::string ScriptBlock::getParameterSummary() const {
     }
 }
 
+BlockDetail ScriptBlock::getDetailLevel(float zoom) const {
+    // On-screen height below which the parameter text, then the title, stop being readable
+    const float fullDetailHeight = 45.0f;
+    const float titleDetailHeight = 18.0f;
+    
+    float screenHeight = size.y * zoom;
+    if (screenHeight >= fullDetailHeight) return BlockDetail::FULL;
+    if (screenHeight >= titleDetailHeight) return BlockDetail::TITLE;
+    return BlockDetail::BOX;
+}
+
 void ScriptBlock::setupConnectionPorts() {
     inputPorts.clear();
     outputPorts.clear();
@@ -719,23 +729,14 @@ void ScriptBlock::setupConnectionPorts() {
         }
     }
     
-    // Special case for IF blocks - they have no input execution port but have outputs
-    if (type == BlockType::IF) {
-        // Clear input ports since IF blocks don't have execution input
-        inputPorts.clear();
-        
-        // Add false (left) and true (right) output ports only
-        Vector2 falseOut = {position.x, position.y + size.y / 2};  // Left = False
-        Vector2 trueOut = {position.x + size.x, position.y + size.y / 2};   // Right = True
-        outputPorts.clear();
-        outputPorts.push_back(ConnectionPoint(falseOut, ConnectionPortType::FALSE_OUT, id, "False", {220, 53, 69, 255})); // Red for false
-        outputPorts.push_back(ConnectionPoint(trueOut, ConnectionPortType::TRUE_OUT, id, "True", {25, 135, 84, 255})); // Green for true
-    }
-    
     // Add value input/output ports for specific block types
     switch (type) {
-        case BlockType::IF:
-            break; // IF blocks don't have value ports
+        case BlockType::IF: {
+            // Condition input, fed by a True/False/Value block
+            Vector2 conditionIn = {position.x, position.y + size.y / 2};
+            inputPorts.push_back(ConnectionPoint(conditionIn, ConnectionPortType::VALUE_IN, id, "Condition", {25, 135, 84, 255}));
+            break;
+        }
         case BlockType::LOOP:
             break; // LOOP blocks don't have value ports
         case BlockType::VALUE:
@@ -859,29 +860,44 @@ void ScriptingEditor::drawScriptCanvas(Rectangle bounds) {
     drawCanvasGrid(canvasArea);
     
     // Get current script for this object
-    auto it = _objectScripts.find(selectedObjId);
-    if (it != _objectScripts.end()) {
-        // Draw all blocks in the script with proper ordering
-        std::vector<ScriptBlock*> sortedBlocks;
-        for (auto& block : it->second.blocks) {
-            if (block.isOnCanvas) {
-                sortedBlocks.push_back(&block);
-            }
+    if (VisualScript* script = findScript(selectedObjId)) {
+        // Only blocks overlapping the visible canvas, already in canvas order
+        Vector2 visibleOrigin = screenToCanvas({canvasArea.x, canvasArea.y});
+        Rectangle visibleArea = {visibleOrigin.x, visibleOrigin.y,
+                                 canvasArea.width / _canvasZoom, canvasArea.height / _canvasZoom};
+        syncCanvasIndex(selectedObjId, *script).queryRect(visibleArea, _visibleBlockIds);
+        
+        // The atlas is rendered at 1:1, so it only stands in for blocks drawn at that size or smaller
+        bool useTextureCache = _cacheStaticBlocks && _canvasZoom <= 1.0f;
+        if (useTextureCache) {
+            prepareBlockTextures(*script);
         }
         
-        // Sort by canvas order
-        std::sort(sortedBlocks.begin(), sortedBlocks.end(), 
-                 [](const ScriptBlock* a, const ScriptBlock* b) {
-                     return a->canvasOrder < b->canvasOrder;
-                 });
+        BeginScissorMode((int)canvasArea.x, (int)canvasArea.y, (int)canvasArea.width, (int)canvasArea.height);
+        BeginMode2D(getCanvasCamera());
         
         // Draw connections first (behind blocks)
-        drawConnections(it->second);
+        drawConnections(*script, visibleArea);
+        drawCanvasBlocks(*script, useTextureCache);
+        drawProfileHeatMap(*script);
+        drawBuildAnnotations(*script);
+        
+        EndMode2D();
+        EndScissorMode();
+        
+        // The index is refreshed on drop, so draw the dragged block from its live position,
+        // unclipped since dragging it out of the canvas removes it
+        if (_draggedCanvasBlock) {
+            BeginMode2D(getCanvasCamera());
+            drawProfessionalBlock(*_draggedCanvasBlock, {0, 0}, _draggedCanvasBlock->getDetailLevel(_canvasZoom));
+            EndMode2D();
+        }
         
-        // Draw all canvas blocks with professional styling
-        for (const ScriptBlock* block : sortedBlocks) {
-            drawProfessionalBlock(*block, _canvasOffset);
+        if (const scripting::OptimizationReport* report = _scripts.getOptimizationReport(selectedObjId)) {
+            drawOptimizationReport(*report, canvasArea);
         }
+        drawBuildStatus(selectedObjId, canvasArea);
+        drawProfileLegend(canvasArea);
     }
     
     // Draw canvas border
@@ -960,23 +976,255 @@ void ScriptingEditor::drawCanvasOverlay(Rectangle bounds) {
     GuiLabel(messageArea, "Select a scene object to start scripting.");
 }
 
+void ScriptingEditor::drawOptimizationReport(const scripting::OptimizationReport& report, Rectangle canvasArea) {
+    const float lineHeight = 18.0f;
+    const float width = 230.0f;
+    float height = lineHeight * (report.passes.size() + 1) + 10.0f;
+    Rectangle panel = {
+        canvasArea.x + canvasArea.width - width - 10,
+        canvasArea.y + canvasArea.height - height - 10,
+        width, height
+    };
+    
+    DrawRectangleRec(panel, Fade(UI::PANEL_BACKGROUND, 0.9f));
+    DrawRectangleLinesEx(panel, 1, UI::PANEL_BORDER);
+    
+    std::string summary = "Optimized: " + std::to_string(report.nodesBefore) + " -> " +
+                          std::to_string(report.nodesAfter) + " nodes, " +
+                          std::to_string(report.edgesBefore) + " -> " +
+                          std::to_string(report.edgesAfter) + " edges";
+    DrawText(summary.c_str(), panel.x + 6, panel.y + 5, 10, UI::UI_TEXT_PRIMARY);
+    
+    float y = panel.y + 5 + lineHeight;
+    for (const auto& pass : report.passes) {
+        std::string line = pass.name + ": -" + std::to_string(pass.removedNodes) + " nodes, -" +
+                           std::to_string(pass.removedEdges) + " edges";
+        DrawText(line.c_str(), panel.x + 12, y, 10, UI::UI_TEXT_SECONDARY);
+        y += lineHeight;
+    }
+}
+
+void ScriptingEditor::drawBuildAnnotations(const VisualScript& script) {
+    const ScriptBuildStatus* status = findBuildStatus(script.objectId);
+    if (!status || status->blockErrors.empty()) {
+        return;
+    }
+    
+    // Drawn over the blocks so the atlas stays free of build state
+    for (int blockId : _visibleBlockIds) {
+        if (!status->blockErrors.count(blockId)) continue;
+        const ScriptBlock* block = script.findBlock(blockId);
+        if (!block || block == _draggedCanvasBlock) continue;
+        
+        Rectangle blockRect = {block->position.x, block->position.y, block->size.x, block->size.y};
+        DrawRectangleLinesEx(blockRect, 2.0f, UI::ERROR);
+        Vector2 badge = {blockRect.x + blockRect.width, blockRect.y};
+        DrawCircleV(badge, 8.0f, UI::ERROR);
+        DrawText("!", badge.x - 1, badge.y - 5, 10, WHITE);
+    }
+}
+
+void ScriptingEditor::drawBuildStatus(int objectId, Rectangle canvasArea) {
+    const ScriptBuildStatus* status = findBuildStatus(objectId);
+    if (!status || status->isValid) {
+        return;
+    }
+    
+    // Each error is one line
+    int errorCount = std::max(1, static_cast<int>(std::count(status->errors.begin(), status->errors.end(), '\n')));
+    std::string summary = std::to_string(errorCount) + (errorCount == 1 ? " error" : " errors");
+    if (status->builtVersion != status->version) {
+        summary += " (checking...)";
+    }
+    Rectangle label = {canvasArea.x + 10, canvasArea.y + 10, (float)MeasureText(summary.c_str(), 10) + 12, 18};
+    DrawRectangleRec(label, Fade(UI::PANEL_BACKGROUND, 0.9f));
+    DrawRectangleLinesEx(label, 1, UI::ERROR);
+    DrawText(summary.c_str(), label.x + 6, label.y + 4, 10, UI::ERROR);
+    
+    auto hovered = status->blockErrors.find(_hoveredBlockId);
+    if (hovered == status->blockErrors.end()) {
+        return;
+    }
+    std::string message = hovered->second;
+    while (!message.empty() && message.back() == '\n') {
+        message.pop_back();
+    }
+    int lines = 1 + static_cast<int>(std::count(message.begin(), message.end(), '\n'));
+    Rectangle tooltip = {_currentMousePos.x + 14, _currentMousePos.y + 14,
+                         (float)MeasureText(message.c_str(), 10) + 12, lines * 12.0f + 8};
+    DrawRectangleRec(tooltip, Fade(UI::PANEL_BACKGROUND, 0.95f));
+    DrawRectangleLinesEx(tooltip, 1, UI::ERROR);
+    DrawText(message.c_str(), tooltip.x + 6, tooltip.y + 4, 10, UI::UI_TEXT_PRIMARY);
+}
+
+bool ScriptingEditor::loadProfileFromFile(const std::string& filepath) {
+    scripting::ScriptProfile profile;
+    std::string error;
+    if (!scripting::ScriptProfileIO::loadFromFile(filepath, profile, error)) {
+        std::cout << "[ScriptingEditor] Failed to load profile " << filepath << ": " << error << std::endl;
+        return false;
+    }
+    
+    _profile = std::move(profile);
+    _profileObjectId = -1;
+    std::cout << "[ScriptingEditor] Loaded profile of " << _profile.frames << " frames ("
+              << _profile.programs.size() << " programs) from " << filepath << std::endl;
+    return true;
+}
+
+std::string ScriptingEditor::getProfilePath() {
+    return getScriptsDirectory() + "/profile" + scripting::ScriptProfileIO::FILE_EXTENSION;
+}
+
+bool ScriptingEditor::reloadProfile() {
+    std::string profilePath = getProfilePath();
+    if (!std::filesystem::exists(profilePath)) {
+        return false;
+    }
+    return loadProfileFromFile(profilePath);
+}
+
+void ScriptingEditor::drawProfileHeatMap(const VisualScript& script) {
+    if (_profile.frames == 0) {
+        return;
+    }
+    if (_profileObjectId != script.objectId) {
+        _profileCosts = _profile.getBlockCounters(script.objectId, &_profileSharedBy);
+        _profileObjectId = script.objectId;
+    }
+    if (_profileCosts.empty()) {
+        return;
+    }
+    
+    // Tint relative to the most expensive block of this script
+    uint64_t maxNanoseconds = 1;
+    for (const auto& cost : _profileCosts) {
+        maxNanoseconds = std::max(maxNanoseconds, cost.second.nanoseconds);
+    }
+    
+    double frames = static_cast<double>(_profile.frames);
+    char label[64];
+    for (int blockId : _visibleBlockIds) {
+        auto cost = _profileCosts.find(blockId);
+        if (cost == _profileCosts.end() || cost->second.calls == 0) continue;
+        const ScriptBlock* block = script.findBlock(blockId);
+        if (!block || block == _draggedCanvasBlock) continue;
+        
+        // Green for cheap, through yellow, to red for the hottest block
+        float heat = static_cast<float>(cost->second.nanoseconds) / static_cast<float>(maxNanoseconds);
+        Color tint = heat < 0.5f
+            ? Color{(unsigned char)(UI::SUCCESS.r + (UI::WARNING.r - UI::SUCCESS.r) * heat * 2.0f),
+                    (unsigned char)(UI::SUCCESS.g + (UI::WARNING.g - UI::SUCCESS.g) * heat * 2.0f),
+                    (unsigned char)(UI::SUCCESS.b + (UI::WARNING.b - UI::SUCCESS.b) * heat * 2.0f), 90}
+            : Color{(unsigned char)(UI::WARNING.r + (UI::ERROR.r - UI::WARNING.r) * (heat - 0.5f) * 2.0f),
+                    (unsigned char)(UI::WARNING.g + (UI::ERROR.g - UI::WARNING.g) * (heat - 0.5f) * 2.0f),
+                    (unsigned char)(UI::WARNING.b + (UI::ERROR.b - UI::WARNING.b) * (heat - 0.5f) * 2.0f), 90};
+        
+        Rectangle blockRect = {block->position.x, block->position.y, block->size.x, block->size.y};
+        DrawRectangleRounded(blockRect, UI::UI_BORDER_RADIUS_LARGE / block->size.x, 8, tint);
+        
+        std::snprintf(label, sizeof(label), "%.1f calls/frame  %.1f us",
+                      cost->second.calls / frames, cost->second.nanoseconds / frames / 1000.0);
+        DrawText(label, blockRect.x + 2, blockRect.y + blockRect.height + 3, 10, UI::UI_SECONDARY);
+    }
+}
+
+void ScriptingEditor::drawProfileLegend(Rectangle canvasArea) {
+    if (_profile.frames == 0 || _profileCosts.empty() || _profileObjectId != getSelectedObjectId()) {
+        return;
+    }
+    
+    std::string legend = "Profile: " + std::to_string(_profile.frames) + " frames";
+    if (_profileSharedBy > 1) {
+        legend += ", graph shared by " + std::to_string(_profileSharedBy) + " objects";
+    }
+    Rectangle label = {canvasArea.x + 10, canvasArea.y + canvasArea.height - 28,
+                       (float)MeasureText(legend.c_str(), 10) + 12, 18};
+    DrawRectangleRec(label, Fade(UI::PANEL_BACKGROUND, 0.9f));
+    DrawRectangleLinesEx(label, 1, UI::PANEL_BORDER);
+    DrawText(legend.c_str(), label.x + 6, label.y + 4, 10, UI::UI_TEXT_PRIMARY);
+}
+
 void ScriptingEditor::drawCanvasGrid(Rectangle bounds) {
     const float gridSize = 20.0f;
+    const float minScreenSpacing = 8.0f;
     Color gridColor = {220, 220, 220, 255};
     
+    // Follow the canvas zoom, skipping every other line once they get too dense
+    float spacing = gridSize * _canvasZoom;
+    while (spacing < minScreenSpacing) {
+        spacing *= 2.0f;
+    }
+    float startX = bounds.x + std::fmod(_canvasOffset.x * _canvasZoom, spacing);
+    float startY = bounds.y + std::fmod(_canvasOffset.y * _canvasZoom, spacing);
+    if (startX < bounds.x) startX += spacing;
+    if (startY < bounds.y) startY += spacing;
+    
     // Draw vertical lines
-    for (float x = bounds.x; x < bounds.x + bounds.width; x += gridSize) {
+    for (float x = startX; x < bounds.x + bounds.width; x += spacing) {
         DrawLine(x, bounds.y, x, bounds.y + bounds.height, gridColor);
     }
     
     // Draw horizontal lines
-    for (float y = bounds.y; y < bounds.y + bounds.height; y += gridSize) {
+    for (float y = startY; y < bounds.y + bounds.height; y += spacing) {
         DrawLine(bounds.x, y, bounds.x + bounds.width, y, gridColor);
     }
 }
 
+void ScriptingEditor::drawCanvasBlocks(const VisualScript& script, bool useTextureCache) {
+    bool drawingFromAtlas = false;
+    
+    for (int blockId : _visibleBlockIds) {
+        const ScriptBlock* block = script.findBlock(blockId);
+        if (!block || block == _draggedCanvasBlock) continue;
+        
+        BlockDetail detail = block->getDetailLevel(_canvasZoom);
+        bool fromAtlas = useTextureCache && detail == BlockDetail::FULL &&
+                         !block->isSelected && !block->isHovered && _blockTextureCache.contains(blockId);
+        
+        // Atlas quads use premultiplied blending; only switch when the kind of block changes
+        if (fromAtlas != drawingFromAtlas) {
+            if (fromAtlas) {
+                _blockTextureCache.beginDraw();
+            } else {
+                _blockTextureCache.endDraw();
+            }
+            drawingFromAtlas = fromAtlas;
+        }
+        
+        if (fromAtlas) {
+            _blockTextureCache.draw(blockId, block->position);
+        } else {
+            drawProfessionalBlock(*block, {0, 0}, detail);
+        }
+    }
+    
+    if (drawingFromAtlas) {
+        _blockTextureCache.endDraw();
+    }
+}
+
+void ScriptingEditor::prepareBlockTextures(const VisualScript& script) {
+    _blockTextureCache.beginFrame();
+    
+    for (int blockId : _visibleBlockIds) {
+        const ScriptBlock* block = script.findBlock(blockId);
+        if (!block || block == _draggedCanvasBlock || block->isSelected || block->isHovered) continue;
+        if (block->getDetailLevel(_canvasZoom) != BlockDetail::FULL) continue;
+        
+        _blockTextureCache.prepare(blockId, block->size, [this, block](Vector2 origin) {
+            drawProfessionalBlock(*block, {origin.x - block->position.x, origin.y - block->position.y});
+        });
+    }
+}
+
 // Professional block drawing implementation
-void ScriptingEditor::drawProfessionalBlock(const ScriptBlock& block, Vector2 offset) {
+void ScriptingEditor::drawProfessionalBlock(const ScriptBlock& block, Vector2 offset, BlockDetail detail) {
+    if (detail != BlockDetail::FULL) {
+        drawSimplifiedBlock(block, detail);
+        return;
+    }
+    
     Vector2 drawPos = {block.position.x + offset.x, block.position.y + offset.y};
     Rectangle blockRect = {drawPos.x, drawPos.y, block.size.x, block.size.y};
     
@@ -1021,6 +1269,59 @@ void ScriptingEditor::drawProfessionalBlock(const ScriptBlock& block, Vector2 of
     }
 }
 
+void ScriptingEditor::drawSimplifiedBlock(const ScriptBlock& block, BlockDetail detail) {
+    Rectangle blockRect = getBlockBounds(block);
+    
+    // Keep outlines about one screen pixel wide whatever the zoom
+    float pixel = 1.0f / _canvasZoom;
+    
+    DrawRectangleRec(blockRect, block.primaryColor);
+    
+    if (detail == BlockDetail::TITLE) {
+        Rectangle headerRect = {blockRect.x, blockRect.y, blockRect.width, blockRect.height * 0.4f};
+        DrawRectangleRec(headerRect, block.headerColor);
+        
+        // Enlarge the title so it stays legible, as long as it fits the block
+        float fontSize = UI::UI_FONT_SIZE_LARGE / _canvasZoom;
+        Vector2 titleSize = MeasureTextEx(GetFontDefault(), block.title.c_str(), fontSize, 1);
+        float fit = std::min((blockRect.width - 8.0f) / std::max(titleSize.x, 1.0f),
+                             (blockRect.height - 4.0f) / std::max(titleSize.y, 1.0f));
+        if (fit < 1.0f) {
+            fontSize *= fit;
+            titleSize = {titleSize.x * fit, titleSize.y * fit};
+        }
+        Vector2 titlePos = {
+            blockRect.x + (blockRect.width - titleSize.x) / 2,
+            blockRect.y + (blockRect.height - titleSize.y) / 2
+        };
+        DrawTextEx(GetFontDefault(), block.title.c_str(), titlePos, fontSize, 1, UI::UI_TEXT_PRIMARY);
+        
+        // Bare ports, so connections still have visible anchors
+        for (const auto& port : block.inputPorts) {
+            DrawCircleV(port.position, 6, port.portColor);
+        }
+        for (const auto& port : block.outputPorts) {
+            DrawCircleV(port.position, 6, port.portColor);
+        }
+    }
+    
+    Color borderColor = UI::PANEL_BORDER;
+    if (block.isSelected) {
+        borderColor = UI::ACCENT_PRIMARY;
+    } else if (block.isHovered) {
+        borderColor = UI::HOVER_BACKGROUND;
+    } else if (block.isDragging) {
+        borderColor = UI::ACCENT_TERTIARY;
+    }
+    DrawRectangleLinesEx(blockRect, 2.0f * pixel, borderColor);
+    
+    if (block.isSelected) {
+        Rectangle highlightRect = {blockRect.x - 4.0f * pixel, blockRect.y - 4.0f * pixel,
+                                   blockRect.width + 8.0f * pixel, blockRect.height + 8.0f * pixel};
+        DrawRectangleLinesEx(highlightRect, 3.0f * pixel, UI::GLOW_ACCENT);
+    }
+}
+
 void ScriptingEditor::drawBlockHeader(const ScriptBlock& block, Rectangle headerRect, Vector2 offset) {
     // Draw header background
     DrawRectangleRounded(headerRect, UI::UI_BORDER_RADIUS_LARGE / block.size.x, 8, block.headerColor);
@@ -1111,10 +1412,7 @@ void ScriptingEditor::drawBlockBody(const ScriptBlock& block, Rectangle bodyRect
 }
 
 void ScriptingEditor::drawBlockPorts(const ScriptBlock& block, Vector2 offset) {
-    // Update port positions based on current block position
-    ScriptBlock* mutableBlock = const_cast<ScriptBlock*>(&block);
-    mutableBlock->setupConnectionPorts();
-    
+    // Port positions are refreshed whenever the block moves, see updateDragOperation()
     // Draw input ports
     for (const auto& port : block.inputPorts) {
         Vector2 portPos = {port.position.x + offset.x, port.position.y + offset.y};
@@ -1267,7 +1565,8 @@ void ScriptingEditor::startDragOperation(Vector2 mousePos) {
             _isDraggingCanvasBlock = true;
             _draggedCanvasBlock = canvasBlock;
             _dragStartPos = mousePos;
-            _dragOffset = {mousePos.x - canvasBlock->position.x, mousePos.y - canvasBlock->position.y};
+            Vector2 canvasPos = screenToCanvas(mousePos);
+            _dragOffset = {canvasPos.x - canvasBlock->position.x, canvasPos.y - canvasBlock->position.y};
             canvasBlock->isDragging = true;
             std::cout << "[ScriptingEditor] Started dragging canvas block: " << canvasBlock->title << std::endl;
             return;
@@ -1279,15 +1578,13 @@ void ScriptingEditor::updateDragOperation(Vector2 mousePos) {
     if (!_isMouseDragging) return;
     
     if (_isDraggingCanvasBlock && _draggedCanvasBlock) {
-        Vector2 oldPos = _draggedCanvasBlock->position;
-        
-        // Update canvas block position
+        // Update canvas block position, and its ports with it
+        Vector2 canvasPos = screenToCanvas(mousePos);
         _draggedCanvasBlock->position = {
-            mousePos.x - _dragOffset.x,
-            mousePos.y - _dragOffset.y
+            canvasPos.x - _dragOffset.x,
+            canvasPos.y - _dragOffset.y
         };
-        
-        // Position updated - no legacy connection handling needed
+        _draggedCanvasBlock->setupConnectionPorts();
     }
     // For palette dragging, the preview is handled in draw()
 }
@@ -1299,21 +1596,26 @@ void ScriptingEditor::endDragOperation(Vector2 mousePos) {
         // Check if dropping on canvas
         int selectedObjId = getSelectedObjectId();
         if (selectedObjId != -1 && isPositionInCanvas(mousePos)) {
-            Vector2 canvasPos = {mousePos.x - 60, mousePos.y - 20}; // Center block on mouse
+            Vector2 dropPos = screenToCanvas(mousePos);
+            Vector2 canvasPos = {dropPos.x - 60, dropPos.y - 20}; // Center block on mouse
             addBlockToCanvas(_draggedBlockType, canvasPos);
             std::cout << "[ScriptingEditor] Added block to canvas: " << getBlockLabel(_draggedBlockType) << std::endl;
         }
     } else if (_isDraggingCanvasBlock && _draggedCanvasBlock) {
+        int blockId = _draggedCanvasBlock->id;
+        
         // Check if block was dragged out of canvas
         if (!isPositionInCanvas(mousePos)) {
             // Remove block when dragged out of canvas
-            int blockId = _draggedCanvasBlock->id;
             removeBlockFromCanvas(blockId);
             std::cout << "[ScriptingEditor] Removed block from canvas" << std::endl;
+        } else {
+            // Reset drag state for the block and move it in the canvas index
+            _draggedCanvasBlock->isDragging = false;
+            if (_canvasIndexObjectId == getSelectedObjectId()) {
+                _canvasIndex.update(blockId, getBlockBounds(*_draggedCanvasBlock), _draggedCanvasBlock->canvasOrder);
+            }
         }
-        
-        // Reset drag state for the block
-        _draggedCanvasBlock->isDragging = false;
         _draggedCanvasBlock = nullptr;
     }
     
@@ -1334,17 +1636,32 @@ ScriptBlock* ScriptingEditor::getCanvasBlockAtPosition(Vector2 pos) {
     int selectedObjId = getSelectedObjectId();
     if (selectedObjId == -1) return nullptr;
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it == _objectScripts.end()) return nullptr;
+    VisualScript* script = findScript(selectedObjId);
+    if (!script) return nullptr;
     
-    // Check blocks in reverse order (top-most first)
-    for (auto rit = it->second.blocks.rbegin(); rit != it->second.blocks.rend(); ++rit) {
-        if (rit->isOnCanvas && isPointInBlock(pos, *rit, _canvasOffset)) {
-            return &(*rit);
-        }
+    Vector2 canvasPos = screenToCanvas(pos);
+    int blockId = syncCanvasIndex(selectedObjId, *script).queryTopmost(canvasPos);
+    return blockId == -1 ? nullptr : script->findBlock(blockId);
+}
+
+CanvasSpatialIndex& ScriptingEditor::syncCanvasIndex(int objectId, const VisualScript& script) {
+    if (_canvasIndexObjectId == objectId && _canvasIndexRevision == script.getRevision()) {
+        return _canvasIndex;
     }
     
-    return nullptr;
+    _canvasIndex.clear();
+    for (const auto& block : script.blocks) {
+        if (block.isOnCanvas) {
+            _canvasIndex.insert(block.id, getBlockBounds(block), block.canvasOrder);
+        }
+    }
+    _canvasIndexObjectId = objectId;
+    _canvasIndexRevision = script.getRevision();
+    return _canvasIndex;
+}
+
+Rectangle ScriptingEditor::getBlockBounds(const ScriptBlock& block) {
+    return {block.position.x, block.position.y, block.size.x, block.size.y};
 }
 
 bool ScriptingEditor::isPointInBlock(Vector2 point, const ScriptBlock& block, Vector2 offset) {
@@ -1362,15 +1679,11 @@ void ScriptingEditor::addBlockToCanvas(BlockType type, Vector2 position) {
     int selectedObjId = getSelectedObjectId();
     if (selectedObjId == -1) return;
     
-    // Ensure script exists for this object
-    if (_objectScripts.find(selectedObjId) == _objectScripts.end()) {
-        _objectScripts[selectedObjId] = VisualScript(selectedObjId);
-    }
-    
     ScriptBlock newBlock = createBlockFromType(type, position);
     newBlock.isOnCanvas = true;
     newBlock.canvasOrder = _nextCanvasOrder++;
-    _objectScripts[selectedObjId].blocks.push_back(newBlock);
+    getCurrentScript().addBlock(newBlock);
+    markScriptEdited(selectedObjId);
     
     std::cout << "[ScriptingEditor] Added block '" << newBlock.title << "' to object " << selectedObjId << std::endl;
 }
@@ -1379,28 +1692,49 @@ void ScriptingEditor::removeBlockFromCanvas(int blockId) {
     int selectedObjId = getSelectedObjectId();
     if (selectedObjId == -1) return;
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it == _objectScripts.end()) return;
+    VisualScript* script = findScript(selectedObjId);
+    if (!script) return;
     
-    auto& blocks = it->second.blocks;
-    blocks.erase(
-        std::remove_if(blocks.begin(), blocks.end(),
-            [blockId](const ScriptBlock& block) { return block.id == blockId; }),
-        blocks.end()
-    );
+    script->removeBlock(blockId);
+    _blockTextureCache.invalidate(blockId);
+    markScriptEdited(selectedObjId);
     
     std::cout << "[ScriptingEditor] Removed block " << blockId << " from object " << selectedObjId << std::endl;
 }
 
 VisualScript& ScriptingEditor::getCurrentScript() {
     int selectedObjId = getSelectedObjectId();
-    
-    // Ensure script exists for this object
-    if (_objectScripts.find(selectedObjId) == _objectScripts.end()) {
-        _objectScripts[selectedObjId] = VisualScript(selectedObjId);
+    if (_scripts.getCheckedOutId() != selectedObjId) {
+        resetCanvasState();
     }
     
-    return _objectScripts[selectedObjId];
+    // Creates an empty script for objects that have none yet
+    return _scripts.checkout(selectedObjId);
+}
+
+VisualScript* ScriptingEditor::findScript(int objectId) {
+    if (!_scripts.contains(objectId)) {
+        return nullptr;
+    }
+    if (_scripts.getCheckedOutId() != objectId) {
+        resetCanvasState();
+    }
+    return &_scripts.checkout(objectId);
+}
+
+void ScriptingEditor::resetCanvasState() {
+    if (_showConfigDialog) {
+        closeConfigDialog();
+    }
+    hideContextMenu();
+    _isDraggingCanvasBlock = false;
+    _draggedCanvasBlock = nullptr;
+    _connectionDrag.clear();
+    _selectedBlock = nullptr;
+    _configuredBlock = nullptr;
+    _hoveredBlockId = -1;
+    _canvasIndexObjectId = -1;
+    _blockTextureCache.clear();
 }
 
 std::string ScriptingEditor::getBlockLabel(BlockType type) const {
@@ -1432,14 +1766,14 @@ Vector2 ScriptingEditor::getNextCanvasPosition() {
         return {canvasArea.x, canvasArea.y};
     }
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it == _objectScripts.end() || it->second.blocks.empty()) {
+    VisualScript* script = findScript(selectedObjId);
+    if (!script || script->blocks.empty()) {
         return {canvasArea.x, canvasArea.y};
     }
     
     // Find the lowest positioned block
     float maxY = canvasArea.y;
-    for (const auto& block : it->second.blocks) {
+    for (const auto& block : script->blocks) {
         if (block.isOnCanvas) {
             maxY = std::max(maxY, block.position.y + block.size.y);
         }
@@ -1452,12 +1786,12 @@ void ScriptingEditor::reorderCanvasBlocks() {
     int selectedObjId = getSelectedObjectId();
     if (selectedObjId == -1) return;
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it == _objectScripts.end()) return;
+    VisualScript* script = findScript(selectedObjId);
+    if (!script) return;
     
     // Get all canvas blocks and sort by Y position
     std::vector<ScriptBlock*> canvasBlocks;
-    for (auto& block : it->second.blocks) {
+    for (auto& block : script->blocks) {
         if (block.isOnCanvas) {
             canvasBlocks.push_back(&block);
         }
@@ -1475,8 +1809,10 @@ void ScriptingEditor::reorderCanvasBlocks() {
     for (int i = 0; i < canvasBlocks.size(); i++) {
         canvasBlocks[i]->canvasOrder = i;
         canvasBlocks[i]->position = {canvasArea.x, currentY};
+        canvasBlocks[i]->setupConnectionPorts();
         currentY += canvasBlocks[i]->size.y + _blockSpacing;
     }
+    script->invalidateIndex();
 }
 
 
@@ -1501,6 +1837,8 @@ void ScriptingEditor::applyBlockConfiguration() {
     if (_configuredBlock) {
         // Apply field states to the block
         applyFieldStatesToBlock(_configuredBlock);
+        _blockTextureCache.invalidate(_configuredBlock->id);
+        markScriptEdited(getSelectedObjectId());
         std::cout << "[ScriptingEditor] Configuration applied to block " << _configuredBlock->id << std::endl;
     }
     closeConfigDialog();
@@ -1608,6 +1946,34 @@ void ScriptingEditor::updateCanvasBounds(Rectangle mainViewArea) {
     };
 }
 
+void ScriptingEditor::zoomCanvas(Vector2 anchor, float wheelSteps) {
+    Vector2 anchorCanvas = screenToCanvas(anchor);
+    _canvasZoom = std::clamp(_canvasZoom * std::pow(1.1f, wheelSteps), _minCanvasZoom, _maxCanvasZoom);
+    
+    // Keep the canvas point under the cursor where it was
+    _canvasOffset = {
+        (anchor.x - _canvasBounds.x) / _canvasZoom + _canvasBounds.x - anchorCanvas.x,
+        (anchor.y - _canvasBounds.y) / _canvasZoom + _canvasBounds.y - anchorCanvas.y
+    };
+}
+
+Vector2 ScriptingEditor::screenToCanvas(Vector2 screenPos) const {
+    // Inverse of getCanvasCamera(); the canvas corner is the zoom origin
+    return {
+        (screenPos.x - _canvasBounds.x) / _canvasZoom + _canvasBounds.x - _canvasOffset.x,
+        (screenPos.y - _canvasBounds.y) / _canvasZoom + _canvasBounds.y - _canvasOffset.y
+    };
+}
+
+Camera2D ScriptingEditor::getCanvasCamera() const {
+    Camera2D camera = {};
+    camera.offset = {_canvasBounds.x, _canvasBounds.y};
+    camera.target = {_canvasBounds.x - _canvasOffset.x, _canvasBounds.y - _canvasOffset.y};
+    camera.rotation = 0.0f;
+    camera.zoom = _canvasZoom;
+    return camera;
+}
+
 bool ScriptingEditor::isPositionInCanvas(Vector2 pos) {
     return CheckCollisionPointRec(pos, _canvasBounds);
 }
@@ -1669,9 +2035,9 @@ void ScriptingEditor::duplicateBlock(ScriptBlock* block) {
     newBlock.canvasOrder = _nextCanvasOrder++;
     
     // Add to canvas
-    auto it = _objectScripts.find(selectedObjId);
-    if (it != _objectScripts.end()) {
-        it->second.blocks.push_back(newBlock);
+    if (VisualScript* script = findScript(selectedObjId)) {
+        script->addBlock(newBlock);
+        markScriptEdited(selectedObjId);
         std::cout << "[ScriptingEditor] Duplicated block: " << block->title << std::endl;
     }
 }
@@ -1710,9 +2076,8 @@ void ScriptingEditor::deselectAllBlocks() {
     int selectedObjId = getSelectedObjectId();
     if (selectedObjId == -1) return;
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it != _objectScripts.end()) {
-        for (auto& block : it->second.blocks) {
+    if (VisualScript* script = findScript(selectedObjId)) {
+        for (auto& block : script->blocks) {
             block.isSelected = false;
         }
     }
@@ -1723,22 +2088,21 @@ void ScriptingEditor::updateBlockHover(Vector2 mousePos) {
     int selectedObjId = getSelectedObjectId();
     if (selectedObjId == -1) return;
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it != _objectScripts.end()) {
-        for (auto& block : it->second.blocks) {
-            if (block.isOnCanvas) {
-                bool wasHovered = block.isHovered;
-                block.isHovered = isPointInBlock(mousePos, block, _canvasOffset);
-                
-                // Update hover state
-                if (block.isHovered && !wasHovered) {
-                    _hoveredBlock = &block;
-                } else if (!block.isHovered && wasHovered) {
-                    _hoveredBlock = nullptr;
-                }
-            }
-        }
+    VisualScript* script = findScript(selectedObjId);
+    if (!script) return;
+    
+    // Only the top-most block under the cursor is hovered
+    ScriptBlock* hovered = getCanvasBlockAtPosition(mousePos);
+    int hoveredId = hovered ? hovered->id : -1;
+    if (hoveredId == _hoveredBlockId) return;
+    
+    if (ScriptBlock* previous = script->findBlock(_hoveredBlockId)) {
+        previous->isHovered = false;
+    }
+    if (hovered) {
+        hovered->isHovered = true;
     }
+    _hoveredBlockId = hoveredId;
 }
 
 ScriptBlock* ScriptingEditor::getBlockAtPosition(Vector2 pos) {
@@ -1779,10 +2143,7 @@ void ScriptingEditor::createContextMenuItems(ScriptBlock* block) {
     _contextMenu.items.clear();
     
     // Edit item - only enabled if block has configurable parameters
-    bool hasParameters = (block->config.floatParams.size() > 0 || 
-                         block->config.vectorParams.size() > 0 || 
-                         block->config.stringParams.size() > 0 || 
-                         block->config.boolParams.size() > 0);
+    bool hasParameters = !block->config.empty();
     
     Color editTextColor = hasParameters ? UI::UI_TEXT_PRIMARY : UI::UI_TEXT_TERTIARY;
     Color editHoverColor = hasParameters ? UI::ACCENT_PRIMARY : UI::UI_TERTIARY;
@@ -2072,10 +2433,10 @@ bool ScriptingEditor::createConnection(ScriptBlock* fromBlock, int fromPortIndex
     int selectedObjId = getSelectedObjectId();
     if (selectedObjId == -1) return false;
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it == _objectScripts.end()) return false;
+    VisualScript* found = findScript(selectedObjId);
+    if (!found) return false;
     
-    VisualScript& script = it->second;
+    VisualScript& script = *found;
     
     // Remove any existing connections to the target port (each input can only have one connection)
     removeConnection(-1, toBlock->id, -1, toPortIndex);
@@ -2094,7 +2455,8 @@ bool ScriptingEditor::createConnection(ScriptBlock* fromBlock, int fromPortIndex
         connectionColor
     );
     
-    script.connections.push_back(newConnection);
+    script.addConnection(newConnection);
+    markScriptEdited(getSelectedObjectId());
     
     std::cout << "[ScriptingEditor] Created connection: Block " << fromBlock->id 
               << " port " << fromPortIndex << " -> Block " << toBlock->id 
@@ -2107,23 +2469,11 @@ void ScriptingEditor::removeConnection(int fromBlockId, int toBlockId, int fromP
     int selectedObjId = getSelectedObjectId();
     if (selectedObjId == -1) return;
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it == _objectScripts.end()) return;
-    
-    auto& connections = it->second.connections;
-    
-    // Remove matching connections
-    connections.erase(
-        std::remove_if(connections.begin(), connections.end(),
-            [fromBlockId, toBlockId, fromPortIndex, toPortIndex](const BlockConnection& conn) {
-                bool matchFrom = (fromBlockId == -1 || conn.fromBlockId == fromBlockId);
-                bool matchTo = (toBlockId == -1 || conn.toBlockId == toBlockId);
-                bool matchFromPort = (fromPortIndex == -1 || conn.fromPortIndex == fromPortIndex);
-                bool matchToPort = (toPortIndex == -1 || conn.toPortIndex == toPortIndex);
-                return matchFrom && matchTo && matchFromPort && matchToPort;
-            }),
-        connections.end()
-    );
+    VisualScript* script = findScript(selectedObjId);
+    if (!script) return;
+    
+    script->removeConnections(fromBlockId, toBlockId, fromPortIndex, toPortIndex);
+    markScriptEdited(selectedObjId);
 }
 
 void ScriptingEditor::removeAllConnectionsForBlock(int blockId) {
@@ -2131,98 +2481,56 @@ void ScriptingEditor::removeAllConnectionsForBlock(int blockId) {
     removeConnection(-1, blockId); // Remove as target
 }
 
-void ScriptingEditor::drawConnections(const VisualScript& script) {
-    // Update connection positions before drawing
+void ScriptingEditor::drawConnections(const VisualScript& script, Rectangle visibleArea) {
+    // Margin for the arrow head and line thickness around the curve's hull
+    const float margin = 12.0f;
+    
+    _connectionRenderer.beginFrame();
     for (const auto& connection : script.connections) {
-        // Find the blocks
-        const ScriptBlock* fromBlock = nullptr;
-        const ScriptBlock* toBlock = nullptr;
-        
-        for (const auto& block : script.blocks) {
-            if (block.id == connection.fromBlockId) fromBlock = &block;
-            if (block.id == connection.toBlockId) toBlock = &block;
-        }
+        const ScriptBlock* fromBlock = script.findBlock(connection.fromBlockId);
+        const ScriptBlock* toBlock = script.findBlock(connection.toBlockId);
         
         if (fromBlock && toBlock && connection.fromPortIndex < fromBlock->outputPorts.size() 
             && connection.toPortIndex < toBlock->inputPorts.size()) {
             
+            ConnectionKey key = {connection.fromBlockId, connection.fromPortIndex,
+                                 connection.toBlockId, connection.toPortIndex};
             Vector2 startPoint = fromBlock->outputPorts[connection.fromPortIndex].position;
             Vector2 endPoint = toBlock->inputPorts[connection.toPortIndex].position;
             
-            // Apply canvas offset
-            startPoint.x += _canvasOffset.x;
-            startPoint.y += _canvasOffset.y;
-            endPoint.x += _canvasOffset.x;
-            endPoint.y += _canvasOffset.y;
+            // The curve stays inside the hull of its end and control points
+            float curvature = std::min(std::abs(endPoint.x - startPoint.x) * 0.5f, 100.0f);
+            float minX = std::min(startPoint.x, endPoint.x - curvature) - margin;
+            float maxX = std::max(startPoint.x + curvature, endPoint.x) + margin;
+            float minY = std::min(startPoint.y, endPoint.y) - margin;
+            float maxY = std::max(startPoint.y, endPoint.y) + margin;
+            if (maxX < visibleArea.x || minX > visibleArea.x + visibleArea.width ||
+                maxY < visibleArea.y || minY > visibleArea.y + visibleArea.height) {
+                _connectionRenderer.retain(key);
+                continue;
+            }
             
-            drawConnectionLine(startPoint, endPoint, connection.connectionColor, 3.0f);
+            _connectionRenderer.addConnection(key, startPoint, endPoint, connection.connectionColor, 3.0f, _canvasZoom);
         }
     }
-}
-
-void ScriptingEditor::drawConnectionLine(Vector2 start, Vector2 end, Color color, float thickness) {
-    // Calculate control points for smooth bezier curve
-    float distance = abs(end.x - start.x);
-    float curvature = std::min(distance * 0.5f, 100.0f); // Adaptive curvature
-    
-    Vector2 control1 = {start.x + curvature, start.y};
-    Vector2 control2 = {end.x - curvature, end.y};
-    
-    // Draw bezier curve with multiple segments for smoothness
-    const int segments = 20;
-    Vector2 lastPoint = start;
-    
-    for (int i = 1; i <= segments; i++) {
-        float t = (float)i / segments;
-        float u = 1.0f - t;
-        float tt = t * t;
-        float uu = u * u;
-        float uuu = uu * u;
-        float ttt = tt * t;
-        
-        Vector2 point = {
-            uuu * start.x + 3 * uu * t * control1.x + 3 * u * tt * control2.x + ttt * end.x,
-            uuu * start.y + 3 * uu * t * control1.y + 3 * u * tt * control2.y + ttt * end.y
-        };
-        
-        DrawLineEx(lastPoint, point, thickness, color);
-        lastPoint = point;
-    }
     
-    // Draw arrow at the end
-    Vector2 direction = {end.x - control2.x, end.y - control2.y};
-    float length = sqrt(direction.x * direction.x + direction.y * direction.y);
-    if (length > 0.1f) {
-        direction.x /= length;
-        direction.y /= length;
-        
-        Vector2 arrowLeft = {end.x - direction.x * 10 - direction.y * 5, 
-                            end.y - direction.y * 10 + direction.x * 5};
-        Vector2 arrowRight = {end.x - direction.x * 10 + direction.y * 5, 
-                             end.y - direction.y * 10 - direction.x * 5};
-        
-        DrawLineEx(end, arrowLeft, thickness, color);
-        DrawLineEx(end, arrowRight, thickness, color);
-    }
+    // All visible connections in one batch, placed by the canvas camera
+    _connectionRenderer.flush({0, 0});
+    _connectionRenderer.endFrame();
 }
 
 void ScriptingEditor::drawConnectionPreview() {
     if (!_connectionDrag.isValid()) return;
     
-    Vector2 start = _connectionDrag.dragStartPosition;
-    Vector2 end = _connectionDrag.currentMousePosition;
-    
-    // Apply canvas offset
-    start.x += _canvasOffset.x;
-    start.y += _canvasOffset.y;
-    end.x += _canvasOffset.x;
-    end.y += _canvasOffset.y;
+    // Drawn under the canvas camera, so bring the mouse positions into canvas space
+    Vector2 start = screenToCanvas(_connectionDrag.dragStartPosition);
+    Vector2 end = screenToCanvas(_connectionDrag.currentMousePosition);
     
     // Draw preview with slightly transparent color
     Color previewColor = _connectionDrag.previewColor;
     previewColor.a = 180; // Semi-transparent
     
-    drawConnectionLine(start, end, previewColor, 2.5f);
+    _connectionRenderer.drawCurve(start, end, previewColor, 2.5f, _canvasZoom);
 }
 
 bool ScriptingEditor::isConnectionValid(ScriptBlock* fromBlock, int fromPortIndex, ScriptBlock* toBlock, int toPortIndex) {
@@ -2248,20 +2556,30 @@ ConnectionPoint* ScriptingEditor::getConnectionPointAt(Vector2 position, ScriptB
     int selectedObjId = getSelectedObjectId();
     if (selectedObjId == -1) return nullptr;
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it == _objectScripts.end()) return nullptr;
+    VisualScript* script = findScript(selectedObjId);
+    if (!script) return nullptr;
     
-    const float portRadius = 8.0f; // Port hit detection radius
+    // Port hit detection radius, never smaller than 8 screen pixels when zoomed out
+    const float portRadius = std::max(8.0f, 8.0f / _canvasZoom);
+    position = screenToCanvas(position);
     
-    for (auto& block : it->second.blocks) {
-        if (!block.isOnCanvas) continue;
+    // Ports sit on block edges, so only blocks near the point can own a hit
+    std::vector<int> candidates;
+    Rectangle area = {position.x - portRadius, position.y - portRadius, portRadius * 2, portRadius * 2};
+    syncCanvasIndex(selectedObjId, *script).queryRect(area, candidates);
+    
+    for (auto rit = candidates.rbegin(); rit != candidates.rend(); ++rit) {
+        ScriptBlock* candidate = script->findBlock(*rit);
+        if (!candidate) continue;
+        ScriptBlock& block = *candidate;
         
         // Check input ports
         for (size_t i = 0; i < block.inputPorts.size(); ++i) {
             Vector2 portPos = block.inputPorts[i].position;
-            float distance = sqrt(pow(position.x - portPos.x, 2) + pow(position.y - portPos.y, 2));
+            float dx = position.x - portPos.x;
+            float dy = position.y - portPos.y;
             
-            if (distance <= portRadius) {
+            if (dx * dx + dy * dy <= portRadius * portRadius) {
                 if (outBlock) *outBlock = &block;
                 if (outPortIndex) *outPortIndex = static_cast<int>(i);
                 return &block.inputPorts[i];
@@ -2271,9 +2589,10 @@ ConnectionPoint* ScriptingEditor::getConnectionPointAt(Vector2 position, ScriptB
         // Check output ports
         for (size_t i = 0; i < block.outputPorts.size(); ++i) {
             Vector2 portPos = block.outputPorts[i].position;
-            float distance = sqrt(pow(position.x - portPos.x, 2) + pow(position.y - portPos.y, 2));
+            float dx = position.x - portPos.x;
+            float dy = position.y - portPos.y;
             
-            if (distance <= portRadius) {
+            if (dx * dx + dy * dy <= portRadius * portRadius) {
                 if (outBlock) *outBlock = &block;
                 if (outPortIndex) *outPortIndex = static_cast<int>(i);
                 return &block.outputPorts[i];
@@ -2291,14 +2610,8 @@ Color ScriptingEditor::getConnectionColor(ConnectionPortType fromType, Connectio
 void ScriptingEditor::updateConnectionPositions(VisualScript& script) {
     // Update cached positions in connections
     for (auto& connection : script.connections) {
-        // Find the blocks
-        ScriptBlock* fromBlock = nullptr;
-        ScriptBlock* toBlock = nullptr;
-        
-        for (auto& block : script.blocks) {
-            if (block.id == connection.fromBlockId) fromBlock = &block;
-            if (block.id == connection.toBlockId) toBlock = &block;
-        }
+        const ScriptBlock* fromBlock = script.findBlock(connection.fromBlockId);
+        const ScriptBlock* toBlock = script.findBlock(connection.toBlockId);
         
         if (fromBlock && toBlock && connection.fromPortIndex < fromBlock->outputPorts.size() 
             && connection.toPortIndex < toBlock->inputPorts.size()) {
@@ -2331,37 +2644,49 @@ CompiledScript VisualScript::compileToExecutionFlow() const {
         
         // Mark entry points (blocks with no execution input)
         bool hasExecutionInput = false;
-        for (const auto& connection : connections) {
-            if (connection.toBlockId == block.id && 
-                (connection.toPortType == ConnectionPortType::EXECUTION_IN)) {
+        for (size_t index : getIncoming(block.id)) {
+            if (connections[index].toPortType == ConnectionPortType::EXECUTION_IN) {
                 hasExecutionInput = true;
                 break;
             }
         }
         
-        // Event blocks are always entry points
-        if (block.type == BlockType::ON_START || block.type == BlockType::ON_CLICK || 
-            block.type == BlockType::ON_UPDATE || block.type == BlockType::ON_KEY_PRESS) {
+        // Event blocks are always entry points; pure value blocks never are
+        if (isEventBlock(block.type)) {
             node.isEntryPoint = true;
             compiled.entryPoints.push_back(block.id);
-        } else if (!hasExecutionInput) {
+        } else if (!hasExecutionInput && block.hasExecutionFlow) {
             node.isEntryPoint = true;
             compiled.entryPoints.push_back(block.id);
         }
         
         // Find connected next nodes
-        for (const auto& connection : connections) {
-            if (connection.fromBlockId == block.id) {
-                if (connection.fromPortType == ConnectionPortType::EXECUTION_OUT) {
+        for (size_t index : getOutgoing(block.id)) {
+            const BlockConnection& connection = connections[index];
+            if (connection.fromPortType == ConnectionPortType::EXECUTION_OUT) {
+                // LOOP port 1 is the "Body" output, port 0 the "Next" exit
+                if (block.type == BlockType::LOOP && connection.fromPortIndex == 1) {
+                    node.loopBodyNode = connection.toBlockId;
+                } else {
                     node.nextNodes.push_back(connection.toBlockId);
-                } else if (connection.fromPortType == ConnectionPortType::TRUE_OUT) {
-                    node.trueNextNode = connection.toBlockId;
-                } else if (connection.fromPortType == ConnectionPortType::FALSE_OUT) {
-                    node.falseNextNode = connection.toBlockId;
                 }
+            } else if (connection.fromPortType == ConnectionPortType::TRUE_OUT) {
+                node.trueNextNode = connection.toBlockId;
+            } else if (connection.fromPortType == ConnectionPortType::FALSE_OUT) {
+                node.falseNextNode = connection.toBlockId;
             }
         }
         
+        // Value inputs are indexed by the block's input port
+        for (size_t index : getIncoming(block.id)) {
+            const BlockConnection& connection = connections[index];
+            if (connection.toPortType != ConnectionPortType::VALUE_IN) continue;
+            if (connection.toPortIndex >= static_cast<int>(node.valueInputs.size())) {
+                node.valueInputs.resize(connection.toPortIndex + 1, -1);
+            }
+            node.valueInputs[connection.toPortIndex] = connection.fromBlockId;
+        }
+        
         compiled.nodes.push_back(node);
     }
     
@@ -2370,75 +2695,263 @@ CompiledScript VisualScript::compileToExecutionFlow() const {
 }
 
 bool VisualScript::validateConnections(std::string& errors) const {
-    errors.clear();
-    bool isValid = true;
+    ensureIndex();
     
-    // Check for orphaned blocks (except entry points)
+    // Only blocks touched since the last run are re-checked
+    for (int blockId : _dirtyBlocks) {
+        const ScriptBlock* block = findBlock(blockId);
+        if (block) {
+            validateBlock(*block);
+        } else {
+            _blockErrors.erase(blockId);
+        }
+    }
+    _dirtyBlocks.clear();
+    
+    errors.clear();
     for (const auto& block : blocks) {
-        if (!block.isOnCanvas) continue;
-        
-        bool isEntryPoint = (block.type == BlockType::ON_START || block.type == BlockType::ON_CLICK || 
-                           block.type == BlockType::ON_UPDATE || block.type == BlockType::ON_KEY_PRESS);
-        
-        if (!isEntryPoint) {
-            bool hasInput = false;
-            for (const auto& connection : connections) {
-                if (connection.toBlockId == block.id && 
-                    connection.toPortType == ConnectionPortType::EXECUTION_IN) {
-                    hasInput = true;
-                    break;
-                }
-            }
-            
-            if (!hasInput) {
-                errors += "Block " + std::to_string(block.id) + " (" + block.title + ") has no input connection.\n";
-                isValid = false;
-            }
+        auto it = _blockErrors.find(block.id);
+        if (it != _blockErrors.end()) {
+            errors += it->second;
         }
     }
+    errors += _danglingErrors;
+    return errors.empty();
+}
+
+void VisualScript::validateBlock(const ScriptBlock& block) const {
+    std::string blockErrors;
     
-    // Check for invalid connections
-    for (const auto& connection : connections) {
-        // Find source and target blocks
-        const ScriptBlock* fromBlock = nullptr;
-        const ScriptBlock* toBlock = nullptr;
+    // Check for orphaned blocks (except entry points)
+    bool hasExecutionPort = std::any_of(block.inputPorts.begin(), block.inputPorts.end(),
+        [](const ConnectionPoint& port) { return port.type == ConnectionPortType::EXECUTION_IN; });
+    
+    // Value blocks and port-less conditions are fed by data, not by flow
+    if (block.isOnCanvas && !isEventBlock(block.type) && hasExecutionPort) {
+        const auto& incoming = getIncoming(block.id);
+        bool hasInput = std::any_of(incoming.begin(), incoming.end(), [this](size_t index) {
+            return connections[index].toPortType == ConnectionPortType::EXECUTION_IN;
+        });
         
-        for (const auto& block : blocks) {
-            if (block.id == connection.fromBlockId) fromBlock = &block;
-            if (block.id == connection.toBlockId) toBlock = &block;
+        if (!hasInput) {
+            blockErrors += "Block " + std::to_string(block.id) + " (" + block.title + ") has no input connection.\n";
         }
+    }
+    
+    // Check the connections leaving this block
+    for (size_t index : getOutgoing(block.id)) {
+        const BlockConnection& connection = connections[index];
+        const ScriptBlock* toBlock = findBlock(connection.toBlockId);
         
-        if (!fromBlock || !toBlock) {
-            errors += "Connection references non-existent block(s).\n";
-            isValid = false;
+        if (!toBlock) {
+            blockErrors += "Connection references non-existent block(s).\n";
             continue;
         }
         
         // Validate port indices
-        if (connection.fromPortIndex >= fromBlock->outputPorts.size() ||
+        if (connection.fromPortIndex >= block.outputPorts.size() ||
             connection.toPortIndex >= toBlock->inputPorts.size()) {
-            errors += "Connection has invalid port indices.\n";
-            isValid = false;
+            blockErrors += "Connection has invalid port indices.\n";
+        }
+    }
+    
+    if (blockErrors.empty()) {
+        _blockErrors.erase(block.id);
+    } else {
+        _blockErrors[block.id] = blockErrors;
+    }
+}
+
+// ==========================================
+// Visual Script Graph Index
+// ==========================================
+
+void VisualScript::ensureIndex() const {
+    if (!_indexDirty) return;
+    
+    _blockIndex.clear();
+    _outgoing.clear();
+    _incoming.clear();
+    _blockErrors.clear();
+    _dirtyBlocks.clear();
+    _danglingErrors.clear();
+    
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        _blockIndex[blocks[i].id] = i;
+        _dirtyBlocks.insert(blocks[i].id);
+    }
+    for (size_t i = 0; i < connections.size(); ++i) {
+        const BlockConnection& connection = connections[i];
+        _outgoing[connection.fromBlockId].push_back(i);
+        _incoming[connection.toBlockId].push_back(i);
+        if (!_blockIndex.count(connection.fromBlockId)) {
+            _danglingErrors += "Connection references non-existent block(s).\n";
+        }
+    }
+    _indexDirty = false;
+}
+
+void VisualScript::invalidateIndex() {
+    _indexDirty = true;
+    _revision++;
+}
+
+ScriptBlock& VisualScript::addBlock(const ScriptBlock& block) {
+    ensureIndex();
+    blocks.push_back(block);
+    _revision++;
+    _blockIndex[block.id] = blocks.size() - 1;
+    _dirtyBlocks.insert(block.id);
+    return blocks.back();
+}
+
+void VisualScript::removeBlock(int blockId) {
+    ensureIndex();
+    auto found = _blockIndex.find(blockId);
+    if (found == _blockIndex.end()) return;
+    
+    removeConnections(blockId, -1);
+    removeConnections(-1, blockId);
+    
+    // Erase in place to keep the drawing/hit-test order of the other blocks
+    size_t position = found->second;
+    blocks.erase(blocks.begin() + position);
+    _revision++;
+    _blockIndex.erase(blockId);
+    for (size_t i = position; i < blocks.size(); ++i) {
+        _blockIndex[blocks[i].id] = i;
+    }
+    _outgoing.erase(blockId);
+    _incoming.erase(blockId);
+    _blockErrors.erase(blockId);
+    _dirtyBlocks.erase(blockId);
+}
+
+void VisualScript::addConnection(const BlockConnection& connection) {
+    ensureIndex();
+    connections.push_back(connection);
+    size_t index = connections.size() - 1;
+    _outgoing[connection.fromBlockId].push_back(index);
+    _incoming[connection.toBlockId].push_back(index);
+    _dirtyBlocks.insert(connection.fromBlockId);
+    _dirtyBlocks.insert(connection.toBlockId);
+}
+
+void VisualScript::removeConnections(int fromBlockId, int toBlockId, int fromPortIndex, int toPortIndex) {
+    ensureIndex();
+    
+    // Narrow the search with the adjacency lists when an endpoint is known
+    std::vector<size_t> candidates;
+    if (fromBlockId != -1) {
+        candidates = getOutgoing(fromBlockId);
+    } else if (toBlockId != -1) {
+        candidates = getIncoming(toBlockId);
+    } else {
+        for (size_t i = 0; i < connections.size(); ++i) candidates.push_back(i);
+    }
+    
+    std::vector<size_t> matches;
+    for (size_t index : candidates) {
+        const BlockConnection& conn = connections[index];
+        bool matchFrom = (fromBlockId == -1 || conn.fromBlockId == fromBlockId);
+        bool matchTo = (toBlockId == -1 || conn.toBlockId == toBlockId);
+        bool matchFromPort = (fromPortIndex == -1 || conn.fromPortIndex == fromPortIndex);
+        bool matchToPort = (toPortIndex == -1 || conn.toPortIndex == toPortIndex);
+        if (matchFrom && matchTo && matchFromPort && matchToPort) {
+            matches.push_back(index);
         }
     }
     
-    return isValid;
+    // Highest index first so swap-removal never moves a pending match
+    std::sort(matches.rbegin(), matches.rend());
+    for (size_t index : matches) {
+        removeConnectionAt(index);
+    }
+}
+
+void VisualScript::removeConnectionAt(size_t index) {
+    auto unlink = [](std::vector<size_t>& list, size_t value) {
+        list.erase(std::remove(list.begin(), list.end(), value), list.end());
+    };
+    auto relink = [](std::vector<size_t>& list, size_t from, size_t to) {
+        std::replace(list.begin(), list.end(), from, to);
+    };
+    
+    const BlockConnection& removed = connections[index];
+    if (!_blockIndex.count(removed.fromBlockId) || !_blockIndex.count(removed.toBlockId)) {
+        // Dangling connections only come from loaded files, rebuild to refresh their errors
+        _indexDirty = true;
+    }
+    unlink(_outgoing[removed.fromBlockId], index);
+    unlink(_incoming[removed.toBlockId], index);
+    _dirtyBlocks.insert(removed.fromBlockId);
+    _dirtyBlocks.insert(removed.toBlockId);
+    
+    size_t last = connections.size() - 1;
+    if (index != last) {
+        connections[index] = connections[last];
+        relink(_outgoing[connections[index].fromBlockId], last, index);
+        relink(_incoming[connections[index].toBlockId], last, index);
+    }
+    connections.pop_back();
+}
+
+ScriptBlock* VisualScript::findBlock(int blockId) {
+    ensureIndex();
+    auto it = _blockIndex.find(blockId);
+    return it != _blockIndex.end() ? &blocks[it->second] : nullptr;
+}
+
+const ScriptBlock* VisualScript::findBlock(int blockId) const {
+    ensureIndex();
+    auto it = _blockIndex.find(blockId);
+    return it != _blockIndex.end() ? &blocks[it->second] : nullptr;
+}
+
+const std::vector<size_t>& VisualScript::getOutgoing(int blockId) const {
+    static const std::vector<size_t> none;
+    ensureIndex();
+    auto it = _outgoing.find(blockId);
+    return it != _outgoing.end() ? it->second : none;
+}
+
+const std::vector<size_t>& VisualScript::getIncoming(int blockId) const {
+    static const std::vector<size_t> none;
+    ensureIndex();
+    auto it = _incoming.find(blockId);
+    return it != _incoming.end() ? it->second : none;
 }
 
 CompiledScript ScriptingEditor::compileScript(int objectId) {
-    auto it = _objectScripts.find(objectId);
-    if (it == _objectScripts.end()) {
+    bool reused = false;
+    std::shared_ptr<const CompiledScript> shared = _scripts.compile(objectId, &reused);
+    if (!shared) {
         CompiledScript empty(objectId);
         empty.errors = "No script found for object " + std::to_string(objectId);
         return empty;
     }
     
-    CompiledScript compiled = it->second.compileToExecutionFlow();
+    // The compiled graph is shared by every object with identical content
+    CompiledScript compiled = *shared;
+    compiled.objectId = objectId;
+    compiled.name = _scripts.getName(objectId);
     
     if (compiled.isValid) {
+        if (reused) {
+            std::cout << "[ScriptingEditor] Reused compiled script for object " << objectId
+                      << " (" << compiled.nodes.size() << " nodes)" << std::endl;
+            return compiled;
+        }
+        
         std::cout << "[ScriptingEditor] Successfully compiled script for object " << objectId 
                   << " with " << compiled.nodes.size() << " nodes and " 
                   << compiled.entryPoints.size() << " entry points" << std::endl;
+        if (const scripting::OptimizationReport* report = _scripts.getOptimizationReport(objectId)) {
+            for (const auto& pass : report->passes) {
+                std::cout << "[ScriptingEditor]   " << pass.name << ": -" << pass.removedNodes
+                          << " nodes, -" << pass.removedEdges << " edges" << std::endl;
+            }
+        }
     } else {
         std::cout << "[ScriptingEditor] Compilation failed for object " << objectId 
                   << ": " << compiled.errors << std::endl;
@@ -2448,13 +2961,87 @@ CompiledScript ScriptingEditor::compileScript(int objectId) {
 }
 
 bool ScriptingEditor::validateScript(int objectId, std::string& errors) {
-    auto it = _objectScripts.find(objectId);
-    if (it == _objectScripts.end()) {
+    if (!_scripts.contains(objectId)) {
         errors = "No script found for object " + std::to_string(objectId);
         return false;
     }
     
-    return it->second.validateConnections(errors);
+    // Answer from the background build when it describes the current script
+    const ScriptBuildStatus* status = findBuildStatus(objectId);
+    if (status && status->builtVersion == status->version && !_editedScripts.count(objectId)) {
+        errors = status->errors;
+        return status->isValid;
+    }
+    
+    // Only the script on the canvas keeps a validation cache
+    if (objectId == _scripts.getCheckedOutId()) {
+        return findScript(objectId)->validateConnections(errors);
+    }
+    return _scripts.materialize(objectId).validateConnections(errors);
+}
+
+void ScriptingEditor::markScriptEdited(int objectId) {
+    if (objectId != -1) {
+        _editedScripts.insert(objectId);
+    }
+}
+
+void ScriptingEditor::submitEditedScripts() {
+    // Several edits in one frame are built once
+    for (int objectId : _editedScripts) {
+        if (!_scripts.contains(objectId)) {
+            _buildStatus.erase(objectId);
+            continue;
+        }
+        ScriptBuildStatus& status = _buildStatus[objectId];
+        status.version = ++_nextBuildVersion;
+        _buildWorker.submit(objectId, status.version,
+                            std::make_shared<const VisualScript>(_scripts.materialize(objectId)));
+    }
+    _editedScripts.clear();
+}
+
+void ScriptingEditor::collectBuildResults() {
+    _buildResults.clear();
+    if (!_buildWorker.poll(_buildResults)) {
+        return;
+    }
+    
+    for (auto& result : _buildResults) {
+        // Drop results overtaken by a later edit
+        auto it = _buildStatus.find(result.objectId);
+        if (it == _buildStatus.end() || it->second.version != result.version) {
+            continue;
+        }
+        
+        ScriptBuildStatus& status = it->second;
+        status.builtVersion = result.version;
+        status.isValid = result.isValid;
+        status.errors = std::move(result.errors);
+        status.blockErrors = std::move(result.blockErrors);
+        if (result.compiled && _liveLink && _liveLink->isConnected()) {
+            pushToLiveLink(result.objectId, *result.compiled);
+        }
+        if (result.compiled && !_editedScripts.count(result.objectId)) {
+            _scripts.adoptCompiled(result.objectId, std::move(result.compiled), result.report);
+        }
+    }
+}
+
+const ScriptingEditor::ScriptBuildStatus* ScriptingEditor::findBuildStatus(int objectId) const {
+    auto it = _buildStatus.find(objectId);
+    return it != _buildStatus.end() ? &it->second : nullptr;
+}
+
+std::vector<CompiledScript> ScriptingEditor::getCompiledScripts() {
+    std::vector<CompiledScript> scripts;
+    for (int objectId : _scripts.getObjectIds()) {
+        CompiledScript compiled = compileScript(objectId);
+        if (compiled.isValid) {
+            scripts.push_back(std::move(compiled));
+        }
+    }
+    return scripts;
 }
 
 void ScriptingEditor::exportCompiledScripts(const std::string& filePath) {
@@ -2468,11 +3055,11 @@ void ScriptingEditor::exportCompiledScripts(const std::string& filePath) {
     file << "  \"compiledScripts\": [\n";
     
     bool first = true;
-    for (const auto& pair : _objectScripts) {
+    for (int objectId : _scripts.getObjectIds()) {
         if (!first) file << ",\n";
         first = false;
         
-        CompiledScript compiled = compileScript(pair.first);
+        CompiledScript compiled = compileScript(objectId);
         
         file << "    {\n";
         file << "      \"objectId\": " << compiled.objectId << ",\n";
@@ -2508,7 +3095,8 @@ void ScriptingEditor::exportCompiledScripts(const std::string& filePath) {
             file << "],\n";
             
             file << "          \"trueNextNode\": " << node.trueNextNode << ",\n";
-            file << "          \"falseNextNode\": " << node.falseNextNode << "\n";
+            file << "          \"falseNextNode\": " << node.falseNextNode << ",\n";
+            file << "          \"loopBodyNode\": " << node.loopBodyNode << "\n";
             file << "        }";
         }
         file << "\n      ]\n";
@@ -2519,8 +3107,9 @@ void ScriptingEditor::exportCompiledScripts(const std::string& filePath) {
     file << "}\n";
     
     file.close();
-    std::cout << "[ScriptingEditor] Exported " << _objectScripts.size() 
-              << " compiled scripts to " << filePath << std::endl;
+    std::cout << "[ScriptingEditor] Exported " << _scripts.getObjectCount() 
+              << " compiled scripts to " << filePath << " (" << _scripts.getVariantCount()
+              << " distinct)" << std::endl;
 }
 
 void ScriptingEditor::saveCurrentScript() {
@@ -2530,8 +3119,8 @@ void ScriptingEditor::saveCurrentScript() {
         return;
     }
     
-    auto it = _objectScripts.find(selectedObjId);
-    if (it == _objectScripts.end()) {
+    VisualScript* script = findScript(selectedObjId);
+    if (!script) {
         std::cout << "[ScriptingEditor] No script found for object " << selectedObjId << std::endl;
         return;
     }
@@ -2543,187 +3132,118 @@ void ScriptingEditor::saveCurrentScript() {
         return;
     }
     
-    std::string filename = scriptsDir + "/script_object_" + std::to_string(selectedObjId) + ".json";
-    saveScriptToFile(it->second, filename);
+    std::string basename = scriptsDir + "/script_object_" + std::to_string(selectedObjId);
+    saveScriptToFile(*script, basename + ScriptSerializer::BINARY_EXTENSION);
+    
+    // Refresh the optimizer statistics shown on the canvas, and ship the result to the game
+    CompiledScript compiled = compileScript(selectedObjId);
+    if (compiled.isValid) {
+        scripting::CompiledScriptIO::saveToFile(compiled, basename + scripting::CompiledScriptIO::FILE_EXTENSION);
+    }
 }
 
 void ScriptingEditor::saveScriptToFile(const VisualScript& script, const std::string& filepath) {
-    std::string jsonContent = scriptToJson(script);
-    
-    std::ofstream file(filepath);
-    if (!file.is_open()) {
+    if (!ScriptSerializer::saveToFile(script, filepath)) {
         std::cout << "[ScriptingEditor] Failed to create file: " << filepath << std::endl;
         return;
     }
     
-    file << jsonContent;
-    file.close();
-    
     std::cout << "[ScriptingEditor] Script saved to: " << filepath << std::endl;
 }
 
 void ScriptingEditor::loadScriptFromFile(const std::string& filepath) {
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
+    std::vector<uint8_t> buffer;
+    if (!scripting::CompiledScriptIO::readFile(filepath, buffer)) {
         std::cout << "[ScriptingEditor] Failed to open file: " << filepath << std::endl;
         return;
     }
     
-    std::string jsonContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-    file.close();
-    
-    VisualScript loadedScript = jsonToScript(jsonContent);
-    if (loadedScript.objectId != -1) {
-        _objectScripts[loadedScript.objectId] = loadedScript;
-        std::cout << "[ScriptingEditor] Script loaded for object " << loadedScript.objectId << std::endl;
+    VisualScript loadedScript;
+    std::string error;
+    if (!ScriptSerializer::load(buffer.data(), buffer.size(), loadedScript, error)) {
+        std::cout << "[ScriptingEditor] Failed to load " << filepath << ": " << error << std::endl;
+        return;
     }
+    
+    int objectId = loadedScript.objectId;
+    registerLoadedScript(std::move(loadedScript));
+    std::cout << "[ScriptingEditor] Script loaded for object " << objectId << std::endl;
 }
 
-void ScriptingEditor::clearAllScripts() {
-    _objectScripts.clear();
-    _nextBlockId = 1;
-    _nextCanvasOrder = 0;
-    std::cout << "[ScriptingEditor] All scripts cleared" << std::endl;
-}
-
-std::string ScriptingEditor::scriptToJson(const VisualScript& script) {
-    std::ostringstream json;
-    
-    json << "{\n";
-    json << "  \"objectId\": " << script.objectId << ",\n";
-    json << "  \"name\": \"" << script.name << "\",\n";
-    json << "  \"enabled\": " << (script.enabled ? "true" : "false") << ",\n";
-    
-    // Serialize blocks
-    json << "  \"blocks\": [\n";
-    for (size_t i = 0; i < script.blocks.size(); ++i) {
-        const ScriptBlock& block = script.blocks[i];
-        
-        json << "    {\n";
-        json << "      \"id\": " << block.id << ",\n";
-        json << "      \"type\": " << static_cast<int>(block.type) << ",\n";
-        json << "      \"position\": {\n";
-        json << "        \"x\": " << block.position.x << ",\n";
-        json << "        \"y\": " << block.position.y << "\n";
-        json << "      },\n";
-        json << "      \"size\": {\n";
-        json << "        \"width\": " << block.size.x << ",\n";
-        json << "        \"height\": " << block.size.y << "\n";
-        json << "      },\n";
-        json << "      \"title\": \"" << block.title << "\",\n";
-        json << "      \"subtitle\": \"" << block.subtitle << "\",\n";
-        json << "      \"isOnCanvas\": " << (block.isOnCanvas ? "true" : "false") << ",\n";
-        json << "      \"canvasOrder\": " << block.canvasOrder << ",\n";
-        
-        // Serialize block configuration
-        json << "      \"config\": {\n";
-        json << "        \"floatParams\": {\n";
-        bool firstFloat = true;
-        for (const auto& param : block.config.floatParams) {
-            if (!firstFloat) json << ",\n";
-            json << "          \"" << param.first << "\": " << param.second;
-            firstFloat = false;
-        }
-        json << "\n        },\n";
-        
-        json << "        \"vectorParams\": {\n";
-        bool firstVector = true;
-        for (const auto& param : block.config.vectorParams) {
-            if (!firstVector) json << ",\n";
-            json << "          \"" << param.first << "\": {\n";
-            json << "            \"x\": " << param.second.x << ",\n";
-            json << "            \"y\": " << param.second.y << ",\n";
-            json << "            \"z\": " << param.second.z << "\n";
-            json << "          }";
-            firstVector = false;
-        }
-        json << "\n        },\n";
-        
-        json << "        \"stringParams\": {\n";
-        bool firstString = true;
-        for (const auto& param : block.config.stringParams) {
-            if (!firstString) json << ",\n";
-            json << "          \"" << param.first << "\": \"" << param.second << "\"";
-            firstString = false;
-        }
-        json << "\n        },\n";
-        
-        json << "        \"boolParams\": {\n";
-        bool firstBool = true;
-        for (const auto& param : block.config.boolParams) {
-            if (!firstBool) json << ",\n";
-            json << "          \"" << param.first << "\": " << (param.second ? "true" : "false");
-            firstBool = false;
-        }
-        json << "\n        }\n";
-        json << "      }\n";
-        json << "    }";
-        
-        if (i < script.blocks.size() - 1) json << ",";
-        json << "\n";
+void ScriptingEditor::loadScriptsFromDirectory(const std::string& directory) {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(directory, ec)) {
+        return;
     }
-    json << "  ],\n";
     
-    // Serialize connections
-    json << "  \"connections\": [\n";
-    for (size_t i = 0; i < script.connections.size(); ++i) {
-        const BlockConnection& conn = script.connections[i];
-        
-        json << "    {\n";
-        json << "      \"fromBlockId\": " << conn.fromBlockId << ",\n";
-        json << "      \"toBlockId\": " << conn.toBlockId << ",\n";
-        json << "      \"fromPortType\": " << static_cast<int>(conn.fromPortType) << ",\n";
-        json << "      \"toPortType\": " << static_cast<int>(conn.toPortType) << ",\n";
-        json << "      \"fromPortIndex\": " << conn.fromPortIndex << ",\n";
-        json << "      \"toPortIndex\": " << conn.toPortIndex << ",\n";
-        json << "      \"isValid\": " << (conn.isValid ? "true" : "false") << "\n";
-        json << "    }";
-        
-        if (i < script.connections.size() - 1) json << ",";
-        json << "\n";
-    }
-    json << "  ]\n";
-    json << "}";
-    
-    return json.str();
-}
-
-VisualScript ScriptingEditor::jsonToScript(const std::string& jsonContent) {
-    VisualScript script;
-    
-    // Simple JSON parsing (basic implementation)
-    // In a production system, you would use a proper JSON library like nlohmann/json
-    
-    // Extract objectId
-    size_t objectIdPos = jsonContent.find("\"objectId\":");
-    if (objectIdPos != std::string::npos) {
-        size_t numStart = jsonContent.find_first_of("0123456789-", objectIdPos);
-        size_t numEnd = jsonContent.find_first_of(",\n}", numStart);
-        if (numStart != std::string::npos && numEnd != std::string::npos) {
-            script.objectId = std::stoi(jsonContent.substr(numStart, numEnd - numStart));
-        }
+    // Binary files win over JSON files saved for the same object
+    std::unordered_map<std::string, std::filesystem::path> sources;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        const std::filesystem::path& path = entry.path();
+        std::string extension = path.extension().string();
+        if (extension != ScriptSerializer::BINARY_EXTENSION && extension != ScriptSerializer::JSON_EXTENSION) {
+            continue;
+        }
+        std::string stem = path.stem().string();
+        auto existing = sources.find(stem);
+        if (existing == sources.end() || extension == ScriptSerializer::BINARY_EXTENSION) {
+            sources[stem] = path;
+        }
     }
     
-    // Extract name
-    size_t namePos = jsonContent.find("\"name\":");
-    if (namePos != std::string::npos) {
-        size_t nameStart = jsonContent.find("\"", namePos + 7) + 1;
-        size_t nameEnd = jsonContent.find("\"", nameStart);
-        if (nameStart != std::string::npos && nameEnd != std::string::npos) {
-            script.name = jsonContent.substr(nameStart, nameEnd - nameStart);
+    // One read buffer for the whole directory
+    std::vector<uint8_t> buffer;
+    std::string error;
+    size_t loaded = 0;
+    for (const auto& source : sources) {
+        if (!scripting::CompiledScriptIO::readFile(source.second.string(), buffer)) {
+            continue;
         }
+        VisualScript script;
+        if (!ScriptSerializer::load(buffer.data(), buffer.size(), script, error)) {
+            std::cout << "[ScriptingEditor] Skipping " << source.second.string() << ": " << error << std::endl;
+            continue;
+        }
+        registerLoadedScript(std::move(script));
+        loaded++;
     }
     
-    // Extract enabled
-    size_t enabledPos = jsonContent.find("\"enabled\":");
-    if (enabledPos != std::string::npos) {
-        script.enabled = jsonContent.find("true", enabledPos) < jsonContent.find("false", enabledPos);
+    std::cout << "[ScriptingEditor] Loaded " << loaded << " scripts (" << _scripts.getDefinitionCount()
+              << " distinct graphs) from " << directory << std::endl;
+}
+
+void ScriptingEditor::registerLoadedScript(VisualScript&& script) {
+    if (script.objectId == -1) {
+        return;
     }
     
-    std::cout << "[ScriptingEditor] Basic JSON parsing implemented. For full loading functionality, " 
-              << "integrate a proper JSON library like nlohmann/json" << std::endl;
+    // Keep ids handed out by the editor clear of the ones in the file
+    for (const auto& block : script.blocks) {
+        _nextBlockId = std::max(_nextBlockId, block.id + 1);
+        _nextCanvasOrder = std::max(_nextCanvasOrder, block.canvasOrder + 1);
+    }
+    for (auto& connection : script.connections) {
+        connection.connectionColor = getConnectionColor(connection.fromPortType, connection.toPortType);
+    }
     
-    return script;
+    // Replacing the script on the canvas drops its private copy
+    if (script.objectId == _scripts.getCheckedOutId()) {
+        resetCanvasState();
+    }
+    _buildStatus.erase(script.objectId);
+    _scripts.assign(std::move(script));
+    _blockTextureCache.clear();
+}
+
+void ScriptingEditor::clearAllScripts() {
+    resetCanvasState();
+    _scripts.clear();
+    _buildWorker.cancelPending();
+    _buildStatus.clear();
+    _editedScripts.clear();
+    _nextBlockId = 1;
+    _nextCanvasOrder = 0;
+    std::cout << "[ScriptingEditor] All scripts cleared" << std::endl;
 }
 
 bool ScriptingEditor::createDirectoryIfNotExists(const std::string& path) {
@@ -2803,50 +3323,52 @@ void FieldState::setFromInt(int value) {
 
 // Modular configuration system implementation
 void ScriptingEditor::initializeBlockConfigTemplates() {
+    // Field defaults come from BlockParamLayout, like new blocks and the scheduler's
+    
     // ON_KEY_PRESS block configuration
     _blockConfigTemplates[BlockType::ON_KEY_PRESS] = BlockConfigTemplate("Key Press Event")
-        .addField(FieldDefinition("key", "Key", FieldType::COMBO, "Space")
+        .addField(FieldDefinition("key", "Key", FieldType::COMBO)
             .withOptions({"Space", "A", "W", "S", "D", "Up", "Down", "Left", "Right", "Enter"})
             .withDescription("The key that triggers this event"));
     
     // MOVE block configuration
     _blockConfigTemplates[BlockType::MOVE] = BlockConfigTemplate("Move Action")
-        .addField(FieldDefinition("speed", "Speed", FieldType::FLOAT, "1.0")
+        .addField(FieldDefinition("speed", "Speed", FieldType::FLOAT)
             .withRange(0.1f, 50.0f)
             .withDescription("Movement speed in units per second"))
-        .addField(FieldDefinition("direction", "Direction", FieldType::VECTOR3, "1.0,0.0,0.0")
+        .addField(FieldDefinition("direction", "Direction", FieldType::VECTOR3)
             .withDescription("Direction vector (X, Y, Z)"))
         .withSize(450, 400);
     
     // ROTATE block configuration
     _blockConfigTemplates[BlockType::ROTATE] = BlockConfigTemplate("Rotate Action")
-        .addField(FieldDefinition("speed", "Speed (deg/sec)", FieldType::FLOAT, "90.0")
+        .addField(FieldDefinition("speed", "Speed (deg/sec)", FieldType::FLOAT)
             .withRange(0.1f, 360.0f)
             .withDescription("Rotation speed in degrees per second"));
     
     // DELAY block configuration
     _blockConfigTemplates[BlockType::DELAY] = BlockConfigTemplate("Delay Action")
-        .addField(FieldDefinition("duration", "Duration (seconds)", FieldType::FLOAT, "1.0")
+        .addField(FieldDefinition("duration", "Duration (seconds)", FieldType::FLOAT)
             .withRange(0.1f, 60.0f)
             .withDescription("How long to wait in seconds"));
     
     // LOG block configuration
     _blockConfigTemplates[BlockType::LOG] = BlockConfigTemplate("Log Action")
-        .addField(FieldDefinition("message", "Message", FieldType::STRING, "Debug message")
+        .addField(FieldDefinition("message", "Message", FieldType::STRING)
             .withDescription("Text to display in the console"))
         .withSize(450, 350);
     
     // LOOP block configuration
     _blockConfigTemplates[BlockType::LOOP] = BlockConfigTemplate("Loop Action")
-        .addField(FieldDefinition("iterations", "Iterations", FieldType::INTEGER, "5")
+        .addField(FieldDefinition("iterations", "Iterations", FieldType::INTEGER)
             .withRange(1, 1000)
             .withDescription("Number of times to repeat"));
     
     // CHANGE_COLOR block configuration
     _blockConfigTemplates[BlockType::CHANGE_COLOR] = BlockConfigTemplate("Change Color Action")
-        .addField(FieldDefinition("color", "Color", FieldType::VECTOR3, "1.0,0.0,0.0")
+        .addField(FieldDefinition("color", "Color", FieldType::VECTOR3)
             .withDescription("RGB color values (0.0 to 1.0)"))
-        .addField(FieldDefinition("duration", "Duration", FieldType::FLOAT, "0.5")
+        .addField(FieldDefinition("duration", "Duration", FieldType::FLOAT)
             .withRange(0.1f, 10.0f)
             .withDescription("Color transition duration"));
     
@@ -2856,12 +3378,20 @@ void ScriptingEditor::initializeBlockConfigTemplates() {
     
     // Value blocks
     _blockConfigTemplates[BlockType::VALUE] = BlockConfigTemplate("Value")
-        .addField(FieldDefinition("value", "Value", FieldType::FLOAT, "0.0")
+        .addField(FieldDefinition("value", "Value", FieldType::FLOAT)
             .withDescription("Numeric value"));
     
     _blockConfigTemplates[BlockType::TRUE] = BlockConfigTemplate("True Value");
     _blockConfigTemplates[BlockType::FALSE] = BlockConfigTemplate("False Value");
     
+    // Bind each field to its parameter slot once, instead of looking it up by name on every edit
+    for (auto& [blockType, configTemplate] : _blockConfigTemplates) {
+        const BlockParamLayout& layout = BlockParamLayout::get(blockType);
+        for (auto& field : configTemplate.fields) {
+            field.slot = layout.findSlot(ParamNames::find(field.key));
+        }
+    }
+    
     std::cout << "[ScriptingEditor] Initialized " << _blockConfigTemplates.size() << " block configuration templates" << std::endl;
 }
 
@@ -2882,27 +3412,26 @@ void ScriptingEditor::loadFieldStatesFromBlock(ScriptBlock* block) {
     resetFieldStates();
     
     BlockConfigTemplate& configTemplate = getConfigTemplate(block->type);
+    const BlockConfig defaults = BlockConfig::forType(block->type);
     
     for (const auto& field : configTemplate.fields) {
         FieldState& state = _fieldStates[field.key];
         
         switch (field.type) {
             case FieldType::FLOAT: {
-                auto it = block->config.floatParams.find(field.key);
-                if (it != block->config.floatParams.end()) {
-                    state.setFromFloat(it->second);
-                } else {
-                    state.setFromFloat(std::stof(field.defaultValue));
+                if (block->config.hasSlot(field.slot, ParamType::FLOAT)) {
+                    state.setFromFloat(block->config.getFloat(field.slot));
+                } else if (defaults.hasSlot(field.slot, ParamType::FLOAT)) {
+                    state.setFromFloat(defaults.getFloat(field.slot));
                 }
                 break;
             }
             case FieldType::STRING:
             case FieldType::COMBO: {
-                auto it = block->config.stringParams.find(field.key);
-                if (it != block->config.stringParams.end()) {
-                    state.setFromString(it->second);
-                } else {
-                    state.setFromString(field.defaultValue);
+                if (block->config.hasSlot(field.slot, ParamType::STRING)) {
+                    state.setFromString(block->config.getString(field.slot));
+                } else if (defaults.hasSlot(field.slot, ParamType::STRING)) {
+                    state.setFromString(defaults.getString(field.slot));
                 }
                 
                 // Set combo index for combo fields
@@ -2914,43 +3443,26 @@ void ScriptingEditor::loadFieldStatesFromBlock(ScriptBlock* block) {
                 break;
             }
             case FieldType::BOOL: {
-                auto it = block->config.boolParams.find(field.key);
-                if (it != block->config.boolParams.end()) {
-                    state.setFromBool(it->second);
-                } else {
-                    state.setFromBool(field.defaultValue == "true");
+                if (block->config.hasSlot(field.slot, ParamType::BOOL)) {
+                    state.setFromBool(block->config.getBool(field.slot));
+                } else if (defaults.hasSlot(field.slot, ParamType::BOOL)) {
+                    state.setFromBool(defaults.getBool(field.slot));
                 }
                 break;
             }
             case FieldType::VECTOR3: {
-                auto it = block->config.vectorParams.find(field.key);
-                if (it != block->config.vectorParams.end()) {
-                    state.setFromVector3(it->second);
-                } else {
-                    // Parse default value "x,y,z"
-                    Vector3 defaultVec = {1.0f, 0.0f, 0.0f};
-                    if (!field.defaultValue.empty()) {
-                        std::istringstream ss(field.defaultValue);
-                        std::string token;
-                        int component = 0;
-                        while (std::getline(ss, token, ',') && component < 3) {
-                            float value = std::stof(token);
-                            if (component == 0) defaultVec.x = value;
-                            else if (component == 1) defaultVec.y = value;
-                            else if (component == 2) defaultVec.z = value;
-                            component++;
-                        }
-                    }
-                    state.setFromVector3(defaultVec);
+                if (block->config.hasSlot(field.slot, ParamType::VECTOR)) {
+                    state.setFromVector3(block->config.getVector(field.slot));
+                } else if (defaults.hasSlot(field.slot, ParamType::VECTOR)) {
+                    state.setFromVector3(defaults.getVector(field.slot));
                 }
                 break;
             }
             case FieldType::INTEGER: {
-                auto it = block->config.floatParams.find(field.key);
-                if (it != block->config.floatParams.end()) {
-                    state.setFromInt(static_cast<int>(it->second));
-                } else {
-                    state.setFromInt(std::stoi(field.defaultValue));
+                if (block->config.hasSlot(field.slot, ParamType::FLOAT)) {
+                    state.setFromInt(static_cast<int>(block->config.getFloat(field.slot)));
+                } else if (defaults.hasSlot(field.slot, ParamType::FLOAT)) {
+                    state.setFromInt(static_cast<int>(defaults.getFloat(field.slot)));
                 }
                 break;
             }
@@ -2971,24 +3483,24 @@ void ScriptingEditor::applyFieldStatesToBlock(ScriptBlock* block) {
         
         switch (field.type) {
             case FieldType::FLOAT:
-                block->config.floatParams[field.key] = state.floatValue;
+                block->config.setFloat(field.slot, state.floatValue);
                 break;
             case FieldType::STRING:
-                block->config.stringParams[field.key] = state.stringValue;
+                block->config.setString(field.slot, state.stringValue);
                 break;
             case FieldType::COMBO:
                 if (state.comboIndex >= 0 && state.comboIndex < field.options.size()) {
-                    block->config.stringParams[field.key] = field.options[state.comboIndex];
+                    block->config.setString(field.slot, field.options[state.comboIndex]);
                 }
                 break;
             case FieldType::BOOL:
-                block->config.boolParams[field.key] = state.boolValue;
+                block->config.setBool(field.slot, state.boolValue);
                 break;
             case FieldType::VECTOR3:
-                block->config.vectorParams[field.key] = state.vectorValue;
+                block->config.setVector(field.slot, state.vectorValue);
                 break;
             case FieldType::INTEGER:
-                block->config.floatParams[field.key] = static_cast<float>(state.intValue);
+                block->config.setFloat(field.slot, static_cast<float>(state.intValue));
                 break;
         }
     }
@@ -12,11 +12,22 @@
 #include "Render/Window.hpp"
 #include "Render/Camera.hpp"
 #include "Input/MouseKeyboard.hpp"
+#include "LiveLink/LiveLink.hpp"
 #include "../../UI/EditorEvents.hpp"
 #include "../../UI/SceneObject.hpp"
+#include "Scripting/CompiledScript.hpp"
+#include "Scripting/ScriptOptimizer.hpp"
+#include "Scripting/ScriptProfiler.hpp"
+#include "BlockTextureCache.hpp"
+#include "CanvasSpatialIndex.hpp"
+#include "ConnectionRenderer.hpp"
+#include "ScriptBuildWorker.hpp"
+#include "ScriptLibrary.hpp"
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 /**
  * @brief Block categories for the visual scripting system
@@ -28,44 +39,6 @@ enum class BlockCategory {
     MISC         ///< Miscellaneous blocks (True, False, Value, etc.)
 };
 
-/**
- * @brief Block types for visual scripting
- */
-enum class BlockType {
-    INVALID,      ///< Invalid/not found marker
-    
-    ON_START,
-    ON_CLICK,
-    ON_UPDATE,
-    ON_KEY_PRESS,
-    
-    MOVE,
-    ROTATE,
-    CHANGE_COLOR,
-    HIDE,
-    SHOW,
-    
-    IF,
-    LOOP,
-    
-    TRUE,
-    FALSE,
-    VALUE,
-    ENTITY,
-    DELAY,
-    LOG
-};
-
-/**
- * @brief Block configuration parameters
- */
-struct BlockConfig {
-    std::unordered_map<std::string, float> floatParams;     ///< Float parameters (speed, distance, etc.)
-    std::unordered_map<std::string, Vector3> vectorParams;  ///< Vector parameters (position, direction, etc.)
-    std::unordered_map<std::string, std::string> stringParams; ///< String parameters (key, text, etc.)
-    std::unordered_map<std::string, bool> boolParams;       ///< Boolean parameters
-};
-
 /**
  * @brief Types of editable fields in the configuration dialog
  */
@@ -85,14 +58,14 @@ struct FieldDefinition {
     std::string key;                    ///< Parameter key in BlockConfig
     std::string label;                  ///< Display label
     FieldType type;                     ///< Type of field
-    std::string defaultValue;           ///< Default value as string
     std::vector<std::string> options;   ///< Options for combo boxes
     float minValue = 0.0f;              ///< Minimum value for numeric fields
     float maxValue = 100.0f;            ///< Maximum value for numeric fields
     std::string description = "";       ///< Tooltip or help text
+    int slot = -1;                      ///< Slot of the parameter in the block's BlockConfig, -1 if undeclared
     
-    FieldDefinition(const std::string& k, const std::string& l, FieldType t, const std::string& def = "")
-        : key(k), label(l), type(t), defaultValue(def) {}
+    FieldDefinition(const std::string& k, const std::string& l, FieldType t)
+        : key(k), label(l), type(t) {}
     
     FieldDefinition& withOptions(const std::vector<std::string>& opts) {
         options = opts;
@@ -156,6 +129,15 @@ struct FieldState {
     void setFromInt(int value);
 };
 
+/**
+ * @brief How much of a block is drawn, chosen from its size on screen
+ */
+enum class BlockDetail {
+    FULL,    ///< Header, parameter summary, icons, ports and port labels
+    TITLE,   ///< Flat body with the title and bare ports
+    BOX      ///< Coloured rectangle only
+};
+
 /**
  * @brief Connection port types for different execution flows
  */
@@ -252,6 +234,7 @@ struct ScriptBlock {
     void setupConnectionPorts();
     std::string getDisplayLabel() const;
     std::string getParameterSummary() const;
+    BlockDetail getDetailLevel(float zoom) const;  ///< Level of detail at the given canvas zoom
     
     Vector2 getInputConnectionPoint() const;
     Vector2 getOutputConnectionPoint() const;
@@ -264,37 +247,6 @@ struct ScriptBlock {
 /**
  * @brief Visual script for an object (collection of blocks)
  */
-/**
- * @brief Compiled script node for runtime execution
- */
-struct CompiledScriptNode {
-    int blockId;                            ///< Original block ID
-    BlockType blockType;                    ///< Type of block
-    BlockConfig config;                     ///< Block configuration parameters
-    std::vector<int> nextNodes;             ///< IDs of next nodes to execute
-    int trueNextNode = -1;                  ///< Next node for true branch (conditions)
-    int falseNextNode = -1;                 ///< Next node for false branch (conditions)
-    bool isEntryPoint = false;              ///< Whether this is a script entry point
-    
-    CompiledScriptNode(int id, BlockType type, const BlockConfig& cfg = {})
-        : blockId(id), blockType(type), config(cfg) {}
-};
-
-/**
- * @brief Compiled script flow for runtime execution
- */
-struct CompiledScript {
-    int objectId;                           ///< Associated scene object ID
-    std::string name;                       ///< Script name
-    std::vector<CompiledScriptNode> nodes;  ///< Execution nodes in topological order
-    std::vector<int> entryPoints;           ///< Entry point node IDs (OnStart, OnClick, etc.)
-    bool isValid = false;                   ///< Whether compilation was successful
-    std::string errors;                     ///< Compilation error messages
-    
-    CompiledScript(int objId, const std::string& scriptName = "New Script")
-        : objectId(objId), name(scriptName) {}
-};
-
 struct VisualScript {
     int objectId;                           ///< Associated scene object ID
     std::vector<ScriptBlock> blocks;        ///< Blocks in this script
@@ -308,7 +260,49 @@ struct VisualScript {
         : objectId(objId), name(scriptName), enabled(true) {}
     
     CompiledScript compileToExecutionFlow() const;
+    
+    /**
+     * @brief Validate the graph, re-checking only blocks edited since the last call
+     * @param errors Receives all current errors, in block order
+     * @return true if the graph has no errors
+     */
     bool validateConnections(std::string& errors) const;
+    
+    /**
+     * @brief Errors of each block found by the last validateConnections(), by block ID
+     */
+    const std::unordered_map<int, std::string>& getBlockErrors() const { return _blockErrors; }
+    
+    /**
+     * @brief Graph edits that keep the adjacency index and validation cache in sync
+     *
+     * Code that changes blocks or connections directly must call invalidateIndex().
+     */
+    ScriptBlock& addBlock(const ScriptBlock& block);
+    void removeBlock(int blockId);
+    void addConnection(const BlockConnection& connection);
+    void removeConnections(int fromBlockId, int toBlockId, int fromPortIndex = -1, int toPortIndex = -1);
+    void invalidateIndex();
+    uint64_t getRevision() const { return _revision; }  ///< Bumped whenever blocks are added, removed or invalidated
+    
+    ScriptBlock* findBlock(int blockId);
+    const ScriptBlock* findBlock(int blockId) const;
+    const std::vector<size_t>& getOutgoing(int blockId) const;  ///< Indices into connections
+    const std::vector<size_t>& getIncoming(int blockId) const;  ///< Indices into connections
+
+private:
+    void ensureIndex() const;
+    void removeConnectionAt(size_t index);
+    void validateBlock(const ScriptBlock& block) const;
+    
+    uint64_t _revision = 0;
+    mutable bool _indexDirty = true;
+    mutable std::unordered_map<int, size_t> _blockIndex;              ///< Block ID -> index in blocks
+    mutable std::unordered_map<int, std::vector<size_t>> _outgoing;   ///< Block ID -> connections leaving it
+    mutable std::unordered_map<int, std::vector<size_t>> _incoming;   ///< Block ID -> connections entering it
+    mutable std::unordered_map<int, std::string> _blockErrors;        ///< Cached validation errors per block
+    mutable std::unordered_set<int> _dirtyBlocks;                     ///< Blocks to re-validate
+    mutable std::string _danglingErrors;                              ///< Connections to missing blocks
 };
 
 /**
@@ -357,6 +351,26 @@ public:
      */
     void setSceneProvider(UI::ISceneProvider* provider);
 
+    /**
+     * @param liveLink Connection scripts are pushed through once they build, may be null
+     */
+    void setLiveLink(std::shared_ptr<livelink::LiveLinkClient> liveLink);
+
+    /**
+     * @brief Compile every object's script, for the map editor's play mode
+     * @return The scripts that compiled, invalid ones are left out
+     */
+    std::vector<CompiledScript> getCompiledScripts();
+
+    /**
+     * @brief Where the game and the play mode save their script profile
+     */
+    std::string getProfilePath();
+    /**
+     * @brief Show the profile last saved at getProfilePath() as the heat map
+     */
+    bool reloadProfile();
+
     std::vector<UI::SceneObjectInfo> getSceneObjects() const override;
     UI::SceneObjectInfo getObjectInfo(int objectId) const override;
     bool selectObject(int objectId) override;
@@ -373,7 +387,30 @@ private:
     bool _initialized = false;
     UI::ISceneProvider* _currentSceneProvider = nullptr;
     
-    std::unordered_map<int, VisualScript> _objectScripts;
+    ScriptLibrary _scripts;                   ///< Scripts of all objects, shared between identical graphs
+    
+    /**
+     * @brief Latest background build of an object's script
+     */
+    struct ScriptBuildStatus {
+        uint64_t version = 0;                               ///< Last snapshot submitted
+        uint64_t builtVersion = 0;                          ///< Snapshot the fields below come from
+        bool isValid = true;
+        std::string errors;
+        std::unordered_map<int, std::string> blockErrors;   ///< Shown on the canvas, by block ID
+    };
+    
+    ScriptBuildWorker _buildWorker;
+    std::unordered_map<int, ScriptBuildStatus> _buildStatus;
+    std::unordered_set<int> _editedScripts;   ///< Snapshotted once at the end of the frame
+    uint64_t _nextBuildVersion = 0;
+    std::vector<ScriptBuildResult> _buildResults;   ///< Reused by collectBuildResults
+    std::shared_ptr<livelink::LiveLinkClient> _liveLink;   ///< Running game that receives fresh builds
+    
+    scripting::ScriptProfile _profile;        ///< Last runtime profile loaded, shown as a heat map
+    std::unordered_map<int, scripting::NodeCounters> _profileCosts;  ///< Counters of _profileObjectId, by block ID
+    int _profileObjectId = -1;
+    size_t _profileSharedBy = 0;              ///< Objects _profileCosts is summed over
     int _nextBlockId = 1;
     int _nextCanvasOrder = 0;
     
@@ -385,6 +422,8 @@ private:
     
     Vector2 _canvasOffset = {0, 0};
     float _canvasZoom = 1.0f;
+    const float _minCanvasZoom = 0.1f;
+    const float _maxCanvasZoom = 2.0f;
     Rectangle _canvasBounds = {0, 0, 0, 0};
     
     bool _isMouseDragging = false;
@@ -405,7 +444,15 @@ private:
     ScriptBlock* _configuredBlock = nullptr;
     
     ScriptBlock* _selectedBlock = nullptr;
-    ScriptBlock* _hoveredBlock = nullptr;
+    int _hoveredBlockId = -1;
+    
+    CanvasSpatialIndex _canvasIndex;          ///< Block bounds of the script shown on the canvas
+    int _canvasIndexObjectId = -1;            ///< Object whose script _canvasIndex describes
+    uint64_t _canvasIndexRevision = 0;        ///< VisualScript revision _canvasIndex was built from
+    std::vector<int> _visibleBlockIds;        ///< Reused by drawScriptCanvas
+    ConnectionRenderer _connectionRenderer;   ///< Cached curves of the displayed script
+    BlockTextureCache _blockTextureCache;     ///< Pre-rendered static blocks, used at zoom <= 1
+    bool _cacheStaticBlocks = true;           ///< Draw unchanged full-detail blocks from _blockTextureCache
     
     struct ContextMenuItem {
         std::string id;
@@ -470,7 +517,11 @@ private:
     void drawSceneObjectPanel(Rectangle bounds);
     void drawCanvasGrid(Rectangle bounds);
     void drawCanvasOverlay(Rectangle bounds);
-    void drawProfessionalBlock(const ScriptBlock& block, Vector2 offset = {0, 0});
+    void drawOptimizationReport(const scripting::OptimizationReport& report, Rectangle canvasArea);
+    void drawCanvasBlocks(const VisualScript& script, bool useTextureCache);
+    void prepareBlockTextures(const VisualScript& script);
+    void drawProfessionalBlock(const ScriptBlock& block, Vector2 offset = {0, 0}, BlockDetail detail = BlockDetail::FULL);
+    void drawSimplifiedBlock(const ScriptBlock& block, BlockDetail detail);
     void drawBlockHeader(const ScriptBlock& block, Rectangle headerRect, Vector2 offset = {0, 0});
     void drawBlockBody(const ScriptBlock& block, Rectangle bodyRect, Vector2 offset = {0, 0});
     void drawBlockPorts(const ScriptBlock& block, Vector2 offset = {0, 0});
@@ -501,6 +552,15 @@ private:
     void addBlockToCanvas(BlockType type, Vector2 position);
     void removeBlockFromCanvas(int blockId);
     VisualScript& getCurrentScript();
+    
+    /**
+     * @brief Editable script of an object, or nullptr if it has none
+     *
+     * Switching to another object's script drops the previous private copy,
+     * so block pointers held by the canvas are reset first.
+     */
+    VisualScript* findScript(int objectId);
+    void resetCanvasState();
     std::string getBlockLabel(BlockType type) const;
     Color getBlockColor(BlockType type) const;
     Vector2 getNextCanvasPosition();
@@ -513,12 +573,17 @@ private:
     void resetDragState();
     
     ScriptBlock* getCanvasBlockAtPosition(Vector2 pos);
+    CanvasSpatialIndex& syncCanvasIndex(int objectId, const VisualScript& script);
+    static Rectangle getBlockBounds(const ScriptBlock& block);
     BlockType getPaletteBlockTypeAtPosition(Vector2 pos);
     bool isPointInBlock(Vector2 point, const ScriptBlock& block, Vector2 offset = {0, 0});
     bool isPositionInCanvas(Vector2 pos);
     bool isPositionInPalette(Vector2 pos);
     Rectangle getPaletteBounds();
     void updateCanvasBounds(Rectangle mainViewArea);
+    void zoomCanvas(Vector2 anchor, float wheelSteps);
+    Vector2 screenToCanvas(Vector2 screenPos) const;
+    Camera2D getCanvasCamera() const;
     
     void openConfigDialog(ScriptBlock* block);
     void closeConfigDialog();
@@ -544,8 +609,7 @@ private:
     bool createConnection(ScriptBlock* fromBlock, int fromPortIndex, ScriptBlock* toBlock, int toPortIndex);
     void removeConnection(int fromBlockId, int toBlockId, int fromPortIndex = -1, int toPortIndex = -1);
     void removeAllConnectionsForBlock(int blockId);
-    void drawConnections(const VisualScript& script);
-    void drawConnectionLine(Vector2 start, Vector2 end, Color color, float thickness = 3.0f);
+    void drawConnections(const VisualScript& script, Rectangle visibleArea);
     void drawConnectionPreview();
     bool isConnectionValid(ScriptBlock* fromBlock, int fromPortIndex, ScriptBlock* toBlock, int toPortIndex);
     ConnectionPoint* getConnectionPointAt(Vector2 position, ScriptBlock** outBlock, int* outPortIndex);
@@ -554,6 +618,21 @@ private:
     
     CompiledScript compileScript(int objectId);
     bool validateScript(int objectId, std::string& errors);
+    
+    /**
+     * @brief Queue an object's script for background validation and compilation
+     */
+    void markScriptEdited(int objectId);
+    void submitEditedScripts();
+    void collectBuildResults();
+    void pushToLiveLink(int objectId, const CompiledScript& compiled);
+    const ScriptBuildStatus* findBuildStatus(int objectId) const;
+    void drawBuildAnnotations(const VisualScript& script);
+    void drawBuildStatus(int objectId, Rectangle canvasArea);
+    
+    bool loadProfileFromFile(const std::string& filepath);
+    void drawProfileHeatMap(const VisualScript& script);
+    void drawProfileLegend(Rectangle canvasArea);
     void exportCompiledScripts(const std::string& filePath);
     
     void selectBlock(ScriptBlock* block);
@@ -566,9 +645,9 @@ private:
     void saveCurrentScript();
     void saveScriptToFile(const VisualScript& script, const std::string& filepath);
     void loadScriptFromFile(const std::string& filepath);
+    void loadScriptsFromDirectory(const std::string& directory);
+    void registerLoadedScript(VisualScript&& script);
     void clearAllScripts();
-    std::string scriptToJson(const VisualScript& script);
-    VisualScript jsonToScript(const std::string& jsonContent);
     bool createDirectoryIfNotExists(const std::string& path);
     std::string getScriptsDirectory();
 };
\ No newline at end of file
@@ -19,6 +19,10 @@ MainUI::MainUI(std::shared_ptr<Render::Camera> camera, std::shared_ptr<Render::W
     _loader = std::make_shared<AssetLoader>();
     _3DMapEditor.setLoader(_loader);
     _uiManager.setLoader(_loader);
+
+    _liveLink = std::make_shared<livelink::LiveLinkClient>();
+    _3DMapEditor.setLiveLink(_liveLink);
+    _scriptingEditor.setLiveLink(_liveLink);
     //temporary cube asset loading for the 3D map, to change after libraries are implemented
     initMapEditorAssets();
     
@@ -57,6 +61,11 @@ void MainUI::update(input::IHandlerBase &inputHandler) {
     _loader->updateAssets("ressources/loadedAssets");
     _3DMapEditor.setLoader(_loader);
     _uiManager.setLoader(_loader);
+    _liveLink->update();
+    _3DMapEditor.getExportJob().update();
+    if (IsKeyPressed(KEY_F5)) {
+        togglePlayMode();
+    }
     
     // Update current editor
     switch (_currentEditor) {
@@ -106,6 +115,10 @@ void MainUI::loop(input::IHandlerBase &inputHandler) {
 }
 
 void MainUI::setCurrentEditor(EditorType editorType) {
+    // Scripts are edited against the map as it was built, not as it is being played
+    if (editorType != MAP) {
+        stopPlay();
+    }
     _currentEditor = editorType;
     std::cout << "[MainUI] Switched to editor type: " << editorType << std::endl;
 }
@@ -114,6 +127,23 @@ EditorType MainUI::getCurrentEditor() const {
     return _currentEditor;
 }
 
+void MainUI::togglePlayMode() {
+    if (_3DMapEditor.isPlaying()) {
+        stopPlay();
+        return;
+    }
+    setCurrentEditor(MAP);
+    _3DMapEditor.startPlay(_scriptingEditor.getCompiledScripts(), _scriptingEditor.getProfilePath());
+}
+
+void MainUI::stopPlay() {
+    if (!_3DMapEditor.isPlaying()) {
+        return;
+    }
+    _3DMapEditor.stopPlay();
+    _scriptingEditor.reloadProfile();
+}
+
 void MainUI::setupEventHandlers() {
     // Subscribe to editor mode change events from the UI
     UI::g_eventDispatcher.subscribe(UI::EditorEventType::EDITOR_MODE_CHANGED, 
@@ -135,5 +165,10 @@ void MainUI::setupEventHandlers() {
             }
         });
     
+    UI::g_eventDispatcher.subscribe(UI::EditorEventType::PLAY_MODE_TOGGLED,
+        [this](const UI::EditorEvent& event) {
+            togglePlayMode();
+        });
+    
     std::cout << "[MainUI] Event handlers set up" << std::endl;
 }
@@ -110,6 +110,14 @@ class MainUI {
          */
         EditorType getCurrentEditor() const;
 
+        /**
+         * @brief Start or stop playing the map in the map editor viewport
+         * 
+         * Starting shows the map editor and runs the scripting editor's
+         * compiled scripts. Bound to F5 and Render > Play.
+         */
+        void togglePlayMode();
+
     protected:
         std::shared_ptr<Render::Camera> _camera;              ///< Main 3D camera for scene rendering
         std::shared_ptr<Render::Window> _window;              ///< Application window manager
@@ -118,8 +126,13 @@ class MainUI {
         std::string _gameProjectName;        ///< Name of the current game project
         UI::UIManager _uiManager;            ///< UI manager for all interface elements
         std::shared_ptr<AssetLoader> _loader; ///< Asset loader for managing game assets
+        std::shared_ptr<livelink::LiveLinkClient> _liveLink; ///< Pushes edits into a running game
         EditorType _currentEditor;           ///< Current active editor type
     private:
         void initMapEditorAssets();
         void setupEventHandlers();
+        /**
+         * @brief Stop playing and show the run's profile in the scripting editor
+         */
+        void stopPlay();
 };
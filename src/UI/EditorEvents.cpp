@@ -65,6 +65,10 @@ namespace Events {
         g_eventDispatcher.dispatch(EditorEvent(EditorEventType::EDITOR_MODE_CHANGED, modeIndex, "Editor mode changed"));
     }
     
+    void playModeToggled() {
+        g_eventDispatcher.dispatch(EditorEvent(EditorEventType::PLAY_MODE_TOGGLED, 0, "Play mode toggled"));
+    }
+    
     void assetSelected(std::shared_ptr<AAsset> asset) {
         g_eventDispatcher.dispatch(EditorEvent(EditorEventType::ASSET_SELECTED, asset, "Asset selected"));
     }
@@ -59,6 +59,7 @@ enum class EditorEventType {
     
     // Editor mode events
     EDITOR_MODE_CHANGED, ///< Editor mode has changed (MAP_EDITOR/SCRIPTING)
+    PLAY_MODE_TOGGLED,   ///< Playing the map in the viewport was started or stopped
     
     // Asset events
     ASSET_SELECTED,      ///< An asset has been selected in the browser
@@ -307,6 +308,11 @@ namespace Events {
      */
     void editorModeChanged(int modeIndex);
     
+    /**
+     * @brief Dispatch a play mode toggle request
+     */
+    void playModeToggled();
+    
     /**
      * @brief Dispatch an asset selected event
      * 
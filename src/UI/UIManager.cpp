@@ -134,6 +134,7 @@ void UIManager::draw(MapEditor &mapEditor)
         _currentSceneProvider = &mapEditor;
         refreshSceneObjects();
     }
+    _exportJob = &mapEditor.getExportJob();
     
     // Draw UI components
     drawLeftToolbar();
@@ -217,7 +218,7 @@ void UIManager::drawTopMenuBar()
     
     // Render submenu
     if (_renderMenuOpen) {
-        const char* renderItems[4] = {"Preview", "Grid On/Off", "Shadows", "Quality"};
+        const char* renderItems[4] = {"Play/Stop (F5)", "Grid On/Off", "Shadows", "Quality"};
         int renderItemSelected = Submenu({renderRect.x, renderRect.y + renderRect.height, 120.0f, 100.0f}, renderItems, 4);
         
         // Handle render menu selection
@@ -502,6 +503,7 @@ void UIManager::drawBottomAssetsBar()
 
     if (CheckCollisionPointRec(GetMousePosition(), buttonRect3D) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         _show3DAssets = true;
+        _showBuildLog = false;
         std::cout << "Assets 3D button clicked!" << std::endl;
         // UI::Events::assetSelected(0);
     }
@@ -514,6 +516,7 @@ void UIManager::drawBottomAssetsBar()
 
     if (CheckCollisionPointRec(GetMousePosition(), buttonRect2D) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         _show3DAssets = false;
+        _showBuildLog = false;
         std::cout << "Assets 2D button clicked!" << std::endl;
         // UI::Events::assetSelected(0);
     }
@@ -529,12 +532,65 @@ void UIManager::drawBottomAssetsBar()
         openAssetWindow();
     }
 
-    if (_show3DAssets)
+    Rectangle buttonRectBuild = {175, static_cast<float>(barY), 65, 30};
+    Color buttonColorBuild = CheckCollisionPointRec(GetMousePosition(), buttonRectBuild) ? UI_TEXT_SECONDARY : UI_TEXT_PRIMARY;
+
+    DrawRectangleRec(buttonRectBuild, _showBuildLog ? UI_TERTIARY : UI_SECONDARY);
+    DrawText("Build", 192, static_cast<int>(barY + 10), 10, buttonColorBuild);
+
+    if (CheckCollisionPointRec(GetMousePosition(), buttonRectBuild) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        _showBuildLog = true;
+    }
+
+    if (_showBuildLog)
+        drawBottomBuildLog(barY);
+    else if (_show3DAssets)
         drawBottomAssets3D(barY);
     else
         drawBottomAssets2D(barY);
 }
 
+void UIManager::drawBottomBuildLog(int barY)
+{
+    const int lineHeight = 12;
+    const float padding = UI_PADDING_MEDIUM;
+    float top = barY + 30 + padding;
+
+    if (!_exportJob || _exportJob->getState() == GameExportJob::State::IDLE) {
+        DrawText("No export yet: use File > Export", static_cast<int>(padding), static_cast<int>(top), UI_FONT_SIZE_SMALL, UI_TEXT_TERTIARY);
+        return;
+    }
+
+    // Status, progress bar and cancel button on the first row
+    Color statusColor = UI_TEXT_PRIMARY;
+    if (_exportJob->getState() == GameExportJob::State::SUCCEEDED)
+        statusColor = SUCCESS;
+    else if (_exportJob->getState() == GameExportJob::State::FAILED)
+        statusColor = ERROR;
+    else if (_exportJob->getState() == GameExportJob::State::CANCELLED)
+        statusColor = WARNING;
+    DrawText(_exportJob->getStatus().c_str(), static_cast<int>(padding), static_cast<int>(top), UI_FONT_SIZE_SMALL, statusColor);
+
+    Rectangle progressBounds = {260, top, static_cast<float>(_screenWidth) - 260 - 100 - 2 * padding, 10};
+    DrawRectangleRec(progressBounds, UI_PRIMARY);
+    DrawRectangleRec({progressBounds.x, progressBounds.y, progressBounds.width * _exportJob->getProgress(), progressBounds.height}, ACCENT_PRIMARY);
+
+    if (_exportJob->isRunning()) {
+        Rectangle cancelBounds = {static_cast<float>(_screenWidth) - 100 - padding, top - 4, 100, 18};
+        if (CustomButton(cancelBounds, "Cancel", UI_SECONDARY, HOVER_BACKGROUND, ACCENT_DANGER))
+            _exportJob->cancel();
+    }
+
+    // Latest output lines, newest at the bottom
+    const std::deque<std::string>& log = _exportJob->getLog();
+    float logTop = top + lineHeight + padding;
+    size_t visible = static_cast<size_t>((_screenHeight - logTop - padding) / lineHeight);
+    size_t first = log.size() > visible ? log.size() - visible : 0;
+    for (size_t i = first; i < log.size(); i++) {
+        DrawText(log[i].c_str(), static_cast<int>(padding), static_cast<int>(logTop + (i - first) * lineHeight), UI_FONT_SIZE_SMALL, UI_TEXT_TERTIARY);
+    }
+}
+
 void UIManager::drawBottomAssets2D(int barY)
 {
     int assetSize = 80;
@@ -882,6 +938,7 @@ void UIManager::handleFileMenuAction(int selectedItem)
             break;
         case 3: // Export
             Events::fileAction(EditorEventType::FILE_EXPORT);
+            _showBuildLog = true;
             break;
         case 4: // Exit
             // Handle exit
@@ -918,8 +975,8 @@ void UIManager::handleEditMenuAction(int selectedItem)
 void UIManager::handleRenderMenuAction(int selectedItem)
 {
     switch (selectedItem) {
-        case 0: // Preview
-            // Toggle preview mode
+        case 0: // Play/Stop
+            Events::playModeToggled();
             break;
         case 1: // Grid On/Off
             Events::gridToggled(true); // Would track actual state
@@ -212,6 +212,14 @@ public:
      * Handles asset selection and loading.
      */
     void drawBottomAssets3D(int barY);
+
+    /**
+     * @brief Draw the build log of the current export
+     * 
+     * Shows the latest build output, the export progress and a button
+     * cancelling the export while it runs.
+     */
+    void drawBottomBuildLog(int barY);
     
     /**
      * @brief Draw the asset 3D preview
@@ -389,6 +397,8 @@ private:
     std::vector<RenderTexture2D> _toolIconRenderTextures; ///< Tool icon render textures
     
     bool _show3DAssets;
+    bool _showBuildLog = false;            ///< Bottom bar shows the build log instead of assets
+    GameExportJob* _exportJob = nullptr;   ///< Export of the map editor, shown in the build log
 
     std::shared_ptr<AssetLoader> _loader;
 
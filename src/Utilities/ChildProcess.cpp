@@ -0,0 +1,219 @@
+/**
+ * @file ChildProcess.cpp
+ * @brief Implementation of the non-blocking child processes
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#include "ChildProcess.hpp"
+
+#include <iostream>
+
+#ifndef _WIN32
+    #include <cerrno>
+    #include <csignal>
+    #include <fcntl.h>
+    #include <sys/wait.h>
+    #include <thread>
+    #include <unistd.h>
+#endif
+
+#ifndef _WIN32
+namespace {
+
+constexpr std::chrono::milliseconds STOP_POLL_INTERVAL{10};
+
+/**
+ * @brief Build a NULL-terminated argv; done before fork(), as the child of a
+ *        threaded process must not allocate
+ */
+std::vector<char*> makeArgv(const std::vector<std::string>& args) {
+    std::vector<char*> argv;
+    for (const std::string& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argv.push_back(nullptr);
+    return argv;
+}
+
+/**
+ * @brief Replace the current (forked) process with the command; never returns
+ */
+[[noreturn]] void execCommand(char* const* argv, const std::string& workingDir) {
+    if (!workingDir.empty() && chdir(workingDir.c_str()) == -1) {
+        _exit(127);
+    }
+    execvp(argv[0], argv);
+    _exit(127);
+}
+
+}
+#endif
+
+ChildProcess::~ChildProcess() {
+    stop();
+}
+
+#ifndef _WIN32
+bool ChildProcess::start(const std::vector<std::string>& args, const std::string& workingDir) {
+    if (args.empty() || isRunning()) {
+        return false;
+    }
+
+    std::vector<char*> argv = makeArgv(args);
+    int pipeFds[2];
+    if (pipe(pipeFds) == -1) {
+        return false;
+    }
+
+    pid_t pid = fork();
+    if (pid == -1) {
+        close(pipeFds[0]);
+        close(pipeFds[1]);
+        return false;
+    }
+    if (pid == 0) {
+        setpgid(0, 0);
+        dup2(pipeFds[1], STDOUT_FILENO);
+        dup2(pipeFds[1], STDERR_FILENO);
+        close(pipeFds[0]);
+        close(pipeFds[1]);
+        execCommand(argv.data(), workingDir);
+    }
+
+    // Also set from the parent, so terminate() cannot race the child's setpgid
+    setpgid(pid, pid);
+    close(pipeFds[1]);
+    fcntl(pipeFds[0], F_SETFL, fcntl(pipeFds[0], F_GETFL, 0) | O_NONBLOCK);
+    fcntl(pipeFds[0], F_SETFD, FD_CLOEXEC);
+    _pid = pid;
+    _outputFd = pipeFds[0];
+    _terminating = false;
+    _killed = false;
+    return true;
+}
+
+size_t ChildProcess::readOutput(std::string& out) {
+    size_t total = 0;
+    char buffer[4096];
+
+    while (_outputFd != -1) {
+        ssize_t count = read(_outputFd, buffer, sizeof(buffer));
+        if (count > 0) {
+            out.append(buffer, static_cast<size_t>(count));
+            total += static_cast<size_t>(count);
+            continue;
+        }
+        if (count == -1 && errno == EINTR) {
+            continue;
+        }
+        if (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            closeOutput();
+        }
+        break;
+    }
+    return total;
+}
+
+bool ChildProcess::poll(int& exitCode) {
+    if (_pid == -1) {
+        return false;
+    }
+
+    int status = 0;
+    if (waitpid(_pid, &status, WNOHANG) != _pid) {
+        if (_terminating && !_killed && std::chrono::steady_clock::now() >= _killDeadline) {
+            kill(-_pid, SIGKILL);
+            _killed = true;
+        }
+        return false;
+    }
+    _pid = -1;
+    _terminating = false;
+    exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    return true;
+}
+
+void ChildProcess::terminate(std::chrono::milliseconds grace) {
+    if (_pid == -1 || _terminating) {
+        return;
+    }
+    // SIGTERM lets make delete half-written objects; poll() escalates if the group lingers
+    kill(-_pid, SIGTERM);
+    _terminating = true;
+    _killDeadline = std::chrono::steady_clock::now() + grace;
+}
+
+void ChildProcess::stop() {
+    int exitCode = 0;
+
+    terminate();
+    while (_pid != -1 && !poll(exitCode)) {
+        std::this_thread::sleep_for(STOP_POLL_INTERVAL);
+    }
+    closeOutput();
+}
+
+void ChildProcess::closeOutput() {
+    if (_outputFd != -1) {
+        close(_outputFd);
+        _outputFd = -1;
+    }
+}
+
+bool ChildProcess::launchDetached(const std::vector<std::string>& args, const std::string& workingDir) {
+    if (args.empty()) {
+        return false;
+    }
+
+    // Double fork: the game is reparented to init and never becomes a zombie of the editor
+    std::vector<char*> argv = makeArgv(args);
+    pid_t pid = fork();
+    if (pid == -1) {
+        return false;
+    }
+    if (pid == 0) {
+        setsid();
+        if (fork() != 0) {
+            _exit(0);
+        }
+        int devNull = open("/dev/null", O_RDONLY);
+        if (devNull != -1) {
+            dup2(devNull, STDIN_FILENO);
+            close(devNull);
+        }
+        execCommand(argv.data(), workingDir);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+#else
+bool ChildProcess::start(const std::vector<std::string>&, const std::string&) {
+    std::cerr << "[ChildProcess] Not available on this platform" << std::endl;
+    return false;
+}
+
+size_t ChildProcess::readOutput(std::string&) {
+    return 0;
+}
+
+bool ChildProcess::poll(int&) {
+    return false;
+}
+
+void ChildProcess::terminate(std::chrono::milliseconds) {
+}
+
+void ChildProcess::stop() {
+}
+
+void ChildProcess::closeOutput() {
+}
+
+bool ChildProcess::launchDetached(const std::vector<std::string>&, const std::string&) {
+    std::cerr << "[ChildProcess] Not available on this platform" << std::endl;
+    return false;
+}
+#endif
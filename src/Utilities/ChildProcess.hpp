@@ -0,0 +1,78 @@
+/**
+ * @file ChildProcess.hpp
+ * @brief Non-blocking child processes for builds and game launches
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A command run in its own process group, with its output captured
+ *
+ * stdout and stderr are merged into one non-blocking pipe that the editor
+ * drains once per frame. The child leads a new process group, so
+ * terminate() also stops everything it spawned (CMake, the compiler, ...).
+ */
+class ChildProcess {
+public:
+    static constexpr std::chrono::milliseconds TERMINATE_GRACE{2000};  ///< Before SIGTERM escalates to SIGKILL
+
+    ChildProcess() = default;
+    ~ChildProcess();
+
+    ChildProcess(const ChildProcess&) = delete;
+    ChildProcess& operator=(const ChildProcess&) = delete;
+
+    /**
+     * @param args Program and its arguments, looked up in PATH
+     * @param workingDir Directory to run in, empty for the editor's own
+     */
+    bool start(const std::vector<std::string>& args, const std::string& workingDir = "");
+
+    /**
+     * @brief Append whatever output is available without waiting
+     * @return Number of bytes read
+     */
+    size_t readOutput(std::string& out);
+
+    /**
+     * @brief Check whether the process has exited, reaping it if so
+     *
+     * Once a terminate() grace period is over, the group still running is killed.
+     * @param exitCode Receives the exit status, or -1 if it was killed by a signal
+     */
+    bool poll(int& exitCode);
+
+    /**
+     * @brief Ask the process group to stop, without waiting for it
+     *
+     * Sends SIGTERM; poll() reaps the process and escalates to SIGKILL
+     * after grace. Only the destructor waits.
+     */
+    void terminate(std::chrono::milliseconds grace = TERMINATE_GRACE);
+    bool isRunning() const { return _pid != -1; }
+    bool isTerminating() const { return _terminating; }
+
+    /**
+     * @brief Start a process the editor does not wait for or keep track of
+     */
+    static bool launchDetached(const std::vector<std::string>& args, const std::string& workingDir = "");
+
+private:
+    void closeOutput();
+    /**
+     * @brief Stop the process group and reap it, blocking up to the grace period
+     */
+    void stop();
+
+    int _pid = -1;
+    int _outputFd = -1;
+    bool _terminating = false;
+    bool _killed = false;
+    std::chrono::steady_clock::time_point _killDeadline;
+};
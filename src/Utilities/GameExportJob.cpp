@@ -0,0 +1,238 @@
+/**
+ * @file GameExportJob.cpp
+ * @brief Implementation of the background game export
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#include "GameExportJob.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+constexpr float BUILD_SHARE = 0.9f;   ///< Part of the progress bar covered by the player build
+
+template <typename T>
+bool isReady(const std::future<T>& future) {
+    return future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+}
+
+GameExportJob::~GameExportJob() {
+    // Let the worker threads finish before the exporter they use goes away
+    if (_hashing.valid()) {
+        _hashing.wait();
+    }
+    if (_cooking.valid()) {
+        _cooking.wait();
+    }
+}
+
+bool GameExportJob::start(const std::string& projectDir, std::vector<std::string> assetPaths, bool launch) {
+    if (isRunning()) {
+        return false;
+    }
+
+    _log.clear();
+    _partialLine.clear();
+    _exporter = std::make_unique<GameExporter>(projectDir);
+    _assetPaths = std::move(assetPaths);
+    _launch = launch;
+    _cancelRequested = false;
+    _progress = 0.0f;
+
+    GameExporter* exporter = _exporter.get();
+    _hashing = std::async(std::launch::async, [exporter] { return exporter->computeEngineHash(); });
+    _state = State::HASHING;
+    _status = "Checking engine sources";
+    appendLine("Exporting " + projectDir);
+    return true;
+}
+
+void GameExportJob::update() {
+    switch (_state) {
+        case State::HASHING: {
+            if (!isReady(_hashing)) {
+                return;
+            }
+            _engineHash = _hashing.get();
+            if (_cancelRequested) {
+                finish(State::CANCELLED, "Export cancelled");
+                return;
+            }
+            if (_exporter->isPlayerBuiltFrom(_engineHash)) {
+                appendLine("Engine unchanged, reusing the built player");
+                startCooking();
+                return;
+            }
+            // A cancelled or failed build must not leave the old stamp behind
+            _exporter->clearEngineStamp();
+            if (!_build.start(_exporter->getBuildCommand())) {
+                finish(State::FAILED, "Could not start the player build");
+                return;
+            }
+            _state = State::BUILDING;
+            _status = "Building the player";
+            appendLine("Engine sources changed, building the player");
+            break;
+        }
+        case State::BUILDING: {
+            std::string output;
+            _build.readOutput(output);
+            appendOutput(output);
+
+            // Also kills the build once a cancel's grace period is over
+            int exitCode = 0;
+            if (!_build.poll(exitCode)) {
+                return;
+            }
+            output.clear();
+            _build.readOutput(output);
+            appendOutput(output + "\n");
+            if (_cancelRequested) {
+                _exporter->clearEngineStamp();
+                finish(State::CANCELLED, "Build cancelled");
+                return;
+            }
+            if (exitCode != 0 || !_exporter->stampEngine(_engineHash) || !_exporter->isPlayerBuiltFrom(_engineHash)) {
+                _exporter->clearEngineStamp();
+                finish(State::FAILED, "Player build failed (exit code " + std::to_string(exitCode) + ")");
+                return;
+            }
+            startCooking();
+            break;
+        }
+        case State::COOKING: {
+            if (!isReady(_cooking)) {
+                return;
+            }
+            ExportReport report = _cooking.get();
+            if (_cancelRequested) {
+                finish(State::CANCELLED, "Export cancelled");
+                return;
+            }
+            if (!report.success) {
+                finish(State::FAILED, report.error);
+                return;
+            }
+            appendLine("Content: " + std::to_string(report.filesCopied) + " copied, " +
+                std::to_string(report.filesUnchanged) + " unchanged, " + std::to_string(report.filesRemoved) + " removed");
+            if (_launch) {
+                if (!ChildProcess::launchDetached(_exporter->getLaunchCommand())) {
+                    finish(State::FAILED, "Could not launch the game");
+                    return;
+                }
+                appendLine("Game launched");
+            }
+            finish(State::SUCCEEDED, "Export done");
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void GameExportJob::cancel() {
+    switch (_state) {
+        case State::BUILDING:
+            // Reported by update() once the build has exited
+            _build.terminate();
+            _cancelRequested = true;
+            _status = "Cancelling";
+            break;
+        case State::HASHING:
+        case State::COOKING:
+            // Worker steps are short: their result is dropped when it arrives
+            _cancelRequested = true;
+            _status = "Cancelling";
+            break;
+        default:
+            break;
+    }
+}
+
+bool GameExportJob::isRunning() const {
+    return _state == State::HASHING || _state == State::BUILDING || _state == State::COOKING;
+}
+
+float GameExportJob::parseBuildProgress(const std::string& line) {
+    size_t open = line.find_first_not_of(" \t");
+    if (open == std::string::npos || line[open] != '[') {
+        return -1.0f;
+    }
+
+    size_t pos = line.find_first_not_of(' ', open + 1);
+    size_t digits = pos;
+    while (digits < line.size() && std::isdigit(static_cast<unsigned char>(line[digits]))) {
+        digits++;
+    }
+    if (pos == std::string::npos || digits == pos || digits - pos > 9 || digits >= line.size()) {
+        return -1.0f;
+    }
+
+    int value = std::stoi(line.substr(pos, digits - pos));
+    if (line.compare(digits, 2, "%]") == 0) {
+        return std::min(value, 100) / 100.0f;
+    }
+    if (line[digits] == '/') {
+        size_t totalEnd = digits + 1;
+        while (totalEnd < line.size() && std::isdigit(static_cast<unsigned char>(line[totalEnd]))) {
+            totalEnd++;
+        }
+        if (totalEnd == digits + 1 || totalEnd - digits > 10 || totalEnd >= line.size() || line[totalEnd] != ']') {
+            return -1.0f;
+        }
+        int total = std::stoi(line.substr(digits + 1, totalEnd - digits - 1));
+        return total > 0 ? std::min(value, total) / static_cast<float>(total) : -1.0f;
+    }
+    return -1.0f;
+}
+
+void GameExportJob::startCooking() {
+    GameExporter* exporter = _exporter.get();
+    std::vector<std::string> assetPaths = _assetPaths;
+
+    _cooking = std::async(std::launch::async, [exporter, assetPaths] { return exporter->cookContent(assetPaths); });
+    _state = State::COOKING;
+    _status = "Copying content";
+    _progress = BUILD_SHARE;
+}
+
+void GameExportJob::finish(State state, const std::string& status) {
+    _state = state;
+    _status = status;
+    if (state == State::SUCCEEDED) {
+        _progress = 1.0f;
+    }
+    appendLine(status);
+}
+
+void GameExportJob::appendOutput(const std::string& output) {
+    for (char c : output) {
+        if (c != '\n' && c != '\r') {
+            _partialLine += c;
+            continue;
+        }
+        if (!_partialLine.empty()) {
+            appendLine(_partialLine);
+            float progress = parseBuildProgress(_partialLine);
+            if (progress >= 0.0f) {
+                _progress = progress * BUILD_SHARE;
+            }
+            _partialLine.clear();
+        }
+    }
+}
+
+void GameExportJob::appendLine(const std::string& line) {
+    std::cout << "[GameExportJob] " << line << std::endl;
+    _log.push_back(line);
+    if (_log.size() > MAX_LOG_LINES) {
+        _log.pop_front();
+    }
+}
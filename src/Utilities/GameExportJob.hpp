@@ -0,0 +1,91 @@
+/**
+ * @file GameExportJob.hpp
+ * @brief Export, build and launch of the game without blocking the editor
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#pragma once
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ChildProcess.hpp"
+#include "GameExporter.hpp"
+
+/**
+ * @brief Drives one export at a time, advanced by update() once per frame
+ *
+ * Hashing and content copies run on worker threads and the player build
+ * runs as a child process whose output is streamed into the log, so the
+ * editor keeps rendering. The build can be cancelled without waiting for
+ * it to stop; a successful export launches the game detached from the editor.
+ */
+class GameExportJob {
+public:
+    enum class State {
+        IDLE,
+        HASHING,    ///< Hashing the engine sources
+        BUILDING,   ///< Compiling the player
+        COOKING,    ///< Copying changed content
+        SUCCEEDED,
+        FAILED,
+        CANCELLED
+    };
+
+    static constexpr size_t MAX_LOG_LINES = 500;
+
+    GameExportJob() = default;
+    ~GameExportJob();
+
+    GameExportJob(const GameExportJob&) = delete;
+    GameExportJob& operator=(const GameExportJob&) = delete;
+
+    /**
+     * @param projectDir Game project directory
+     * @param assetPaths Files referenced by the map
+     * @param launch Start the game once the export succeeds
+     */
+    bool start(const std::string& projectDir, std::vector<std::string> assetPaths, bool launch = true);
+    void update();
+    void cancel();
+
+    bool isRunning() const;
+    State getState() const { return _state; }
+    float getProgress() const { return _progress; }
+    const std::string& getStatus() const { return _status; }
+    const std::deque<std::string>& getLog() const { return _log; }
+
+    /**
+     * @brief Build progress announced by a line of CMake output
+     *
+     * Understands Makefile ("[ 45%] Building ...") and Ninja ("[12/96] ...") lines.
+     * @return Progress in [0, 1], or -1 if the line carries none
+     */
+    static float parseBuildProgress(const std::string& line);
+
+private:
+    void startCooking();
+    void finish(State state, const std::string& status);
+    void appendOutput(const std::string& output);
+    void appendLine(const std::string& line);
+
+    State _state = State::IDLE;
+    float _progress = 0.0f;
+    std::string _status;
+    std::deque<std::string> _log;
+    std::string _partialLine;   ///< Output after the last newline, waiting for the rest
+
+    std::unique_ptr<GameExporter> _exporter;
+    std::vector<std::string> _assetPaths;
+    bool _launch = true;
+    bool _cancelRequested = false;
+    uint64_t _engineHash = 0;
+
+    std::future<uint64_t> _hashing;
+    ChildProcess _build;
+    std::future<ExportReport> _cooking;
+};
@@ -0,0 +1,258 @@
+/**
+ * @file GameExporter.cpp
+ * @brief Implementation of the incremental game export
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#include "GameExporter.hpp"
+#include "Assets/ContentPath.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <unordered_set>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+
+bool isEngineSource(const fs::path& path) {
+    static const std::unordered_set<std::string> extensions = {".c", ".cpp", ".h", ".hpp", ".cmake"};
+    return path.filename() == "CMakeLists.txt" || extensions.count(path.extension().string());
+}
+
+bool isSkippedDirectory(const fs::path& path) {
+    // Build trees hold fetched dependencies, which are not engine sources
+    std::string name = path.filename().string();
+    return name == "build" || name.empty() || name[0] == '.' || name[0] == '_';
+}
+
+void collectEngineSources(const fs::path& root, std::vector<fs::path>& out) {
+    std::error_code ec;
+    if (fs::is_regular_file(root, ec)) {
+        out.push_back(root);
+        return;
+    }
+    if (!fs::is_directory(root, ec)) {
+        return;
+    }
+    for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        if (it->is_directory(ec)) {
+            if (isSkippedDirectory(it->path())) {
+                it.disable_recursion_pending();
+            }
+            continue;
+        }
+        if (isEngineSource(it->path())) {
+            out.push_back(it->path());
+        }
+    }
+}
+
+std::string toHex(uint64_t value) {
+    std::ostringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << value;
+    return stream.str();
+}
+
+}
+
+GameExporter::GameExporter(const std::string& projectDir, const std::string& engineDir)
+    : _projectDir(projectDir), _engineDir(engineDir) {
+}
+
+ExportReport GameExporter::cookContent(const std::vector<std::string>& assetPaths) {
+    auto start = std::chrono::steady_clock::now();
+    ExportReport report;
+    fs::path contentDir = _projectDir / CONTENT_DIRECTORY;
+    std::error_code ec;
+
+    loadManifest();
+    std::unordered_map<std::string, uint64_t> exported;
+    std::vector<fs::path> sources;
+    for (const std::string& assetPath : assetPaths) {
+        if (assetPath.empty()) {
+            continue;
+        }
+        sources.clear();
+        collectCompanions(assetPath, sources);
+        for (const fs::path& source : sources) {
+            std::string key = contentRelativePath(source.string()).generic_string();
+            if (key.empty() || exported.count(key)) {
+                continue;
+            }
+
+            uint64_t hash = 0;
+            if (!hashFile(source, hash)) {
+                std::cerr << "[GameExporter] Missing asset " << source.string() << std::endl;
+                continue;
+            }
+            exported[key] = hash;
+
+            fs::path destination = contentDir / key;
+            auto previous = _manifest.find(key);
+            if (previous != _manifest.end() && previous->second == hash && fs::exists(destination, ec)) {
+                report.filesUnchanged++;
+                continue;
+            }
+            fs::create_directories(destination.parent_path(), ec);
+            if (!fs::copy_file(source, destination, fs::copy_options::overwrite_existing, ec)) {
+                report.error = "Failed to copy " + source.string() + ": " + ec.message();
+                std::cerr << "[GameExporter] " << report.error << std::endl;
+                return report;
+            }
+            report.filesCopied++;
+        }
+    }
+
+    for (const auto& entry : _manifest) {
+        // The manifest is a plain file in the project, a key leading elsewhere is never followed
+        if (!exported.count(entry.first) && assets::isContentKey(entry.first) &&
+            fs::remove(contentDir / entry.first, ec)) {
+            report.filesRemoved++;
+        }
+    }
+    _manifest = std::move(exported);
+    if (!saveManifest()) {
+        report.error = "Failed to write the content manifest";
+        return report;
+    }
+
+    report.success = true;
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+bool GameExporter::isEngineUpToDate() const {
+    return isPlayerBuiltFrom(computeEngineHash());
+}
+
+bool GameExporter::isPlayerBuiltFrom(uint64_t engineHash) const {
+    std::error_code ec;
+    uint64_t stamped = 0;
+    std::ifstream stamp(_projectDir / ENGINE_STAMP_FILE);
+
+    return (stamp >> std::hex >> stamped) && stamped == engineHash && fs::exists(_projectDir / PLAYER_BINARY, ec);
+}
+
+uint64_t GameExporter::computeEngineHash() const {
+    std::vector<fs::path> sources;
+    collectEngineSources(_projectDir / "src", sources);
+    collectEngineSources(_projectDir / "CMakeLists.txt", sources);
+    collectEngineSources(_engineDir, sources);
+    std::sort(sources.begin(), sources.end());
+
+    uint64_t hash = FNV_OFFSET;
+    for (const fs::path& source : sources) {
+        // Renames and moves change the build as much as edits do
+        std::string name = source.generic_string();
+        hash = hashBytes(name.data(), name.size(), hash);
+        uint64_t contentHash = 0;
+        if (hashFile(source, contentHash)) {
+            hash = hashBytes(&contentHash, sizeof(contentHash), hash);
+        }
+    }
+    return hash;
+}
+
+fs::path GameExporter::contentRelativePath(const std::string& assetPath) {
+    return assets::contentKey(assetPath);
+}
+
+uint64_t GameExporter::hashBytes(const void* data, size_t size, uint64_t seed) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = seed;
+
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+bool GameExporter::hashFile(const fs::path& path, uint64_t& hash) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    char buffer[65536];
+    hash = FNV_OFFSET;
+    while (file) {
+        file.read(buffer, sizeof(buffer));
+        hash = hashBytes(buffer, static_cast<size_t>(file.gcount()), hash);
+    }
+    return !file.bad();
+}
+
+bool GameExporter::stampEngine(uint64_t engineHash) const {
+    std::ofstream stamp(_projectDir / ENGINE_STAMP_FILE);
+    stamp << toHex(engineHash) << "\n";
+    return stamp.good();
+}
+
+void GameExporter::clearEngineStamp() const {
+    std::error_code ec;
+    fs::remove(_projectDir / ENGINE_STAMP_FILE, ec);
+}
+
+std::vector<std::string> GameExporter::getBuildCommand() const {
+    // install-linux.sh expects to be started from the project's parent directory
+    return {"bash", (_projectDir / "install-linux.sh").string()};
+}
+
+std::vector<std::string> GameExporter::getLaunchCommand() const {
+    return {(fs::absolute(_projectDir) / PLAYER_BINARY).string()};
+}
+
+void GameExporter::loadManifest() {
+    _manifest.clear();
+    std::ifstream file(_projectDir / MANIFEST_FILE);
+    std::string line;
+
+    while (std::getline(file, line)) {
+        // "<hash> <path>", the path runs to the end of the line
+        size_t space = line.find(' ');
+        if (space == std::string::npos || space + 1 >= line.size()) {
+            continue;
+        }
+        _manifest[line.substr(space + 1)] = std::strtoull(line.substr(0, space).c_str(), nullptr, 16);
+    }
+}
+
+bool GameExporter::saveManifest() const {
+    std::error_code ec;
+    fs::create_directories((_projectDir / MANIFEST_FILE).parent_path(), ec);
+
+    std::vector<std::pair<std::string, uint64_t>> entries(_manifest.begin(), _manifest.end());
+    std::sort(entries.begin(), entries.end());
+    std::ofstream file(_projectDir / MANIFEST_FILE);
+    for (const auto& entry : entries) {
+        file << toHex(entry.second) << " " << entry.first << "\n";
+    }
+    return file.good();
+}
+
+void GameExporter::collectCompanions(const fs::path& asset, std::vector<fs::path>& out) {
+    out.push_back(asset);
+
+    // Models pull their material and textures from files sharing their stem
+    std::error_code ec;
+    fs::path directory = asset.parent_path().empty() ? fs::path(".") : asset.parent_path();
+    std::vector<fs::path> companions;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        const fs::path& path = entry.path();
+        if (entry.is_regular_file(ec) && path.stem() == asset.stem() && path.filename() != asset.filename()) {
+            companions.push_back(asset.parent_path() / path.filename());
+        }
+    }
+    std::sort(companions.begin(), companions.end());
+    out.insert(out.end(), companions.begin(), companions.end());
+}
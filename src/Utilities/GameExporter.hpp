@@ -0,0 +1,104 @@
+/**
+ * @file GameExporter.hpp
+ * @brief Incremental export of a project to the prebuilt game player
+ * @author IsoMaker Team
+ * @version 0.1
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Outcome of one export
+ */
+struct ExportReport {
+    bool success = false;
+    bool engineRebuilt = false;     ///< The player binary had to be compiled
+    size_t filesCopied = 0;
+    size_t filesUnchanged = 0;
+    size_t filesRemoved = 0;
+    double seconds = 0.0;
+    std::string error;
+};
+
+/**
+ * @brief Exports a project to the GenericGame player without rebuilding it
+ *
+ * The player is compiled once and then only loads data. Engine sources
+ * (the game project and the Graphical library) are hashed and the player
+ * is rebuilt only when that hash differs from the one stamped at its last
+ * build. Assets referenced by the map are copied into the player's
+ * content directory, keyed by their path in the map, and a manifest of
+ * content hashes lets later exports copy only what changed.
+ *
+ * The slow steps are exposed separately so GameExportJob can run them off
+ * the UI thread.
+ */
+class GameExporter {
+public:
+    static constexpr const char* CONTENT_DIRECTORY = "assets/content";
+    static constexpr const char* MANIFEST_FILE = "assets/content/manifest.txt";
+    static constexpr const char* ENGINE_STAMP_FILE = ".engine_hash";
+    static constexpr const char* PLAYER_BINARY = "GenericGame";
+
+    /**
+     * @param projectDir Game project directory, holding the player's sources and binary
+     * @param engineDir Directory of the engine library sources shared with the editor
+     */
+    explicit GameExporter(const std::string& projectDir, const std::string& engineDir = "libs");
+
+    /**
+     * @brief Copy the changed assets into the content directory and drop the stale ones
+     */
+    ExportReport cookContent(const std::vector<std::string>& assetPaths);
+
+    bool isEngineUpToDate() const;
+    uint64_t computeEngineHash() const;
+
+    /**
+     * @brief Whether the player binary exists and was stamped with this engine hash
+     */
+    bool isPlayerBuiltFrom(uint64_t engineHash) const;
+
+    /**
+     * @brief Record that the player was just built from this engine hash
+     */
+    bool stampEngine(uint64_t engineHash) const;
+    void clearEngineStamp() const;
+
+    /**
+     * @brief Command compiling the player, run from the editor's directory
+     */
+    std::vector<std::string> getBuildCommand() const;
+    std::vector<std::string> getLaunchCommand() const;
+
+    /**
+     * @brief Where the player looks for a map-referenced asset, relative to the content directory
+     *
+     * See assets::contentKey: leading ".." are kept under the content directory.
+     */
+    static std::filesystem::path contentRelativePath(const std::string& assetPath);
+
+    static uint64_t hashBytes(const void* data, size_t size, uint64_t seed = FNV_OFFSET);
+    static bool hashFile(const std::filesystem::path& path, uint64_t& hash);
+
+private:
+    static constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ull;
+
+    void loadManifest();
+    bool saveManifest() const;
+
+    /**
+     * @brief An asset plus the files loaded alongside it (materials, textures)
+     */
+    static void collectCompanions(const std::filesystem::path& asset, std::vector<std::filesystem::path>& out);
+
+    std::filesystem::path _projectDir;
+    std::filesystem::path _engineDir;
+    std::unordered_map<std::string, uint64_t> _manifest;   ///< Content-relative path -> hash
+};
@@ -60,6 +60,8 @@ Asset2D AssetLoader::loadAssetFile2D(std::ifstream& inFile)
     int frames = 0;
     int width = 0;
     int height = 0;
+    std::vector<AnimationClip> clips;
+    AnimationClip clip;
 
     while (std::getline(inFile, line)) {
         if (line.find("Name:") == 0) {
@@ -72,6 +74,11 @@ Asset2D AssetLoader::loadAssetFile2D(std::ifstream& inFile)
             sizeOrScaledSize = line.substr(line.find(":") + 2);
         } else if (line.find("Frames:") == 0) {
             frames = std::stoi(line.substr(8));
+        } else if (line.find("Clip:") == 0) {
+            if (AnimationSet::parseClip(line.substr(6), clip))
+                clips.push_back(clip);
+            else
+                std::cerr << "Invalid clip in asset file: " << line << std::endl;
         }
     }
     inFile.close();
@@ -86,6 +93,8 @@ Asset2D AssetLoader::loadAssetFile2D(std::ifstream& inFile)
     asset.setWidth(width);
     asset.setHeight(height);
     asset.setFramesCount(frames);
+    asset.setClips(clips);
+    asset.buildAnimations();
     asset.loadFile();
     std::cout << sizeOrScaledSize << std::endl;
     return asset;
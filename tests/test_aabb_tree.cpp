@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "Gameplay/AabbTree.hpp"
+#include "Gameplay/SpriteTree.hpp"
+
+namespace {
+
+BoundingBox boxAt(float x, float y, float z, float size = 0.5f) {
+    return {{x, y, z}, {x + size, y + size, z + size}};
+}
+
+bool overlap(const BoundingBox& a, const BoundingBox& b) {
+    return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y &&
+        a.min.z <= b.max.z && b.min.z <= a.max.z;
+}
+
+}
+
+TEST(AabbTreeTest, QueriesMatchBruteForceAfterMovesAndRemovals) {
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> coord(0.0f, 40.0f);
+    std::uniform_real_distribution<float> step(-0.5f, 0.5f);
+    gameplay::AabbTree tree(0.2f);
+    std::vector<BoundingBox> boxes;
+    std::vector<int> proxies;
+
+    for (int i = 0; i < 500; i++) {
+        boxes.push_back(boxAt(coord(random), coord(random) / 8.0f, coord(random)));
+        proxies.push_back(tree.insert(boxes.back(), i));
+    }
+    for (int frame = 0; frame < 20; frame++) {
+        for (int i = 0; i < 500; i++) {
+            if (proxies[i] == -1)
+                continue;
+            float dx = step(random);
+            float dz = step(random);
+            boxes[i] = {{boxes[i].min.x + dx, boxes[i].min.y, boxes[i].min.z + dz}, {boxes[i].max.x + dx, boxes[i].max.y, boxes[i].max.z + dz}};
+            tree.update(proxies[i], boxes[i]);
+        }
+        tree.remove(proxies[frame * 7]);
+        proxies[frame * 7] = -1;
+    }
+    EXPECT_EQ(tree.getProxyCount(), 480u);
+    EXPECT_LE(tree.getHeight(), 20);
+
+    BoundingBox area = boxAt(10, 0, 10, 8);
+    std::vector<int> found;
+    tree.queryBox(area, found);
+    std::vector<int> expected;
+    for (int i = 0; i < 500; i++) {
+        if (proxies[i] != -1 && overlap(boxes[i], area))
+            expected.push_back(i);
+    }
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(found, expected);
+
+    std::vector<std::pair<int, int>> pairs;
+    tree.queryPairs(pairs);
+    size_t expectedPairs = 0;
+    for (int i = 0; i < 500; i++) {
+        for (int j = i + 1; j < 500; j++) {
+            if (proxies[i] != -1 && proxies[j] != -1 && overlap(boxes[i], boxes[j]))
+                expectedPairs++;
+        }
+    }
+    EXPECT_EQ(pairs.size(), expectedPairs);
+}
+
+TEST(AabbTreeTest, RaycastReturnsNearestAndSphereUsesDistance) {
+    gameplay::AabbTree tree;
+    tree.insert(boxAt(5, 0, 0, 1), 0);
+    tree.insert(boxAt(2, 0, 0, 1), 1);
+    tree.insert(boxAt(2, 3, 0, 1), 2);
+
+    float distance = 0.0f;
+    Ray ray = {{0, 0.5f, 0.5f}, {1, 0, 0}};
+    EXPECT_EQ(tree.raycast(ray, 100.0f, distance), 1);
+    EXPECT_FLOAT_EQ(distance, 2.0f);
+    EXPECT_EQ(tree.raycast(ray, 1.5f, distance), -1);
+
+    std::vector<int> near;
+    tree.querySphere({2.5f, 1.5f, 0.5f}, 0.6f, near);
+    EXPECT_EQ(near.size(), 1u);
+    EXPECT_EQ(near[0], 1);
+}
+
+TEST(SpriteTreeTest, FollowsRemovalsByIndex) {
+    gameplay::SpriteTree::Sprites sprites;
+    for (int i = 0; i < 3; i++) {
+        sprites.push_back(std::make_shared<objects::Character>());
+        sprites.back()->setBox3DPosition({static_cast<float>(i * 4), 0, 0});
+    }
+    gameplay::SpriteTree tree;
+    tree.sync(sprites);
+
+    sprites.erase(sprites.begin());
+    tree.sync(sprites);
+
+    float distance = 0.0f;
+    Ray ray = {{8, 0.4f, -10}, {0, 0, 1}};
+    EXPECT_EQ(tree.raycast(ray, 100.0f, distance), 1);
+    EXPECT_EQ(tree.getTree().getProxyCount(), 2u);
+}
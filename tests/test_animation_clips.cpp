@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "Assets/AnimationSet.hpp"
+#include "Entities/Character.hpp"
+
+TEST(AnimationSetTest, ClipsFromDescriptorLinesShareOneFrameTable) {
+    std::vector<AnimationClip> clips(2);
+    ASSERT_TRUE(AnimationSet::parseClip("walk 1 0 4 10", clips[0]));
+    ASSERT_TRUE(AnimationSet::parseClip("jump 2 1 3 5 once", clips[1]));
+    AnimationClip invalid;
+    EXPECT_FALSE(AnimationSet::parseClip("walk 1 0 0 10", invalid));
+    EXPECT_EQ(AnimationSet::formatClip(clips[1]), "jump 2 1 3 5 once");
+
+    AnimationSet set({32, 48}, 4, clips);
+
+    // idle falls back to the first walk frame
+    ASSERT_NE(set.getIdleClip(), -1);
+    EXPECT_EQ(set.getClip(set.getIdleClip()).frameCount, 1);
+    EXPECT_FLOAT_EQ(set.getFrame(set.getIdleClip(), 0).y, 48.0f);
+
+    int walk = set.getWalkClip();
+    EXPECT_EQ(set.getFrameAt(walk, 0.35f), 3);
+    EXPECT_EQ(set.getFrameAt(walk, 0.45f), 0);
+    EXPECT_FLOAT_EQ(set.getFrame(walk, 3).x, 96.0f);
+
+    int jump = set.getJumpClip();
+    EXPECT_EQ(set.getFrameAt(jump, 10.0f), 2);
+    EXPECT_FLOAT_EQ(set.getFrame(jump, 2).x, 96.0f);
+    EXPECT_FLOAT_EQ(set.getFrame(jump, 2).y, 96.0f);
+}
+
+TEST(AnimationSetTest, CharactersAdvanceByTimeNotByUpdates) {
+    auto set = std::make_shared<const AnimationSet>(Vector2{32, 32}, 4);
+    std::vector<std::shared_ptr<objects::Character>> characters;
+    for (int i = 0; i < 2; i++) {
+        characters.push_back(std::make_shared<objects::Character>());
+        characters.back()->setBox2DSize({32, 32});
+        characters.back()->setAnimations(set);
+        characters.back()->setMoving(true);
+    }
+
+    // One second at 30 and at 120 updates per second ends on the same frame
+    for (int update = 0; update < 30; update++)
+        characters[0]->advanceAnimation(1.0f / 30.0f);
+    for (int update = 0; update < 120; update++)
+        characters[1]->advanceAnimation(1.0f / 120.0f);
+    EXPECT_FLOAT_EQ(characters[0]->getBox2D().getPosition().x, characters[1]->getBox2D().getPosition().x);
+    EXPECT_EQ(characters[0]->getClip(), set->getWalkClip());
+
+    characters[0]->setMoving(false);
+    characters[0]->advanceAnimation(0.1f);
+    EXPECT_EQ(characters[0]->getClip(), set->getIdleClip());
+    EXPECT_FLOAT_EQ(characters[0]->getBox2D().getPosition().x, 0.0f);
+}
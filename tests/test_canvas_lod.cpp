@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+#include "../src/Editor/ScriptingEditor/ScriptingEditor.hpp"
+
+TEST(CanvasLodTest, DetailFollowsOnScreenHeight) {
+    ScriptBlock block(1, BlockType::MOVE);
+    block.size = {160, 60};
+
+    EXPECT_EQ(block.getDetailLevel(2.0f), BlockDetail::FULL);
+    EXPECT_EQ(block.getDetailLevel(0.75f), BlockDetail::FULL);
+    EXPECT_EQ(block.getDetailLevel(0.5f), BlockDetail::TITLE);
+    EXPECT_EQ(block.getDetailLevel(0.3f), BlockDetail::TITLE);
+    EXPECT_EQ(block.getDetailLevel(0.25f), BlockDetail::BOX);
+
+    // Taller blocks keep their detail further out
+    block.size = {160, 120};
+    EXPECT_EQ(block.getDetailLevel(0.4f), BlockDetail::FULL);
+}
+
+TEST(CanvasLodTest, TextureCacheOnlyTakesCanvasSizedBlocks) {
+    BlockTextureCache cache({160, 60});
+    EXPECT_TRUE(cache.accepts({160, 60}));
+    EXPECT_FALSE(cache.accepts({230, 35}));
+    EXPECT_GE(cache.getCapacity(), 100u);
+
+    bool rendered = false;
+    cache.beginFrame();
+    EXPECT_FALSE(cache.prepare(1, {230, 35}, [&](Vector2) { rendered = true; }));
+    EXPECT_FALSE(rendered);
+    EXPECT_FALSE(cache.contains(1));
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+#include "../src/Editor/ScriptingEditor/CanvasSpatialIndex.hpp"
+
+TEST(CanvasSpatialIndexTest, TopmostHitFollowsOrder) {
+    CanvasSpatialIndex index(100.0f);
+    index.insert(1, {0, 0, 160, 60}, 0);
+    index.insert(2, {100, 40, 160, 60}, 5);
+
+    EXPECT_EQ(index.queryTopmost({10, 10}), 1);
+    EXPECT_EQ(index.queryTopmost({120, 50}), 2);
+    EXPECT_EQ(index.queryTopmost({500, 500}), -1);
+
+    index.update(2, {1000, 1000, 160, 60}, 5);
+    EXPECT_EQ(index.queryTopmost({120, 50}), 1);
+    EXPECT_EQ(index.queryTopmost({1050, 1010}), 2);
+
+    index.remove(1);
+    EXPECT_EQ(index.queryTopmost({10, 10}), -1);
+    EXPECT_EQ(index.size(), 1u);
+}
+
+TEST(CanvasSpatialIndexTest, RectQueryCullsAndSortsByOrder) {
+    CanvasSpatialIndex index(256.0f);
+    for (int i = 0; i < 5000; i++) {
+        float x = static_cast<float>((i % 100) * 200);
+        float y = static_cast<float>((i / 100) * 100);
+        index.insert(i, {x, y, 160, 60}, 5000 - i);
+    }
+
+    std::vector<int> visible;
+    index.queryRect({0, 0, 500, 250}, visible);
+
+    // Columns 0-2 of rows 0-2
+    ASSERT_EQ(visible.size(), 9u);
+    EXPECT_EQ(visible.front(), 202);
+    EXPECT_EQ(visible.back(), 0);
+
+    index.queryRect({-1e6f, -1e6f, 2e6f, 2e6f}, visible);
+    EXPECT_EQ(visible.size(), 5000u);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "Gameplay/CollisionWorld.hpp"
+
+namespace {
+
+BoundingBox unitCube(float x, float y, float z) {
+    return {{x, y, z}, {x + 1, y + 1, z + 1}};
+}
+
+BoundingBox characterAt(float x, float y, float z) {
+    return {{x - 0.25f, y, z - 0.25f}, {x + 0.25f, y + 0.8f, z + 0.25f}};
+}
+
+}
+
+TEST(CollisionWorldTest, FastFallStopsOnTheFirstSurface) {
+    gameplay::CollisionWorld world;
+    world.addSolid(unitCube(0, 0, 0));
+    world.addSolid(unitCube(0, -5, 0));
+    BoundingBox box = characterAt(0.5f, 4.0f, 0.5f);
+
+    gameplay::MoveResult result = world.move(box, {0, -20, 0});
+
+    EXPECT_FLOAT_EQ(box.min.y, 1.0f);
+    EXPECT_TRUE(result.grounded);
+    EXPECT_FLOAT_EQ(result.normal.y, 1.0f);
+    EXPECT_NEAR(result.timeOfImpact, 3.0f / 20.0f, 1e-5f);
+}
+
+TEST(CollisionWorldTest, WallsBlockWithNormalAndSideAxesSlide) {
+    gameplay::CollisionWorld world;
+    world.addSolid(unitCube(0, 0, 0));
+    world.addSolid(unitCube(1, 0, 0));
+    world.addSolid(unitCube(2, 1, 0));
+    BoundingBox box = characterAt(1.0f, 1.0f, 0.5f);
+
+    gameplay::MoveResult result = world.move(box, {2, 0, 0.2f});
+
+    EXPECT_FLOAT_EQ(box.max.x, 2.0f);
+    EXPECT_FLOAT_EQ(result.normal.x, -1.0f);
+    EXPECT_FLOAT_EQ(result.moved.z, 0.2f);
+    EXPECT_FALSE(result.steppedUp);
+}
+
+TEST(CollisionWorldTest, GroundedBoxesClimbLowLedges) {
+    gameplay::CollisionWorld world;
+    world.addSolid(unitCube(0, 0, 0));
+    world.addSolid(unitCube(1, 0.4f, 0));
+    BoundingBox box = characterAt(0.5f, 1.0f, 0.5f);
+
+    gameplay::MoveResult climbed = world.move(box, {1, -0.01f, 0}, 0.5f);
+
+    EXPECT_TRUE(climbed.steppedUp);
+    EXPECT_TRUE(climbed.grounded);
+    EXPECT_FLOAT_EQ(box.min.x, 1.25f);
+    EXPECT_NEAR(box.min.y, 1.4f, 1e-5f);
+
+    // Without a step height the same ledge is a wall
+    BoundingBox blocked = characterAt(0.5f, 1.0f, 0.5f);
+    world.move(blocked, {1, -0.01f, 0});
+    EXPECT_FLOAT_EQ(blocked.max.x, 1.0f);
+}
+
+TEST(CollisionWorldTest, OverlappingBoxesCanLeave) {
+    gameplay::CollisionWorld world;
+    world.addSolid(unitCube(0, 0, 0));
+    BoundingBox box = characterAt(0.5f, 0.5f, 0.5f);
+
+    EXPECT_TRUE(world.overlaps(box));
+    world.move(box, {2, 0, 0});
+    EXPECT_FLOAT_EQ(box.min.x, 2.25f);
+    EXPECT_FALSE(world.overlaps(box));
+}
+
+TEST(CollisionWorldTest, MovedSolidsLeaveTheirOldCells) {
+    gameplay::CollisionWorld world;
+    world.addSolid(unitCube(0, 0, 0));
+    world.addSolid(unitCube(5, 0, 0));
+
+    world.moveSolid(0, unitCube(0, 3.5f, 0));
+
+    EXPECT_EQ(world.getSolidCount(), 2u);
+    EXPECT_FALSE(world.overlaps(characterAt(0.5f, 0.1f, 0.5f)));
+    EXPECT_TRUE(world.overlaps(characterAt(0.5f, 3.6f, 0.5f)));
+    EXPECT_TRUE(world.overlaps(characterAt(5.5f, 0.1f, 0.5f)));
+    BoundingBox box = characterAt(0.5f, 6.0f, 0.5f);
+    world.move(box, {0, -10, 0});
+    EXPECT_FLOAT_EQ(box.min.y, 4.5f);
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include "../src/Editor/ScriptingEditor/ConnectionRenderer.hpp"
+
+TEST(ConnectionRendererTest, RetessellatesOnlyWhenAnEndpointMoves) {
+    ConnectionRenderer renderer;
+    ConnectionKey key = {1, 0, 2, 0};
+
+    renderer.beginFrame();
+    renderer.addConnection(key, {0, 0}, {200, 150}, BLACK, 3.0f, 1.0f);
+    renderer.endFrame();
+    renderer.beginFrame();
+    renderer.addConnection(key, {0, 0}, {200, 150}, BLACK, 3.0f, 1.0f);
+    renderer.endFrame();
+    EXPECT_EQ(renderer.getTessellationCount(), 1u);
+
+    renderer.beginFrame();
+    renderer.addConnection(key, {0, 0}, {240, 150}, BLACK, 3.0f, 1.0f);
+    renderer.endFrame();
+    EXPECT_EQ(renderer.getTessellationCount(), 2u);
+
+    // Culled but still present: kept. Gone from the graph: evicted.
+    renderer.beginFrame();
+    renderer.retain(key);
+    renderer.endFrame();
+    EXPECT_EQ(renderer.getCachedCount(), 1u);
+    renderer.beginFrame();
+    renderer.endFrame();
+    EXPECT_EQ(renderer.getCachedCount(), 0u);
+}
+
+TEST(ConnectionRendererTest, SegmentCountDropsWithZoom) {
+    Vector2 start = {0, 0};
+    Vector2 end = {300, 200};
+    int close = ConnectionRenderer::getSegmentCount(start, end, 1.0f);
+    int far = ConnectionRenderer::getSegmentCount(start, end, 0.1f);
+
+    EXPECT_GT(close, far);
+    EXPECT_LE(close, ConnectionRenderer::MAX_SEGMENTS);
+    EXPECT_EQ(ConnectionRenderer::getSegmentCount(start, end, 0.001f), ConnectionRenderer::MIN_SEGMENTS);
+
+    std::vector<Vector2> points;
+    ASSERT_TRUE(ConnectionRenderer::tessellate(start, end, far, points));
+    EXPECT_EQ(points.size(), static_cast<size_t>(far) + 3);
+    EXPECT_FLOAT_EQ(points[far].x, end.x);
+    EXPECT_FLOAT_EQ(points[far].y, end.y);
+}
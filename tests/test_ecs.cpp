@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "ECS/Systems.hpp"
+#include "Entities/Character.hpp"
+
+TEST(EcsRegistryTest, RemovalKeepsPoolsPackedAndHandlesVersioned) {
+    ecs::Registry registry;
+    ecs::Entity first = registry.create();
+    ecs::Entity second = registry.create();
+    ecs::Entity third = registry.create();
+    registry.getPositions().emplace(first, {{1, 0, 0}});
+    registry.getPositions().emplace(second, {{2, 0, 0}});
+    registry.getPositions().emplace(third, {{3, 0, 0}});
+
+    registry.destroy(first);
+
+    EXPECT_EQ(registry.getPositions().size(), 2u);
+    EXPECT_FLOAT_EQ(registry.getPositions().get(third).value.x, 3.0f);
+    EXPECT_FLOAT_EQ(registry.getPositions().get(second).value.x, 2.0f);
+
+    // The recycled slot must not answer to the destroyed handle
+    ecs::Entity recycled = registry.create();
+    EXPECT_EQ(ecs::entityIndex(recycled), ecs::entityIndex(first));
+    EXPECT_FALSE(registry.isAlive(first));
+    EXPECT_TRUE(registry.isAlive(recycled));
+    EXPECT_FALSE(registry.getPositions().contains(recycled));
+    EXPECT_EQ(registry.getPositions().tryGet(first), nullptr);
+}
+
+TEST(EcsSystemsTest, AnimationMatchesCharacter) {
+    AnimationClip jump = {"jump", 1, 0, 3, 10.0f, false};
+    auto set = std::make_shared<const AnimationSet>(Vector2{32, 32}, 4, std::vector<AnimationClip>{jump});
+    objects::Character character;
+    character.setBox2DSize({32, 32});
+    character.setAnimations(set);
+
+    ecs::Registry registry;
+    ecs::Entity entity = registry.create();
+    registry.getSprites().emplace(entity, {{}, {0, 0, 32, 32}});
+    ecs::Animation animation;
+    animation.set = set.get();
+    registry.getAnimations().emplace(entity, animation);
+
+    for (int update = 0; update < 90; update++) {
+        bool moving = update >= 10 && update < 60;
+        bool jumping = update >= 40 && update < 50;
+        float deltaTime = update % 3 == 0 ? 1.0f / 30.0f : 1.0f / 60.0f;
+        character.setMoving(moving);
+        character.setJumping(jumping);
+        registry.getAnimations().get(entity).moving = moving;
+        registry.getAnimations().get(entity).jumping = jumping;
+
+        character.advanceAnimation(deltaTime);
+        ecs::updateAnimations(registry, deltaTime);
+        const Rectangle &source = registry.getSprites().get(entity).source;
+        ASSERT_FLOAT_EQ(source.x, character.getBox2D().getPosition().x) << "update " << update;
+        ASSERT_FLOAT_EQ(source.y, character.getBox2D().getPosition().y) << "update " << update;
+        ASSERT_EQ(registry.getAnimations().get(entity).clip, character.getClip()) << "update " << update;
+    }
+}
+
+TEST(EcsSystemsTest, MovementOnlyTouchesEntitiesWithBothComponents) {
+    ecs::Registry registry;
+    ecs::Entity mover = registry.create();
+    ecs::Entity still = registry.create();
+    ecs::Entity ghost = registry.create();
+    registry.getPositions().emplace(mover, {{0, 0, 0}});
+    registry.getVelocities().emplace(mover, {{1, 0, -2}});
+    registry.getPositions().emplace(still, {{5, 5, 5}});
+    registry.getVelocities().emplace(ghost, {{1, 1, 1}});
+
+    ecs::updateMovement(registry);
+    ecs::updateMovement(registry);
+
+    EXPECT_FLOAT_EQ(registry.getPositions().get(mover).value.x, 2.0f);
+    EXPECT_FLOAT_EQ(registry.getPositions().get(mover).value.z, -4.0f);
+    EXPECT_FLOAT_EQ(registry.getPositions().get(still).value.x, 5.0f);
+    EXPECT_FALSE(registry.getPositions().contains(ghost));
+}
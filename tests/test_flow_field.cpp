@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Gameplay/FlowField.hpp"
+
+namespace {
+
+std::vector<Vector3> walledFloor(int size) {
+    std::vector<Vector3> blocks;
+    for (int x = 0; x < size; x++) {
+        for (int z = 0; z < size; z++) {
+            blocks.push_back({static_cast<float>(x), 0, static_cast<float>(z)});
+            // Wall across the middle, open at the last row
+            if (x == size / 2 && z < size - 1) {
+                blocks.push_back({static_cast<float>(x), 1, static_cast<float>(z)});
+                blocks.push_back({static_cast<float>(x), 2, static_cast<float>(z)});
+            }
+        }
+    }
+    return blocks;
+}
+
+}
+
+TEST(FlowFieldTest, WaypointsFollowTheShortestPaths) {
+    gameplay::NavGrid grid;
+    grid.build(walledFloor(12));
+    gameplay::FlowField field;
+    field.setGoal(grid, {10.5f, 1, 0.5f});
+    ASSERT_TRUE(field.update(grid));
+
+    Vector3 position = {0.5f, 1, 0.5f};
+    std::vector<Vector3> path;
+    ASSERT_TRUE(grid.findPath(position, {10.5f, 1, 0.5f}, path, false));
+    Vector3 waypoint;
+    size_t steps = 0;
+    float length = 0.0f;
+    while (field.getNextWaypoint(grid, position, waypoint)) {
+        ASSERT_LT(steps, path.size());
+        length += std::hypot(waypoint.x - position.x, waypoint.z - position.z);
+        position = waypoint;
+        steps++;
+    }
+    EXPECT_EQ(steps, path.size());
+    EXPECT_FLOAT_EQ(position.x, 10.5f);
+    EXPECT_FLOAT_EQ(position.z, 0.5f);
+    EXPECT_NEAR(field.getCost(grid.findNode({0.5f, 1, 0.5f})), length, 0.01f);
+}
+
+TEST(FlowFieldTest, KeepsTheLastFieldWhileIntegratingAMovedGoal) {
+    gameplay::NavGrid grid;
+    grid.build(walledFloor(40));
+    gameplay::FlowField field(64);
+    field.setGoal(grid, {1.5f, 1, 1.5f});
+    while (!field.update(grid)) {}
+    int firstGoal = field.getGoal();
+
+    field.setGoal(grid, {38.5f, 1, 1.5f});
+    field.setGoal(grid, {38.5f, 1, 2.5f});
+    EXPECT_FALSE(field.update(grid));
+    EXPECT_EQ(field.getGoal(), firstGoal);
+    Vector3 waypoint;
+    EXPECT_TRUE(field.getNextWaypoint(grid, {5.5f, 1, 1.5f}, waypoint));
+    EXPECT_LT(waypoint.x, 5.5f);
+
+    // The goal set last wins once the queued integration ends
+    while (!field.update(grid)) {}
+    EXPECT_EQ(field.getGoal(), grid.findNode({38.5f, 1, 2.5f}));
+
+    grid.build(walledFloor(41));
+    EXPECT_FALSE(field.getNextWaypoint(grid, {5.5f, 1, 1.5f}, waypoint));
+}
+
+TEST(FlowFieldTest, EditsOutOfReachKeepTheField) {
+    std::vector<Vector3> blocks = walledFloor(24);
+    // A platform of its own, further along the same grid
+    for (int x = 40; x < 44; x++)
+        blocks.push_back({static_cast<float>(x), 0, 4});
+    gameplay::NavGrid grid;
+    grid.build(blocks);
+    gameplay::FlowField field(64);
+    field.setGoal(grid, {20.5f, 1, 0.5f});
+    while (!field.update(grid)) {}
+
+    blocks.push_back({42, 1, 4});
+    grid.build(blocks);
+    field.setGoal(grid, {20.5f, 1, 0.5f});
+    EXPECT_TRUE(field.isReady());
+    EXPECT_TRUE(field.update(grid));
+    Vector3 waypoint;
+    EXPECT_TRUE(field.getNextWaypoint(grid, {0.5f, 1, 0.5f}, waypoint));
+}
+
+TEST(FlowFieldTest, ChasersKeepMovingWhileTheGridIsRebuilt) {
+    const int size = 48;
+    std::vector<Vector3> blocks = walledFloor(size);
+    const Vector3 goal = {size - 2.5f, 1, 1.5f};
+    gameplay::NavGrid grid;
+    grid.build(blocks);
+    gameplay::FlowField field(64);
+    field.setGoal(grid, goal);
+    while (!field.update(grid)) {}
+
+    // A step on the chaser's way comes and goes while the field is being redone
+    Vector3 position = {1.5f, 1, 1.5f};
+    Vector3 waypoint;
+    int frame = 0;
+    for (; frame < 400; frame++) {
+        if (frame % 10 == 0 && frame < 300) {
+            if (frame % 20 == 0)
+                blocks.push_back({10, 1, 20});
+            else
+                blocks.pop_back();
+            grid.build(blocks);
+        }
+        field.setGoal(grid, goal);
+        field.update(grid);
+        if (grid.findNode(position) == grid.findNode(goal))
+            break;
+        // Only the node of the edited column may lose its way, for the frame the field needs
+        bool edited = std::floor(position.x) == 10.0f && std::floor(position.z) == 20.0f;
+        if (field.getNextWaypoint(grid, position, waypoint))
+            position = waypoint;
+        else
+            ASSERT_TRUE(edited) << "frame " << frame;
+    }
+    EXPECT_LT(frame, 400);
+
+    // With the grid left alone, the field settles on the shortest ways again
+    while (!field.update(grid)) {}
+    gameplay::FlowField fresh;
+    fresh.setGoal(grid, goal);
+    ASSERT_TRUE(fresh.update(grid));
+    for (int node = 0; node < static_cast<int>(grid.getNodeCount()); node++)
+        ASSERT_FLOAT_EQ(field.getCost(node), fresh.getCost(node)) << "node " << node;
+}
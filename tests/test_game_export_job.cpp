@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "../src/Utilities/GameExportJob.hpp"
+
+TEST(GameExportJobTest, ParsesBuildProgress) {
+    EXPECT_FLOAT_EQ(GameExportJob::parseBuildProgress("[ 45%] Building CXX object src/Game.cpp.o"), 0.45f);
+    EXPECT_FLOAT_EQ(GameExportJob::parseBuildProgress("[100%] Linking CXX executable GenericGame"), 1.0f);
+    EXPECT_FLOAT_EQ(GameExportJob::parseBuildProgress("[12/48] Building CXX object"), 0.25f);
+    EXPECT_LT(GameExportJob::parseBuildProgress("-- Configuring done"), 0.0f);
+    EXPECT_LT(GameExportJob::parseBuildProgress("[GameExporter] Missing asset"), 0.0f);
+}
+
+TEST(GameExportJobTest, ChildProcessStreamsOutputAndExitCode) {
+    ChildProcess process;
+    ASSERT_TRUE(process.start({"sh", "-c", "echo building; echo failed >&2; exit 3"}));
+
+    std::string output;
+    int exitCode = 0;
+    bool exited = false;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!exited && std::chrono::steady_clock::now() < deadline) {
+        process.readOutput(output);
+        exited = process.poll(exitCode);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    process.readOutput(output);
+
+    ASSERT_TRUE(exited);
+    EXPECT_EQ(exitCode, 3);
+    EXPECT_EQ(output, "building\nfailed\n");
+}
+
+namespace {
+
+bool waitForExit(ChildProcess& process, std::chrono::seconds timeout) {
+    int exitCode = 0;
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (process.poll(exitCode)) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+}
+
+TEST(GameExportJobTest, TerminateStopsTheWholeProcessGroup) {
+    ChildProcess process;
+    // The shell forks sleep, as make forks the compiler
+    ASSERT_TRUE(process.start({"sh", "-c", "sleep 30; echo late"}));
+
+    auto start = std::chrono::steady_clock::now();
+    process.terminate();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+    EXPECT_TRUE(process.isTerminating());
+    EXPECT_TRUE(waitForExit(process, std::chrono::seconds(2)));
+    EXPECT_FALSE(process.isRunning());
+}
+
+TEST(GameExportJobTest, TerminateEscalatesAfterTheGracePeriod) {
+    ChildProcess process;
+    // Ignored SIGTERM is inherited by sleep, only SIGKILL stops the group
+    ASSERT_TRUE(process.start({"sh", "-c", "trap '' TERM; sleep 30"}));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    process.terminate(std::chrono::milliseconds(100));
+    int exitCode = 0;
+    EXPECT_FALSE(process.poll(exitCode));
+    EXPECT_TRUE(waitForExit(process, std::chrono::seconds(2)));
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <unistd.h>
+#include "../src/Utilities/GameExporter.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+void writeFile(const fs::path& path, const std::string& content)
+{
+    fs::create_directories(path.parent_path());
+    std::ofstream(path, std::ios::binary) << content;
+}
+
+class GameExporterTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        _root = fs::temp_directory_path() / ("isomaker_export_test_" + std::to_string(getpid()));
+        fs::remove_all(_root);
+        writeFile(_root / "project" / "src" / "main.cpp", "int main() {}");
+        writeFile(_root / "engine" / "Graphical" / "src" / "Window.cpp", "// window");
+        writeFile(_root / "engine" / "Graphical" / "build" / "_deps" / "raylib.c", "// fetched");
+        writeFile(_root / "ressources" / "cube.obj", "o cube");
+        writeFile(_root / "ressources" / "cube.mtl", "newmtl cube");
+        writeFile(_root / "ressources" / "player.png", "png");
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(_root);
+    }
+
+    fs::path _root;
+};
+
+}
+
+TEST_F(GameExporterTest, CopiesOnlyChangedContent) {
+    GameExporter exporter((_root / "project").string(), (_root / "engine").string());
+    std::vector<std::string> assets = {
+        (_root / "ressources" / "cube.obj").string(),
+        (_root / "ressources" / "player.png").string()
+    };
+
+    ExportReport first = exporter.cookContent(assets);
+    ASSERT_TRUE(first.success);
+    EXPECT_EQ(first.filesCopied, 3u);   // The material travels with its model
+    fs::path exported = _root / "project" / GameExporter::CONTENT_DIRECTORY /
+        GameExporter::contentRelativePath(assets[0]);
+    EXPECT_TRUE(fs::exists(exported));
+
+    ExportReport unchanged = exporter.cookContent(assets);
+    EXPECT_EQ(unchanged.filesCopied, 0u);
+    EXPECT_EQ(unchanged.filesUnchanged, 3u);
+
+    writeFile(_root / "ressources" / "player.png", "png v2");
+    ExportReport edited = GameExporter((_root / "project").string(), (_root / "engine").string()).cookContent(assets);
+    EXPECT_EQ(edited.filesCopied, 1u);
+    EXPECT_EQ(edited.filesUnchanged, 2u);
+
+    ExportReport removed = exporter.cookContent({assets[1]});
+    EXPECT_EQ(removed.filesRemoved, 2u);
+    EXPECT_FALSE(fs::exists(exported));
+}
+
+TEST_F(GameExporterTest, KeysStayInsideTheContentDirectory) {
+    fs::path project = _root / "project";
+    fs::path content = project / GameExporter::CONTENT_DIRECTORY;
+    GameExporter exporter(project.string(), (_root / "engine").string());
+    // From the working directory, usually climbing out of it first
+    std::string relative = fs::relative(_root / "ressources" / "player.png").string();
+
+    EXPECT_EQ(GameExporter::contentRelativePath("../../a/./b/../c.png").generic_string(), "_parent/_parent/a/c.png");
+    EXPECT_TRUE(GameExporter::contentRelativePath("./a/..").empty());
+
+    // A hand-edited manifest must not make the export delete files outside
+    writeFile(_root / "victim.txt", "keep");
+    writeFile(project / GameExporter::MANIFEST_FILE, "0000000000000001 ../../../victim.txt\n");
+    ExportReport report = exporter.cookContent({relative});
+    ASSERT_TRUE(report.success);
+    EXPECT_EQ(report.filesRemoved, 0u);
+    EXPECT_TRUE(fs::exists(_root / "victim.txt"));
+    for (const auto& entry : fs::recursive_directory_iterator(content)) {
+        fs::path inside = fs::relative(entry.path(), content);
+        EXPECT_NE(*inside.begin(), "..");
+    }
+    EXPECT_TRUE(fs::exists(content / GameExporter::contentRelativePath(relative)));
+}
+
+TEST_F(GameExporterTest, EngineHashIgnoresBuildTrees) {
+    GameExporter exporter((_root / "project").string(), (_root / "engine").string());
+    uint64_t hash = exporter.computeEngineHash();
+
+    writeFile(_root / "engine" / "Graphical" / "build" / "_deps" / "raylib.c", "// fetched again");
+    EXPECT_EQ(exporter.computeEngineHash(), hash);
+
+    writeFile(_root / "engine" / "Graphical" / "src" / "Window.cpp", "// window, edited");
+    EXPECT_NE(exporter.computeEngineHash(), hash);
+
+    // Never built: the first export has to compile the player
+    EXPECT_FALSE(exporter.isEngineUpToDate());
+}
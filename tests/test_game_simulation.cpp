@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <filesystem>
+#include <unistd.h>
+#include "Gameplay/GameSimulation.hpp"
+
+namespace {
+
+std::shared_ptr<objects::MapElement> makeCube(Vector3D position) {
+    return std::make_shared<objects::MapElement>(Asset3D(), position, Vector3D(1, 1, 1));
+}
+
+}
+
+TEST(GameSimulationTest, CharactersLandOnCubesAndWalkOffEdges) {
+    gameplay::GameSimulation::Cubes cubes = {makeCube({0, 0, 0})};
+    gameplay::GameSimulation::Sprites sprites;
+    gameplay::GameSimulation simulation(cubes, sprites, nullptr);
+    objects::Character character;
+    character.setBox3DPosition({0.5f, 3.0f, 0.5f});
+
+    gameplay::MoveResult landing = simulation.moveCharacter(character, {0, -5, 0});
+    EXPECT_TRUE(landing.grounded);
+    EXPECT_FLOAT_EQ(landing.normal.y, 1.0f);
+    EXPECT_FLOAT_EQ(character.getBoxPosition().y, 1.0f);
+
+    gameplay::MoveResult walkOff = simulation.moveCharacter(character, {2, 0, 0});
+    EXPECT_FALSE(walkOff.grounded);
+    EXPECT_FLOAT_EQ(character.getBoxPosition().x, 2.5f);
+    EXPECT_EQ(simulation.getPlayer(), nullptr);
+}
+
+TEST(GameSimulationTest, CharactersChaseThePlayerAcrossTheFloor) {
+    gameplay::GameSimulation::Cubes cubes;
+    for (int x = 0; x < 12; x++)
+        cubes.push_back(makeCube({static_cast<float>(x), 0, 0}));
+    gameplay::GameSimulation::Sprites sprites = {std::make_shared<objects::Character>(), std::make_shared<objects::Character>()};
+    sprites[0]->setBox3DPosition({0.5f, 1.0f, 0.5f});
+    sprites[1]->setBox3DPosition({10.5f, 3.0f, 0.5f});
+    for (auto &sprite : sprites) {
+        sprite->setBox2DSize({32, 32});
+        sprite->setTotalFrames(4);
+    }
+    gameplay::GameSimulation simulation(cubes, sprites, nullptr);
+    input::MouseKeyboardHandler input;
+
+    for (int frame = 0; frame < 60; frame++)
+        simulation.update(input, 1.0f / 60.0f);
+
+    // Landed on the floor, then walked towards the player with the walk clip playing
+    EXPECT_FLOAT_EQ(sprites[1]->getBoxPosition().y, 1.0f);
+    EXPECT_LT(sprites[1]->getBoxPosition().x, 10.0f);
+    EXPECT_TRUE(sprites[1]->isMoving());
+    EXPECT_FALSE(sprites[1]->isJumping());
+    EXPECT_FALSE(sprites[0]->isMoving());
+
+    // The editor moved the character between two updates
+    sprites[1]->setBox3DPosition({6.5f, 1.0f, 0.5f});
+    simulation.update(input, 1.0f / 60.0f);
+    EXPECT_LT(sprites[1]->getBoxPosition().x, 6.5f);
+    EXPECT_GT(sprites[1]->getBoxPosition().x, 6.3f);
+}
+
+TEST(GameSimulationTest, FarCharactersFollowARouteUntilTheFieldReachesThem) {
+    gameplay::GameSimulation::Cubes cubes;
+    for (int x = 0; x < 96; x++)
+        for (int z = 0; z < 96; z++)
+            cubes.push_back(makeCube({static_cast<float>(x), 0, static_cast<float>(z)}));
+    gameplay::GameSimulation::Sprites sprites = {std::make_shared<objects::Character>(), std::make_shared<objects::Character>()};
+    sprites[0]->setBox3DPosition({0.5f, 1.0f, 0.5f});
+    sprites[1]->setBox3DPosition({90.5f, 1.0f, 90.5f});
+    gameplay::GameSimulation simulation(cubes, sprites, nullptr);
+    input::MouseKeyboardHandler input;
+
+    // More nodes than one update integrates: the field has no step yet
+    simulation.update(input, 1.0f / 60.0f);
+    EXPECT_LT(sprites[1]->getBoxPosition().x, 90.5f);
+    EXPECT_LT(sprites[1]->getBoxPosition().z, 90.5f);
+    EXPECT_TRUE(sprites[1]->isMoving());
+
+    for (int frame = 0; frame < 30; frame++)
+        simulation.update(input, 1.0f / 60.0f);
+    EXPECT_LT(sprites[1]->getBoxPosition().x + sprites[1]->getBoxPosition().z, 180.0f);
+}
+
+TEST(GameSimulationTest, ScriptsActOnTheSharedScene) {
+    gameplay::GameSimulation::Cubes cubes = {makeCube({0, 0, 0}), makeCube({1, 0, 0})};
+    gameplay::GameSimulation::Sprites sprites;
+    gameplay::GameSimulation simulation(cubes, sprites, nullptr);
+
+    objects::Character character;
+    character.setBox3DPosition({1.5f, 5.0f, 0.5f});
+    simulation.moveCharacter(character, {0, -10, 0});
+    simulation.moveObject(1, {0, 2, 0});
+    simulation.moveObject(5, {0, 2, 0});
+    // The character now lands on the raised cube
+    character.setBox3DPosition({1.5f, 5.0f, 0.5f});
+    EXPECT_TRUE(simulation.moveCharacter(character, {0, -10, 0}).grounded);
+    EXPECT_FLOAT_EQ(character.getBoxPosition().y, 3.0f);
+    simulation.setObjectVisible(0, false);
+    simulation.rotateObject(1, {0, 2, 0}, 45.0f);
+    simulation.rotateObject(1, {0, 1, 0}, 45.0f);
+    simulation.rotateObject(5, {0, 1, 0}, 45.0f);
+    simulation.setObjectColor(0, RED);
+
+    EXPECT_FLOAT_EQ(cubes[1]->getBoxPosition().y, 2.0f);
+    EXPECT_TRUE(simulation.isHidden(0));
+    Quaternion turned = simulation.getRotation(1);
+    EXPECT_NEAR(turned.y, std::sin(45.0f * DEG2RAD), 1e-5f);
+    EXPECT_NEAR(turned.w, std::cos(45.0f * DEG2RAD), 1e-5f);
+    EXPECT_FLOAT_EQ(simulation.getRotation(5).w, 1.0f);
+    Color red = RED;
+    EXPECT_EQ(simulation.getTint(0).g, red.g);
+    EXPECT_EQ(simulation.getTint(1).g, 255);
+    simulation.resetSceneState();
+    EXPECT_FALSE(simulation.isHidden(0));
+    EXPECT_FLOAT_EQ(simulation.getRotation(1).w, 1.0f);
+    EXPECT_EQ(simulation.getTint(0).g, 255);
+}
+
+TEST(GameSimulationTest, ProfilingSavesWhereTheEditorReads) {
+    gameplay::GameSimulation::Cubes cubes = {makeCube({0, 0, 0})};
+    gameplay::GameSimulation::Sprites sprites;
+    gameplay::GameSimulation simulation(cubes, sprites, nullptr);
+    input::MouseKeyboardHandler input;
+    std::string path = (std::filesystem::temp_directory_path() /
+        ("isomaker_profile_test_" + std::to_string(getpid()) + scripting::ScriptProfileIO::FILE_EXTENSION)).string();
+
+    EXPECT_FALSE(simulation.saveProfile());
+    simulation.enableProfiling(path);
+    CompiledScript script(0, "lift");
+    CompiledScriptNode update(1, BlockType::ON_UPDATE);
+    update.nextNodes = {2};
+    CompiledScriptNode move(2, BlockType::MOVE);
+    move.config.setFloat("speed", 1.0f);
+    script.nodes = {update, move};
+    script.entryPoints = {1};
+    script.isValid = true;
+    simulation.addScript(script);
+    simulation.start();
+    for (int frame = 0; frame < 3; frame++)
+        simulation.update(input, 0.016f);
+    ASSERT_TRUE(simulation.saveProfile());
+
+    scripting::ScriptProfile profile;
+    std::string error;
+    ASSERT_TRUE(scripting::ScriptProfileIO::loadFromFile(path, profile, error)) << error;
+    std::filesystem::remove(path);
+    EXPECT_EQ(profile.frames, 3u);
+    std::unordered_map<int, scripting::NodeCounters> counters = profile.getBlockCounters(0);
+    EXPECT_EQ(counters[2].calls, 3u);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <unistd.h>
+#include "LiveLink/LiveLink.hpp"
+
+TEST(LiveLinkTest, ProtocolRoundTripsAndWaitsForCompleteFrames) {
+    livelink::Message cube;
+    cube.type = livelink::MessageType::CUBE_ADDED;
+    cube.position = {1.0f, 2.0f, 3.0f};
+    cube.path = "ressources/elements/models/cube.obj";
+    cube.scale = 0.5f;
+
+    livelink::Message script;
+    script.type = livelink::MessageType::SCRIPT_UPDATED;
+    script.payload = {'I', 'S', 'C', 'S', 1, 2, 3};
+
+    std::vector<uint8_t> stream;
+    livelink::Protocol::encode(cube, stream);
+    size_t firstFrame = stream.size();
+    livelink::Protocol::encode(script, stream);
+
+    // Only the first frame is complete: the second one stays buffered
+    std::vector<livelink::Message> decoded;
+    EXPECT_EQ(livelink::Protocol::decode(stream.data(), stream.size() - 1, decoded), static_cast<long>(firstFrame));
+    ASSERT_EQ(decoded.size(), 1u);
+    EXPECT_EQ(decoded[0].type, livelink::MessageType::CUBE_ADDED);
+    EXPECT_FLOAT_EQ(decoded[0].position.y, 2.0f);
+    EXPECT_EQ(decoded[0].path, cube.path);
+    EXPECT_FLOAT_EQ(decoded[0].scale, 0.5f);
+
+    decoded.clear();
+    EXPECT_EQ(livelink::Protocol::decode(stream.data(), stream.size(), decoded), static_cast<long>(stream.size()));
+    ASSERT_EQ(decoded.size(), 2u);
+    EXPECT_EQ(decoded[1].payload, script.payload);
+
+    stream[firstFrame + livelink::Protocol::HEADER_SIZE] = 0xff;
+    EXPECT_EQ(livelink::Protocol::decode(stream.data(), stream.size(), decoded), -1);
+}
+
+TEST(LiveLinkTest, ClientDeliversMessagesToServer) {
+    std::string path = "/tmp/isomaker_livelink_test_" + std::to_string(getpid()) + ".sock";
+    livelink::LiveLinkServer server;
+    ASSERT_TRUE(server.listen(path));
+
+    livelink::LiveLinkClient client(path);
+    client.update();
+    ASSERT_TRUE(client.isConnected());
+
+    livelink::Message removed;
+    removed.type = livelink::MessageType::SPRITE_REMOVED;
+    removed.index = 2;
+    EXPECT_TRUE(client.send(removed));
+
+    std::vector<livelink::Message> received;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (received.empty() && std::chrono::steady_clock::now() < deadline) {
+        server.poll(received);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].type, livelink::MessageType::SPRITE_REMOVED);
+    EXPECT_EQ(received[0].index, 2);
+    EXPECT_TRUE(server.hasClient());
+
+    // The editor notices a game that went away and waits for the next one
+    server.close();
+    EXPECT_FALSE(client.send(removed));
+    EXPECT_FALSE(client.isConnected());
+}
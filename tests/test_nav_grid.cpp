@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include "Gameplay/NavGrid.hpp"
+
+namespace {
+
+std::vector<Vector3> floorBlocks(int width, int depth) {
+    std::vector<Vector3> blocks;
+    for (int x = 0; x < width; x++) {
+        for (int z = 0; z < depth; z++)
+            blocks.push_back({static_cast<float>(x), 0, static_cast<float>(z)});
+    }
+    return blocks;
+}
+
+void addWall(std::vector<Vector3>& blocks, int x, int fromZ, int toZ, int height) {
+    for (int z = fromZ; z <= toZ; z++) {
+        for (int y = 1; y <= height; y++)
+            blocks.push_back({static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)});
+    }
+}
+
+}
+
+TEST(NavGridTest, ClimbsOneBlockAndWalksAroundTallerWalls) {
+    std::vector<Vector3> blocks = floorBlocks(10, 10);
+    addWall(blocks, 5, 0, 8, 2);
+    gameplay::NavGrid grid;
+    grid.build(blocks);
+
+    std::vector<Vector3> path;
+    ASSERT_TRUE(grid.findPath({0.5f, 1, 0.5f}, {9.5f, 1, 0.5f}, path));
+    EXPECT_FLOAT_EQ(path.back().x, 9.5f);
+    // The only gap in the wall is the row z = 9
+    bool usedGap = false;
+    for (const Vector3& point : path) {
+        EXPECT_FLOAT_EQ(point.y, 1.0f);
+        usedGap |= point.x == 5.5f && point.z == 9.5f;
+    }
+    EXPECT_TRUE(usedGap);
+
+    std::vector<Vector3> stepBlocks = floorBlocks(10, 10);
+    addWall(stepBlocks, 5, 0, 9, 1);
+    grid.build(stepBlocks);
+    ASSERT_TRUE(grid.findPath({0.5f, 1, 0.5f}, {9.5f, 1, 0.5f}, path));
+    EXPECT_EQ(path.size(), 9u);
+    EXPECT_FLOAT_EQ(path[4].y, 2.0f);
+
+    // Off the map
+    EXPECT_EQ(grid.findNode({20, 1, 20}), -1);
+    EXPECT_FALSE(grid.findPath({0.5f, 1, 0.5f}, {20, 1, 20}, path));
+}
+
+TEST(NavGridTest, RebuildOnlyForgetsPathsThroughChangedChunks) {
+    std::vector<Vector3> blocks = floorBlocks(64, 64);
+    gameplay::NavGrid grid;
+    grid.build(blocks);
+
+    std::vector<Vector3> path;
+    ASSERT_TRUE(grid.findPath({1.5f, 1, 1.5f}, {10.5f, 1, 1.5f}, path));
+    ASSERT_TRUE(grid.findPath({40.5f, 1, 40.5f}, {50.5f, 1, 40.5f}, path));
+    EXPECT_EQ(grid.getCachedPathCount(), 2u);
+
+    addWall(blocks, 5, 0, 3, 2);
+    grid.build(blocks);
+    EXPECT_EQ(grid.getCachedPathCount(), 1u);
+
+    ASSERT_TRUE(grid.findPath({1.5f, 1, 1.5f}, {10.5f, 1, 1.5f}, path));
+    for (const Vector3& point : path)
+        EXPECT_FALSE(point.x == 5.5f && point.z < 4.0f);
+    EXPECT_EQ(grid.getCachedPathCount(), 2u);
+}
+
+TEST(NavGridTest, PartialRebuildMatchesAFullOne) {
+    std::vector<Vector3> blocks = floorBlocks(64, 64);
+    addWall(blocks, 20, 10, 30, 1);
+    gameplay::NavGrid grid;
+    grid.build(blocks);
+    std::uint32_t version = grid.getVersion();
+
+    grid.build(blocks);
+    EXPECT_EQ(grid.getVersion(), version);
+
+    // Raise a step and a wall in the middle chunks, more nodes shift the others
+    addWall(blocks, 33, 33, 33, 1);
+    addWall(blocks, 40, 16, 47, 3);
+    blocks.push_back({33, 5, 33});
+    grid.build(blocks);
+    EXPECT_EQ(grid.getVersion(), version + 1);
+    const std::vector<bool>& changed = grid.getChangedChunks();
+    EXPECT_EQ(std::count(changed.begin(), changed.end(), true), 4);
+
+    gameplay::NavGrid fresh;
+    fresh.build(blocks);
+    ASSERT_EQ(grid.getNodeCount(), fresh.getNodeCount());
+    ASSERT_EQ(grid.getEdgeCount(), fresh.getEdgeCount());
+    for (int node = 0; node < static_cast<int>(grid.getNodeCount()); node++) {
+        ASSERT_EQ(grid.getEdgeBegin(node), fresh.getEdgeBegin(node)) << "node " << node;
+        for (std::uint32_t edge = grid.getEdgeBegin(node); edge < grid.getEdgeEnd(node); edge++) {
+            EXPECT_EQ(grid.getEdgeTarget(edge), fresh.getEdgeTarget(edge));
+            EXPECT_FLOAT_EQ(grid.getEdgeCost(edge), fresh.getEdgeCost(edge));
+        }
+    }
+    std::vector<Vector3> path;
+    EXPECT_TRUE(grid.findPath({1.5f, 1, 1.5f}, {60.5f, 1, 60.5f}, path));
+    EXPECT_FALSE(grid.findPath({1.5f, 1, 1.5f}, {33.5f, 6, 33.5f}, path));
+}
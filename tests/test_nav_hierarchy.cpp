@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Gameplay/NavHierarchy.hpp"
+
+namespace {
+
+// Floor with walls every 16 columns, each with a single gap at a different row
+std::vector<Vector3> maze(int size) {
+    std::vector<Vector3> blocks;
+    for (int x = 0; x < size; x++) {
+        for (int z = 0; z < size; z++) {
+            blocks.push_back({static_cast<float>(x), 0, static_cast<float>(z)});
+            bool wall = x % 16 == 8 && z != (x / 16 * 23) % size;
+            if (wall) {
+                blocks.push_back({static_cast<float>(x), 1, static_cast<float>(z)});
+                blocks.push_back({static_cast<float>(x), 2, static_cast<float>(z)});
+            }
+        }
+    }
+    return blocks;
+}
+
+float pathLength(Vector3 from, const std::vector<Vector3>& path) {
+    float length = 0.0f;
+    for (const Vector3& point : path) {
+        length += std::hypot(point.x - from.x, point.z - from.z);
+        from = point;
+    }
+    return length;
+}
+
+}
+
+TEST(NavHierarchyTest, RefinedRoutesReachTheGoalThroughTheGaps) {
+    gameplay::NavGrid grid;
+    grid.build(maze(64));
+    gameplay::NavHierarchy hierarchy;
+
+    Vector3 from = {0.5f, 1, 60.5f};
+    Vector3 to = {63.5f, 1, 3.5f};
+    gameplay::NavHierarchy::Route route;
+    ASSERT_TRUE(hierarchy.planRoute(grid, from, to, route));
+    EXPECT_GT(hierarchy.getPortalCount(), 0u);
+
+    Vector3 position = grid.getNodePosition(grid.findNode(from));
+    std::vector<Vector3> segment;
+    std::vector<Vector3> walked;
+    while (hierarchy.refineNext(grid, route, segment)) {
+        for (const Vector3& point : segment) {
+            // Every step goes to a neighbouring column
+            EXPECT_LE(std::fabs(point.x - position.x), 1.0f);
+            EXPECT_LE(std::fabs(point.z - position.z), 1.0f);
+            position = point;
+            walked.push_back(point);
+        }
+    }
+    ASSERT_FALSE(walked.empty());
+    EXPECT_FLOAT_EQ(walked.back().x, 63.5f);
+    EXPECT_FLOAT_EQ(walked.back().z, 3.5f);
+
+    std::vector<Vector3> direct;
+    ASSERT_TRUE(grid.findPath(from, to, direct, false));
+    EXPECT_LE(pathLength(from, walked), pathLength(from, direct) * 1.3f);
+}
+
+TEST(NavHierarchyTest, EditingABlockOnlyRedoesItsChunk) {
+    std::vector<Vector3> blocks = maze(64);
+    gameplay::NavGrid grid;
+    grid.build(blocks);
+    gameplay::NavHierarchy hierarchy;
+    hierarchy.update(grid);
+    EXPECT_EQ(hierarchy.getLastRebuiltChunkCount(), 16u);
+
+    blocks.push_back({36, 1, 36});
+    grid.build(blocks);
+    hierarchy.update(grid);
+    EXPECT_EQ(hierarchy.getLastRebuiltChunkCount(), 1u);
+
+    gameplay::NavHierarchy::Route route;
+    EXPECT_TRUE(hierarchy.planRoute(grid, {0.5f, 1, 0.5f}, {63.5f, 1, 63.5f}, route));
+    ASSERT_TRUE(hierarchy.planRoute(grid, {0.5f, 1, 0.5f}, {36.5f, 2, 36.5f}, route));
+    EXPECT_FLOAT_EQ(route.waypoints.back().y, 2.0f);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include "../src/Editor/ScriptingEditor/ScriptingEditor.hpp"
+
+namespace {
+
+std::shared_ptr<const VisualScript> makeSnapshot(bool connected)
+{
+    auto script = std::make_shared<VisualScript>(3, "Door");
+    ScriptBlock start(1, BlockType::ON_START, {0.0f, 0.0f});
+    start.isOnCanvas = true;
+    script->addBlock(start);
+    ScriptBlock log(2, BlockType::LOG, {0.0f, 100.0f});
+    log.isOnCanvas = true;
+    script->addBlock(log);
+    if (connected) {
+        script->addConnection(BlockConnection(1, 2, {0.0f, 0.0f}, {0.0f, 0.0f}));
+    }
+    return script;
+}
+
+std::vector<ScriptBuildResult> waitForResults(ScriptBuildWorker& worker)
+{
+    std::vector<ScriptBuildResult> results;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (worker.getPendingCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    worker.poll(results);
+    return results;
+}
+
+}
+
+TEST(ScriptBuildWorkerTest, ReportsBlockErrorsAndCompilesLatestSnapshot) {
+    ScriptBuildWorker worker;
+
+    worker.submit(3, 1, makeSnapshot(false));
+    std::vector<ScriptBuildResult> results = waitForResults(worker);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].version, 1u);
+    EXPECT_FALSE(results[0].isValid);
+    EXPECT_EQ(results[0].compiled, nullptr);
+    ASSERT_EQ(results[0].blockErrors.size(), 1u);
+    EXPECT_EQ(results[0].blockErrors.count(2), 1u);
+
+    // The result for the newest version always arrives, older ones may be skipped
+    for (uint64_t version = 2; version <= 20; version++) {
+        worker.submit(3, version, makeSnapshot(version % 2 == 0));
+    }
+    results = waitForResults(worker);
+    ASSERT_FALSE(results.empty());
+    EXPECT_LE(results.size(), 19u);
+    const ScriptBuildResult& latest = results.back();
+    EXPECT_EQ(latest.version, 20u);
+    EXPECT_TRUE(latest.isValid);
+    EXPECT_TRUE(latest.blockErrors.empty());
+    ASSERT_NE(latest.compiled, nullptr);
+    EXPECT_EQ(latest.compiled->nodes.size(), 2u);
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include "../src/Editor/ScriptingEditor/ScriptingEditor.hpp"
+
+namespace {
+
+VisualScript makePatrol(int objectId, float speed)
+{
+    VisualScript script(objectId, "Patrol");
+    ScriptBlock start(1, BlockType::ON_UPDATE, {0.0f, 0.0f});
+    start.isOnCanvas = true;
+    script.addBlock(start);
+    ScriptBlock move(2, BlockType::MOVE, {0.0f, 100.0f});
+    move.isOnCanvas = true;
+    move.config.setFloat("speed", speed);
+    script.addBlock(move);
+    script.addConnection(BlockConnection(1, 2, {0.0f, 0.0f}, {0.0f, 0.0f}));
+    return script;
+}
+
+}
+
+TEST(ScriptLibraryTest, IdenticalScriptsShareDefinitionAndCompilation) {
+    ScriptLibrary library;
+    for (int objectId = 0; objectId < 20; objectId++) {
+        library.assign(makePatrol(objectId, objectId < 19 ? 2.0f : 5.0f));
+    }
+
+    EXPECT_EQ(library.getObjectCount(), 20u);
+    EXPECT_EQ(library.getDefinitionCount(), 1u);
+    EXPECT_EQ(library.getVariantCount(), 2u);
+
+    bool reused = true;
+    std::shared_ptr<const CompiledScript> first = library.compile(0, &reused);
+    ASSERT_TRUE(first && first->isValid);
+    EXPECT_FALSE(reused);
+    EXPECT_EQ(library.compile(7, &reused), first);
+    EXPECT_TRUE(reused);
+
+    // The overridden parameter reaches only the object that has it
+    VisualScript odd = library.materialize(19);
+    EXPECT_EQ(odd.objectId, 19);
+    EXPECT_EQ(odd.findBlock(2)->config.getFloat(BlockParams::MOVE_SPEED), 5.0f);
+    EXPECT_NE(library.compile(19), first);
+}
+
+TEST(ScriptLibraryTest, EditingOneInstanceLeavesTheOthersShared) {
+    ScriptLibrary library;
+    library.assign(makePatrol(1, 2.0f));
+    library.assign(makePatrol(2, 2.0f));
+
+    VisualScript& script = library.checkout(1);
+    ScriptBlock log(3, BlockType::LOG, {0.0f, 200.0f});
+    log.isOnCanvas = true;
+    script.addBlock(log);
+    library.sync();
+
+    EXPECT_EQ(library.getDefinitionCount(), 2u);
+    EXPECT_EQ(library.materialize(1).blocks.size(), 3u);
+    EXPECT_EQ(library.materialize(2).blocks.size(), 2u);
+
+    // Undoing the edit folds the object back onto the shared graph
+    library.checkout(1).removeBlock(3);
+    library.release();
+    EXPECT_EQ(library.getDefinitionCount(), 1u);
+    EXPECT_EQ(library.getVariantCount(), 1u);
+}
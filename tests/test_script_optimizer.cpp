@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "Scripting/ScriptOptimizer.hpp"
+
+namespace {
+
+CompiledScriptNode makeNode(int id, BlockType type, std::vector<int> next = {})
+{
+    CompiledScriptNode node(id, type);
+    node.nextNodes = next;
+    return node;
+}
+
+bool hasNode(const CompiledScript &script, int blockId)
+{
+    for (const auto &node : script.nodes) {
+        if (node.blockId == blockId)
+            return true;
+    }
+    return false;
+}
+
+const CompiledScriptNode &getNode(const CompiledScript &script, int blockId)
+{
+    for (const auto &node : script.nodes) {
+        if (node.blockId == blockId)
+            return node;
+    }
+    return script.nodes.front();
+}
+
+}
+
+TEST(ScriptOptimizerTest, FoldsConstantIfAndDropsDeadBranch) {
+    CompiledScript script(0);
+    script.nodes.push_back(makeNode(1, BlockType::ON_START, {2}));
+    CompiledScriptNode branch = makeNode(2, BlockType::IF);
+    branch.trueNextNode = 3;
+    branch.falseNextNode = 4;
+    branch.valueInputs = {-1, 5};
+    script.nodes.push_back(branch);
+    script.nodes.push_back(makeNode(3, BlockType::SHOW));
+    script.nodes.push_back(makeNode(4, BlockType::HIDE));
+    script.nodes.push_back(makeNode(5, BlockType::FALSE));
+    script.entryPoints = {1};
+    script.isValid = true;
+
+    scripting::OptimizationReport report;
+    CompiledScript optimized = scripting::ScriptOptimizer().optimize(script, report);
+
+    ASSERT_TRUE(report.isValid);
+    ASSERT_EQ(optimized.nodes.size(), 2u);
+    EXPECT_EQ(getNode(optimized, 1).nextNodes, std::vector<int>{4});
+    EXPECT_FALSE(hasNode(optimized, 3));
+    EXPECT_EQ(report.passes[0].removedNodes, 1);
+    EXPECT_EQ(report.passes[3].removedNodes, 2);
+    EXPECT_EQ(report.nodesBefore - report.nodesAfter, 3);
+}
+
+TEST(ScriptOptimizerTest, RemovesEmptyLoopAndFusesMoves) {
+    CompiledScript script(0);
+    script.nodes.push_back(makeNode(1, BlockType::ON_UPDATE, {2}));
+    CompiledScriptNode loop = makeNode(2, BlockType::LOOP, {3});
+    loop.config.setFloat("iterations", 4.0f);
+    script.nodes.push_back(loop);
+    CompiledScriptNode first = makeNode(3, BlockType::MOVE, {4});
+    first.config.setVector("direction", {1.0f, 0.0f, 0.0f});
+    first.config.setFloat("speed", 2.0f);
+    script.nodes.push_back(first);
+    CompiledScriptNode second = makeNode(4, BlockType::MOVE);
+    second.config.setVector("direction", {0.0f, 0.0f, 1.0f});
+    second.config.setFloat("speed", 3.0f);
+    script.nodes.push_back(second);
+    script.entryPoints = {1};
+    script.isValid = true;
+
+    scripting::OptimizationReport report;
+    CompiledScript optimized = scripting::ScriptOptimizer().optimize(script, report);
+
+    ASSERT_TRUE(report.isValid);
+    ASSERT_EQ(optimized.nodes.size(), 2u);
+    const CompiledScriptNode &move = getNode(optimized, 3);
+    EXPECT_EQ(getNode(optimized, 1).nextNodes, std::vector<int>{3});
+    EXPECT_FLOAT_EQ(move.config.getVector("direction", {}).x, 2.0f);
+    EXPECT_FLOAT_EQ(move.config.getVector("direction", {}).z, 3.0f);
+    EXPECT_FLOAT_EQ(move.config.getFloat("speed", 0.0f), 1.0f);
+    EXPECT_TRUE(move.nextNodes.empty());
+    EXPECT_EQ(report.passes[1].removedNodes, 1);
+    EXPECT_EQ(report.passes[2].removedNodes, 1);
+}
@@ -0,0 +1,283 @@
+#include <gtest/gtest.h>
+#include "Scripting/ScriptScheduler.hpp"
+
+namespace {
+
+class RecordingHost : public scripting::IScriptHost {
+    public:
+        void moveObject(int, Vector3 offset) override { moved.x += offset.x; moves++; }
+        void rotateObject(int, Vector3, float) override {}
+        void setObjectColor(int, Color) override {}
+        void setObjectVisible(int, bool visible) override { lastVisible = visible; }
+        void logMessage(int, const std::string &message) override { logs.push_back(message); }
+
+        Vector3 moved = {0, 0, 0};
+        int moves = 0;
+        bool lastVisible = true;
+        std::vector<std::string> logs;
+};
+
+CompiledScriptNode makeNode(int id, BlockType type, std::vector<int> next = {})
+{
+    CompiledScriptNode node(id, type);
+    node.nextNodes = next;
+    return node;
+}
+
+CompiledScriptNode makeLog(int id, const std::string &message, std::vector<int> next = {})
+{
+    CompiledScriptNode node = makeNode(id, BlockType::LOG, next);
+    node.config.setString("message", message);
+    return node;
+}
+
+}
+
+TEST(TimerWheelTest, ExpiresInDeadlineOrder) {
+    scripting::TimerWheel wheel;
+    std::vector<int> expired;
+
+    wheel.schedule(300, 1);
+    wheel.schedule(5, 2);
+    wheel.schedule(20000, 3);
+    wheel.schedule(5, 4);
+    EXPECT_EQ(wheel.getPendingCount(), 4u);
+
+    wheel.advance(6, expired);
+    ASSERT_EQ(expired.size(), 2u);
+    EXPECT_EQ(expired[0], 2);
+    EXPECT_EQ(expired[1], 4);
+
+    wheel.advance(294, expired);
+    EXPECT_EQ(expired.size(), 2u);
+    wheel.advance(1, expired);
+    ASSERT_EQ(expired.size(), 3u);
+    EXPECT_EQ(expired[2], 1);
+
+    wheel.advance(19699, expired);
+    EXPECT_EQ(expired.size(), 3u);
+    wheel.advance(1, expired);
+    ASSERT_EQ(expired.size(), 4u);
+    EXPECT_EQ(expired[3], 3);
+    EXPECT_EQ(wheel.getPendingCount(), 0u);
+}
+
+TEST(TimerWheelTest, CancelledTimersNeverFire) {
+    scripting::TimerWheel wheel;
+    std::vector<int> expired;
+
+    scripting::TimerWheel::Handle handle = wheel.schedule(1000, 7);
+    wheel.schedule(1000, 8);
+    EXPECT_TRUE(wheel.cancel(handle));
+    EXPECT_FALSE(wheel.cancel(handle));
+
+    wheel.advance(1001, expired);
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_EQ(expired[0], 8);
+}
+
+TEST(ScriptSchedulerTest, DelaySuspendsUntilExpiry) {
+    RecordingHost host;
+    scripting::ScriptScheduler scheduler(host);
+    CompiledScript script(0, "delay");
+
+    script.nodes.push_back(makeNode(1, BlockType::ON_START, {2}));
+    script.nodes.push_back(makeLog(2, "before", {3}));
+    CompiledScriptNode delay = makeNode(3, BlockType::DELAY, {4});
+    delay.config.setFloat("duration", 0.5f);
+    script.nodes.push_back(delay);
+    script.nodes.push_back(makeLog(4, "after"));
+    script.entryPoints = {1};
+    script.isValid = true;
+
+    scheduler.addScript(script);
+    scheduler.start();
+    scheduler.update(0.016f);
+    ASSERT_EQ(host.logs.size(), 1u);
+    EXPECT_EQ(scheduler.getWaitingCount(), 1u);
+
+    scheduler.update(0.25f);
+    EXPECT_EQ(host.logs.size(), 1u);
+    scheduler.update(0.3f);
+    ASSERT_EQ(host.logs.size(), 2u);
+    EXPECT_EQ(host.logs[1], "after");
+    EXPECT_EQ(scheduler.getWaitingCount(), 0u);
+}
+
+TEST(ScriptSchedulerTest, LoopRunsBodyThenNext) {
+    RecordingHost host;
+    scripting::ScriptScheduler scheduler(host);
+    CompiledScript script(0, "loop");
+
+    script.nodes.push_back(makeNode(1, BlockType::ON_START, {2}));
+    CompiledScriptNode loop = makeNode(2, BlockType::LOOP, {4});
+    loop.config.setFloat("iterations", 3.0f);
+    loop.loopBodyNode = 3;
+    script.nodes.push_back(loop);
+    script.nodes.push_back(makeLog(3, "body"));
+    script.nodes.push_back(makeLog(4, "done"));
+    script.entryPoints = {1};
+    script.isValid = true;
+
+    scheduler.addScript(script);
+    scheduler.start();
+    scheduler.update(0.016f);
+    ASSERT_EQ(host.logs.size(), 4u);
+    EXPECT_EQ(host.logs[2], "body");
+    EXPECT_EQ(host.logs[3], "done");
+}
+
+TEST(ScriptSchedulerTest, UpdateScriptRestartsOnlyWhenIdle) {
+    RecordingHost host;
+    scripting::ScriptScheduler scheduler(host);
+    CompiledScript script(0, "update");
+
+    script.nodes.push_back(makeNode(1, BlockType::ON_UPDATE, {2}));
+    CompiledScriptNode move = makeNode(2, BlockType::MOVE, {3});
+    move.config.setVector("direction", {1.0f, 0.0f, 0.0f});
+    move.config.setFloat("speed", 2.0f);
+    script.nodes.push_back(move);
+    CompiledScriptNode delay = makeNode(3, BlockType::DELAY);
+    delay.config.setFloat("duration", 1.0f);
+    script.nodes.push_back(delay);
+    script.entryPoints = {1};
+    script.isValid = true;
+
+    scheduler.addScript(script);
+    scheduler.start();
+    for (int frame = 0; frame < 10; frame++)
+        scheduler.update(0.1f);
+    EXPECT_EQ(host.moves, 1);
+    EXPECT_FLOAT_EQ(host.moved.x, 0.2f);
+
+    // The delay expires during the 12th frame, the flow restarts on the next one
+    for (int frame = 0; frame < 3; frame++)
+        scheduler.update(0.1f);
+    EXPECT_EQ(host.moves, 2);
+}
+
+TEST(ScriptSchedulerTest, IdenticalUpdateScriptsShareOneBatch) {
+    RecordingHost host;
+    scripting::ScriptScheduler scheduler(host);
+
+    for (int objectId = 0; objectId < 3; objectId++) {
+        CompiledScript script(objectId, "patrol");
+        script.nodes.push_back(makeNode(1, BlockType::ON_UPDATE, {2}));
+        CompiledScriptNode branch = makeNode(2, BlockType::IF);
+        branch.trueNextNode = 3;
+        branch.falseNextNode = 5;
+        branch.valueInputs = {4};
+        script.nodes.push_back(branch);
+        CompiledScriptNode move = makeNode(3, BlockType::MOVE);
+        move.config.setVector("direction", {1.0f, 0.0f, 0.0f});
+        move.config.setFloat("speed", 1.0f);
+        script.nodes.push_back(move);
+        script.nodes.push_back(makeNode(4, BlockType::TRUE));
+        script.nodes.push_back(makeLog(5, "not taken"));
+        script.entryPoints = {1};
+        script.isValid = true;
+        scheduler.addScript(script);
+    }
+
+    EXPECT_EQ(scheduler.getBatchCount(), 1u);
+    EXPECT_EQ(scheduler.getProgramCount(), 1u);
+    scheduler.start();
+    scheduler.update(0.5f);
+    EXPECT_EQ(host.moves, 3);
+    EXPECT_FLOAT_EQ(host.moved.x, 1.5f);
+    EXPECT_TRUE(host.logs.empty());
+
+    scheduler.removeScripts(1);
+    scheduler.update(0.5f);
+    EXPECT_EQ(host.moves, 5);
+}
+
+TEST(ScriptProfilerTest, CountsNodeExecutionsPerBlock) {
+    RecordingHost host;
+    scripting::ScriptScheduler scheduler(host);
+    scripting::ScriptProfiler profiler;
+    scheduler.setProfiler(&profiler);
+
+    for (int objectId = 0; objectId < 3; objectId++) {
+        CompiledScript script(objectId, "patrol");
+        // Block IDs differ per object, the program is still shared
+        int base = objectId * 10;
+        script.nodes.push_back(makeNode(base + 1, BlockType::ON_UPDATE, {base + 2}));
+        CompiledScriptNode move = makeNode(base + 2, BlockType::MOVE);
+        move.config.setFloat("speed", 1.0f);
+        script.nodes.push_back(move);
+        script.entryPoints = {base + 1};
+        script.isValid = true;
+        scheduler.addScript(script);
+    }
+    CompiledScript greeter(7, "greeter");
+    greeter.nodes.push_back(makeNode(1, BlockType::ON_START, {2}));
+    greeter.nodes.push_back(makeLog(2, "hello"));
+    greeter.entryPoints = {1};
+    greeter.isValid = true;
+    scheduler.addScript(greeter);
+
+    scheduler.start();
+    scheduler.update(0.1f);
+    scheduler.update(0.1f);
+
+    std::vector<uint8_t> binary;
+    scripting::ScriptProfileIO::write(profiler.snapshot(), binary);
+    scripting::ScriptProfile profile;
+    std::string error;
+    ASSERT_TRUE(scripting::ScriptProfileIO::read(binary.data(), binary.size(), profile, error)) << error;
+    EXPECT_EQ(profile.frames, 2u);
+    ASSERT_EQ(profile.programs.size(), 2u);
+
+    std::size_t sharedBy = 0;
+    std::unordered_map<int, scripting::NodeCounters> patrol = profile.getBlockCounters(1, &sharedBy);
+    EXPECT_EQ(sharedBy, 3u);
+    EXPECT_EQ(patrol[11].calls, 6u);
+    EXPECT_EQ(patrol[12].calls, 6u);
+
+    std::unordered_map<int, scripting::NodeCounters> logged = profile.getBlockCounters(7);
+    EXPECT_EQ(logged[2].calls, 1u);
+    EXPECT_TRUE(profile.getBlockCounters(42).empty());
+
+    binary.pop_back();
+    EXPECT_FALSE(scripting::ScriptProfileIO::read(binary.data(), binary.size(), profile, error));
+}
+
+TEST(ScriptSchedulerTest, LongLoopsRunUnderTheSameBudgetWithOrWithoutBatching) {
+    RecordingHost plainHost;
+    RecordingHost delayedHost;
+    scripting::ScriptScheduler plain(plainHost);
+    scripting::ScriptScheduler delayed(delayedHost);
+
+    // The same loop, once alone and once followed by a DELAY that rules out batching
+    for (bool withDelay : {false, true}) {
+        CompiledScript script(0, "spin");
+        script.nodes.push_back(makeNode(1, BlockType::ON_UPDATE, {2}));
+        CompiledScriptNode loop = makeNode(2, BlockType::LOOP, withDelay ? std::vector<int>{4} : std::vector<int>{});
+        loop.config.setFloat("iterations", 10000.0f);
+        loop.loopBodyNode = 3;
+        script.nodes.push_back(loop);
+        CompiledScriptNode move = makeNode(3, BlockType::MOVE);
+        move.config.setVector("direction", {1.0f, 0.0f, 0.0f});
+        move.config.setFloat("speed", 1.0f);
+        script.nodes.push_back(move);
+        if (withDelay) {
+            CompiledScriptNode delay = makeNode(4, BlockType::DELAY);
+            delay.config.setFloat("duration", 1.0f);
+            script.nodes.push_back(delay);
+        }
+        script.entryPoints = {1};
+        script.isValid = true;
+        (withDelay ? delayed : plain).addScript(script);
+    }
+
+    EXPECT_EQ(plain.getBatchCount(), 0u);
+    plain.start();
+    delayed.start();
+    for (int frame = 0; frame < 3; frame++) {
+        plain.update(0.016f);
+        delayed.update(0.016f);
+        ASSERT_FLOAT_EQ(plainHost.moved.x, delayedHost.moved.x) << "frame " << frame;
+    }
+    EXPECT_LT(plainHost.moves, 10000);
+}
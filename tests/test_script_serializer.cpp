@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include "Scripting/CompiledScriptIO.hpp"
+#include "Scripting/JsonReader.hpp"
+#include "../src/Editor/ScriptingEditor/ScriptSerializer.hpp"
+
+namespace {
+
+VisualScript makeScript()
+{
+    VisualScript script(7, "Door \"main\"\\opener");
+    script.enabled = false;
+
+    ScriptBlock start(1, BlockType::ON_KEY_PRESS, {10.5f, 20.25f});
+    start.isOnCanvas = true;
+    start.canvasOrder = 3;
+    start.config.setString("key", "Space");
+    script.addBlock(start);
+
+    ScriptBlock move(2, BlockType::MOVE, {10.5f, 140.0f});
+    move.isOnCanvas = true;
+    move.canvasOrder = 4;
+    move.config.setVector("direction", {0.1f, -2.0f, 1e-7f});
+    move.config.setFloat("speed", 3.14159274f);
+    move.config.setBool("relative", true);
+    script.addBlock(move);
+
+    ScriptBlock log(3, BlockType::LOG, {200.0f, 140.0f});
+    log.isOnCanvas = true;
+    log.title = "Log\ttab";
+    log.config.setString("message", "line1\nline2 \x01");
+    script.addBlock(log);
+
+    script.addConnection(BlockConnection(1, 2, ConnectionPortType::EXECUTION_OUT, ConnectionPortType::EXECUTION_IN,
+        0, 0, {0, 0}, {0, 0}));
+    script.addConnection(BlockConnection(2, 3, ConnectionPortType::EXECUTION_OUT, ConnectionPortType::EXECUTION_IN,
+        0, 0, {0, 0}, {0, 0}));
+    return script;
+}
+
+void expectSameScript(const VisualScript &expected, const VisualScript &actual)
+{
+    EXPECT_EQ(actual.objectId, expected.objectId);
+    EXPECT_EQ(actual.name, expected.name);
+    EXPECT_EQ(actual.enabled, expected.enabled);
+    ASSERT_EQ(actual.blocks.size(), expected.blocks.size());
+    for (size_t i = 0; i < expected.blocks.size(); i++) {
+        const ScriptBlock &a = actual.blocks[i];
+        const ScriptBlock &e = expected.blocks[i];
+        EXPECT_EQ(a.id, e.id);
+        EXPECT_EQ(a.type, e.type);
+        EXPECT_EQ(a.position.x, e.position.x);
+        EXPECT_EQ(a.position.y, e.position.y);
+        EXPECT_EQ(a.title, e.title);
+        EXPECT_EQ(a.subtitle, e.subtitle);
+        EXPECT_EQ(a.isOnCanvas, e.isOnCanvas);
+        EXPECT_EQ(a.canvasOrder, e.canvasOrder);
+        EXPECT_EQ(a.inputPorts.size(), e.inputPorts.size());
+        EXPECT_TRUE(a.config == e.config);
+    }
+    ASSERT_EQ(actual.connections.size(), expected.connections.size());
+    for (size_t i = 0; i < expected.connections.size(); i++) {
+        EXPECT_EQ(actual.connections[i].fromBlockId, expected.connections[i].fromBlockId);
+        EXPECT_EQ(actual.connections[i].toBlockId, expected.connections[i].toBlockId);
+        EXPECT_EQ(actual.connections[i].fromPortType, expected.connections[i].fromPortType);
+        EXPECT_EQ(actual.connections[i].toPortIndex, expected.connections[i].toPortIndex);
+    }
+    EXPECT_EQ(actual.getOutgoing(1).size(), 1u);
+}
+
+class CountingHandler : public scripting::IJsonHandler {
+    public:
+        bool onObjectStart() override { objects++; return true; }
+        bool onObjectEnd() override { return true; }
+        bool onArrayStart() override { arrays++; return true; }
+        bool onArrayEnd() override { return true; }
+        bool onKey(std::string_view key) override { keys.emplace_back(key); return true; }
+        bool onString(std::string_view value) override { strings.emplace_back(value); return true; }
+        bool onNumber(double value) override { numbers.push_back(value); return true; }
+        bool onBool(bool) override { return true; }
+        bool onNull() override { return true; }
+
+        int objects = 0;
+        int arrays = 0;
+        std::vector<std::string> keys;
+        std::vector<std::string> strings;
+        std::vector<double> numbers;
+};
+
+}
+
+TEST(JsonReaderTest, StreamsEventsAndDecodesEscapes) {
+    CountingHandler handler;
+    scripting::JsonReader reader;
+
+    ASSERT_TRUE(reader.parse(R"({"a": [1, -2.5e2, 0.125], "s": "x\"\u00e9\ud83d\ude00", "n": null, "o": {}})", handler));
+    EXPECT_EQ(handler.objects, 2);
+    EXPECT_EQ(handler.arrays, 1);
+    EXPECT_EQ(handler.keys, (std::vector<std::string>{"a", "s", "n", "o"}));
+    EXPECT_EQ(handler.numbers, (std::vector<double>{1.0, -250.0, 0.125}));
+    EXPECT_EQ(handler.strings[0], "x\"\xC3\xA9\xF0\x9F\x98\x80");
+
+    EXPECT_FALSE(reader.parse(R"({"a": [1, 2})", handler));
+    EXPECT_FALSE(reader.parse(R"({"a": 1} x)", handler));
+}
+
+TEST(ScriptSerializerTest, JsonRoundTripKeepsBlocksConfigsAndConnections) {
+    VisualScript original = makeScript();
+    std::string json = ScriptSerializer::toJson(original);
+
+    VisualScript loaded;
+    std::string error;
+    ASSERT_TRUE(ScriptSerializer::fromJson(json, loaded, error)) << error;
+    expectSameScript(original, loaded);
+}
+
+TEST(ScriptSerializerTest, BinaryRoundTripKeepsBlocksConfigsAndConnections) {
+    VisualScript original = makeScript();
+    std::vector<uint8_t> binary;
+    ScriptSerializer::toBinary(original, binary);
+
+    VisualScript loaded;
+    std::string error;
+    ASSERT_TRUE(ScriptSerializer::load(binary.data(), binary.size(), loaded, error)) << error;
+    expectSameScript(original, loaded);
+    EXPECT_LT(binary.size(), ScriptSerializer::toJson(original).size() / 3);
+
+    binary.resize(binary.size() - 3);
+    EXPECT_FALSE(ScriptSerializer::fromBinary(binary.data(), binary.size(), loaded, error));
+}
+
+TEST(CompiledScriptIOTest, BinaryRoundTrip) {
+    CompiledScript script(4, "Spinner");
+    CompiledScriptNode start(1, BlockType::ON_START);
+    start.nextNodes = {2};
+    start.isEntryPoint = true;
+    script.nodes.push_back(start);
+    CompiledScriptNode branch(2, BlockType::IF);
+    branch.trueNextNode = 3;
+    branch.valueInputs = {-1, 5};
+    branch.config.setFloat("threshold", -0.5f);
+    script.nodes.push_back(branch);
+    script.entryPoints = {1};
+    script.isValid = true;
+
+    std::vector<uint8_t> binary;
+    scripting::CompiledScriptIO::write(script, binary);
+    CompiledScript loaded(-1);
+    std::string error;
+    ASSERT_TRUE(scripting::CompiledScriptIO::read(binary.data(), binary.size(), loaded, error)) << error;
+
+    EXPECT_EQ(loaded.objectId, 4);
+    EXPECT_EQ(loaded.name, "Spinner");
+    EXPECT_TRUE(loaded.isValid);
+    EXPECT_EQ(loaded.entryPoints, std::vector<int>{1});
+    ASSERT_EQ(loaded.nodes.size(), 2u);
+    EXPECT_TRUE(loaded.nodes[0].isEntryPoint);
+    EXPECT_EQ(loaded.nodes[0].nextNodes, std::vector<int>{2});
+    EXPECT_EQ(loaded.nodes[1].blockType, BlockType::IF);
+    EXPECT_EQ(loaded.nodes[1].trueNextNode, 3);
+    EXPECT_EQ(loaded.nodes[1].falseNextNode, -1);
+    EXPECT_EQ(loaded.nodes[1].valueInputs, (std::vector<int>{-1, 5}));
+    EXPECT_FLOAT_EQ(loaded.nodes[1].config.getFloat("threshold", 0.0f), -0.5f);
+}
+
+TEST(BlockConfigTest, ConformPlacesParametersInLayoutSlots) {
+    BlockConfig config;
+    config.setBool("relative", true);
+    config.setFloat("speed", 4.0f);
+
+    config.conformTo(BlockType::MOVE);
+
+    ASSERT_EQ(config.size(), 3u);
+    EXPECT_EQ(config.getName(BlockParams::MOVE_DIRECTION), "direction");
+    EXPECT_EQ(config.getVector(BlockParams::MOVE_DIRECTION).x, 1.0f);
+    EXPECT_EQ(config.getFloat(BlockParams::MOVE_SPEED), 4.0f);
+    EXPECT_TRUE(config.getBool("relative", false));
+    EXPECT_TRUE(config != BlockConfig::forType(BlockType::MOVE));
+
+    BlockConfig reordered;
+    reordered.setFloat("speed", 4.0f);
+    reordered.setBool("relative", true);
+    reordered.setVector("direction", {1.0f, 0.0f, 0.0f});
+    EXPECT_TRUE(config == reordered);
+    EXPECT_EQ(config.hash(), reordered.hash());
+}
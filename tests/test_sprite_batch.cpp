@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "Render/SpriteBatch.hpp"
+
+namespace {
+
+Camera3D makeIsoCamera() {
+    Camera3D camera = {};
+    camera.position = {18.0f, 12.0f, 18.0f};
+    camera.target = {0.0f, 0.0f, 0.0f};
+    camera.up = {0.0f, 1.0f, 0.0f};
+    camera.fovy = 22.5f;
+    camera.projection = CAMERA_ORTHOGRAPHIC;
+    return camera;
+}
+
+Texture2D makeTexture(unsigned int id) {
+    Texture2D texture = {};
+    texture.id = id;
+    texture.width = 128;
+    texture.height = 32;
+    return texture;
+}
+
+}
+
+TEST(SpriteBatchTest, SortsBackToFrontAndGroupsEqualDepthsByTexture) {
+    Render::SpriteBatch batch;
+    Texture2D first = makeTexture(1);
+    Texture2D second = makeTexture(2);
+    Rectangle frame = {0, 0, 32, 32};
+
+    batch.add(first, frame, {0, 0, 0});
+    batch.add(second, frame, {-2, 0, -2});
+    batch.add(first, frame, {2, 0, 2});
+    batch.add(second, frame, {0, 0, 0});
+    batch.add(first, frame, {100, 0, -100});
+    batch.add(Texture2D{}, frame, {0, 0, 0});
+    EXPECT_EQ(batch.getSpriteCount(), 5u);
+
+    batch.prepare(makeIsoCamera(), {1280, 720});
+
+    // The sprite far off to the side is culled, the others go far to near
+    std::vector<std::uint32_t> expected = {1, 0, 3, 2};
+    EXPECT_EQ(batch.getOrder(), expected);
+    batch.submit();
+    EXPECT_EQ(batch.getTextureBindCount(), 4u);
+}
+
+TEST(SpriteBatchTest, SpritesOfOneTextureShareABind) {
+    Render::SpriteBatch batch;
+    Texture2D texture = makeTexture(3);
+
+    for (int i = 0; i < 3000; i++)
+        batch.add(texture, {static_cast<float>(i % 4) * 32, 0, 32, 32}, {static_cast<float>(i % 10) - 5, 0, static_cast<float>(i / 10 % 10) - 5});
+    batch.prepare(makeIsoCamera(), {1280, 720});
+    ASSERT_EQ(batch.getOrder().size(), 3000u);
+    batch.submit();
+    EXPECT_EQ(batch.getTextureBindCount(), 1u);
+}
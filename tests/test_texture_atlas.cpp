@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "Entities/Character.hpp"
+#include "Render/SkylinePacker.hpp"
+#include "Render/TextureAtlas.hpp"
+
+TEST(TextureAtlasTest, SkylineFillsAPageOfEqualSheets) {
+    Render::SkylinePacker packer(256, 256);
+    int x = 0;
+    int y = 0;
+
+    for (int i = 0; i < 64; i++)
+        ASSERT_TRUE(packer.insert(32, 32, x, y)) << "sheet " << i;
+    EXPECT_FLOAT_EQ(packer.getOccupancy(), 1.0f);
+    EXPECT_FALSE(packer.insert(1, 1, x, y));
+}
+
+TEST(TextureAtlasTest, LayoutKeepsSheetsApartAndOpensPagesAsNeeded) {
+    std::vector<Vector2> sizes = {{128, 32}, {300, 64}, {64, 200}, {256, 96}, {96, 96}, {512, 16}, {100, 100}};
+    for (int i = 0; i < 20; i++)
+        sizes.push_back({static_cast<float>(40 + i * 7), static_cast<float>(30 + i * 5)});
+
+    std::vector<Render::TextureAtlas::Region> regions = Render::TextureAtlas::layout(sizes, 512);
+
+    ASSERT_EQ(regions.size(), sizes.size());
+    EXPECT_EQ(regions[5].page, -1);     // a sheet as wide as the page has no room for the padding
+    int pages = 0;
+    for (std::size_t a = 0; a < regions.size(); a++) {
+        if (regions[a].page == -1)
+            continue;
+        pages = std::max(pages, regions[a].page + 1);
+        EXPECT_LE(regions[a].x + sizes[a].x, 512.0f);
+        EXPECT_LE(regions[a].y + sizes[a].y, 512.0f);
+        for (std::size_t b = a + 1; b < regions.size(); b++) {
+            if (regions[b].page != regions[a].page)
+                continue;
+            bool apart = regions[a].x + sizes[a].x + Render::TextureAtlas::PADDING <= regions[b].x ||
+                regions[b].x + sizes[b].x + Render::TextureAtlas::PADDING <= regions[a].x ||
+                regions[a].y + sizes[a].y + Render::TextureAtlas::PADDING <= regions[b].y ||
+                regions[b].y + sizes[b].y + Render::TextureAtlas::PADDING <= regions[a].y;
+            EXPECT_TRUE(apart) << "sheets " << a << " and " << b;
+        }
+    }
+    EXPECT_EQ(pages, 2);
+}
+
+TEST(TextureAtlasTest, FramesStartAtTheSheetOrigin) {
+    Asset2D asset;
+    asset.setWidth(32);
+    asset.setHeight(48);
+    asset.setFramesCount(4);
+    asset.setAtlas(Texture2D{}, {200, 64});
+    asset.buildAnimations();
+
+    objects::Character character(asset);
+    EXPECT_FLOAT_EQ(character.getBox2D().getPosition().x, 200.0f);
+    EXPECT_FLOAT_EQ(character.getBox2D().getPosition().y, 64.0f);
+
+    const AnimationSet &set = *asset.getAnimations();
+    EXPECT_FLOAT_EQ(set.getFrame(set.getWalkClip(), 3).x, 296.0f);
+    EXPECT_FLOAT_EQ(set.getFrame(set.getWalkClip(), 3).y, 64.0f);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "../src/Editor/ScriptingEditor/ScriptingEditor.hpp"
+
+namespace {
+
+void addOnCanvas(VisualScript &script, int id, BlockType type)
+{
+    ScriptBlock block(id, type, {0.0f, static_cast<float>(id) * 100.0f});
+    block.isOnCanvas = true;
+    script.addBlock(block);
+}
+
+// start(1) -> log(2) -> log(3) -> log(4), plus start(1) -> log(5)
+VisualScript makeChain()
+{
+    VisualScript script(0, "Chain");
+    addOnCanvas(script, 1, BlockType::ON_START);
+    for (int id = 2; id <= 5; id++)
+        addOnCanvas(script, id, BlockType::LOG);
+    script.addConnection(BlockConnection(1, 2, {0.0f, 0.0f}, {0.0f, 0.0f}));
+    script.addConnection(BlockConnection(2, 3, {0.0f, 0.0f}, {0.0f, 0.0f}));
+    script.addConnection(BlockConnection(3, 4, {0.0f, 0.0f}, {0.0f, 0.0f}));
+    script.addConnection(BlockConnection(1, 5, {0.0f, 0.0f}, {0.0f, 0.0f}));
+    return script;
+}
+
+std::string fullValidation(const VisualScript &script)
+{
+    VisualScript fresh(script.objectId, script.name);
+    std::string errors;
+    fresh.blocks = script.blocks;
+    fresh.connections = script.connections;
+    fresh.invalidateIndex();
+    fresh.validateConnections(errors);
+    return errors;
+}
+
+void expectIndexConsistent(const VisualScript &script)
+{
+    for (const ScriptBlock &block : script.blocks) {
+        std::size_t outgoing = 0;
+        std::size_t incoming = 0;
+        for (const BlockConnection &connection : script.connections) {
+            outgoing += connection.fromBlockId == block.id;
+            incoming += connection.toBlockId == block.id;
+        }
+        ASSERT_EQ(script.getOutgoing(block.id).size(), outgoing) << "block " << block.id;
+        ASSERT_EQ(script.getIncoming(block.id).size(), incoming) << "block " << block.id;
+        for (std::size_t index : script.getOutgoing(block.id))
+            EXPECT_EQ(script.connections[index].fromBlockId, block.id);
+        for (std::size_t index : script.getIncoming(block.id))
+            EXPECT_EQ(script.connections[index].toBlockId, block.id);
+    }
+}
+
+}
+
+TEST(VisualScriptIndexTest, RemovingAMiddleConnectionRelinksTheSwappedOne) {
+    VisualScript script = makeChain();
+
+    // 2 -> 3 sits in the middle, the last connection 1 -> 5 takes its slot
+    script.removeConnections(2, 3);
+
+    ASSERT_EQ(script.connections.size(), 3u);
+    EXPECT_EQ(script.connections[1].fromBlockId, 1);
+    EXPECT_EQ(script.connections[1].toBlockId, 5);
+    ASSERT_EQ(script.getIncoming(5).size(), 1u);
+    EXPECT_EQ(script.getIncoming(5)[0], 1u);
+    EXPECT_EQ(script.getOutgoing(1).size(), 2u);
+    EXPECT_TRUE(script.getOutgoing(2).empty());
+    EXPECT_TRUE(script.getIncoming(3).empty());
+    expectIndexConsistent(script);
+}
+
+TEST(VisualScriptIndexTest, RemovingALinkedBlockDropsAllItsConnections) {
+    VisualScript script = makeChain();
+
+    script.removeBlock(3);
+
+    EXPECT_EQ(script.findBlock(3), nullptr);
+    EXPECT_EQ(script.blocks.size(), 4u);
+    ASSERT_EQ(script.connections.size(), 2u);
+    for (const BlockConnection &connection : script.connections) {
+        EXPECT_NE(connection.fromBlockId, 3);
+        EXPECT_NE(connection.toBlockId, 3);
+    }
+    EXPECT_TRUE(script.getOutgoing(2).empty());
+    EXPECT_TRUE(script.getIncoming(4).empty());
+    ASSERT_NE(script.findBlock(4), nullptr);
+    EXPECT_EQ(script.findBlock(4)->id, 4);
+    expectIndexConsistent(script);
+}
+
+TEST(VisualScriptIndexTest, IncrementalValidationMatchesAFullOne) {
+    VisualScript script = makeChain();
+    std::string errors;
+
+    auto check = [&script, &errors](const char *step) {
+        script.validateConnections(errors);
+        EXPECT_EQ(errors, fullValidation(script)) << step;
+        expectIndexConsistent(script);
+    };
+
+    check("initial");
+    EXPECT_TRUE(errors.empty());
+    script.removeConnections(2, 3);
+    check("connection removed");
+    EXPECT_FALSE(errors.empty());
+    script.addConnection(BlockConnection(5, 3, {0.0f, 0.0f}, {0.0f, 0.0f}));
+    check("connection added");
+    EXPECT_TRUE(errors.empty());
+    script.addConnection(BlockConnection(4, 2, ConnectionPortType::EXECUTION_OUT, ConnectionPortType::EXECUTION_IN,
+        7, 0, {0.0f, 0.0f}, {0.0f, 0.0f}));
+    check("bad port added");
+    EXPECT_FALSE(errors.empty());
+    script.removeBlock(4);
+    check("block removed");
+    addOnCanvas(script, 6, BlockType::LOG);
+    check("orphan added");
+    EXPECT_FALSE(errors.empty());
+    script.removeConnections(1, -1);
+    check("all outputs of the start removed");
+    script.removeBlock(1);
+    check("start removed");
+}